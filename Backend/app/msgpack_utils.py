@@ -0,0 +1,44 @@
+from __future__ import annotations
+
+from datetime import datetime
+
+import msgpack
+from flask import request
+
+MSGPACK_MIMETYPE = "application/msgpack"
+
+
+def wants_msgpack() -> bool:
+    """The client prefers MessagePack over JSON (Accept: application/msgpack)."""
+    best = request.accept_mimetypes.best_match(["application/json", MSGPACK_MIMETYPE])
+    return best == MSGPACK_MIMETYPE
+
+
+def read_body() -> dict:
+    """Request body as a dict, sent as MessagePack or JSON."""
+    if request.mimetype == MSGPACK_MIMETYPE:
+        data = msgpack.unpackb(request.get_data(), raw=False)
+    else:
+        data = request.get_json(force=True)
+    return data if isinstance(data, dict) else {}
+
+
+def _default(value):
+    if isinstance(value, datetime):
+        return value.isoformat()
+    return str(value)
+
+
+def negotiate_encoding(response):
+    """after_request hook: re-encodes a JSON response as MessagePack when the
+    client asked for it. Streams, 304s and other non-JSON responses pass
+    through untouched."""
+    if not wants_msgpack() or not response.is_json or response.is_streamed:
+        return response
+    if response.status_code == 304 or not response.get_data():
+        return response
+
+    response.set_data(msgpack.packb(response.get_json(), default=_default, use_bin_type=True))
+    response.mimetype = MSGPACK_MIMETYPE
+    response.vary.add("Accept")
+    return response
@@ -1,8 +1,20 @@
-from flask import Blueprint, current_app, request
+from flask import Blueprint, Response, current_app, make_response, request, stream_with_context
 
+import json
+import math
+import time
+import zlib
 from datetime import datetime, timedelta
+from threading import Condition
+
+try:
+    from pymongo.errors import DuplicateKeyError
+except ModuleNotFoundError:
+    class DuplicateKeyError(Exception):
+        """Stand-in; only MongoDB raises it."""
 
 from ..db import get_db
+from ..msgpack_utils import negotiate_encoding, read_body, wants_msgpack
 from ..timezone_utils import get_timezone
 
 # Helper Functions
@@ -103,13 +115,13 @@ def _weekly_history(db, user_id: str, timezone_name: str, days: int = 7) -> list
     return history
 
 
-def _summary_payload(db, user_id: str) -> dict:
-    sched = db.water_schedules.find_one({"user_id": user_id}, {"_id": 0}) or {}
-    timezone_name = sched.get("timezone", current_app.config["DEFAULT_TIMEZONE"])
-    now_utc = _now_utc()
-    day_start_utc, day_end_utc = _local_day_bounds(now_utc, timezone_name)
+def _schedule_timezone(sched: dict) -> str:
+    return sched.get("timezone", current_app.config["DEFAULT_TIMEZONE"])
+
 
-    intake_events = list(
+def _today_intake_events(db, user_id: str, timezone_name: str, now_utc: datetime) -> list[dict]:
+    day_start_utc, day_end_utc = _local_day_bounds(now_utc, timezone_name)
+    return list(
         db.water_events.find(
             {
                 "user_id": user_id,
@@ -120,39 +132,62 @@ def _summary_payload(db, user_id: str) -> dict:
             sort=[("at_utc", 1)],
         )
     )
-    total_intake_ml = sum(int(event.get("amount_ml", 0)) for event in intake_events)
-    last_intake_at = intake_events[-1]["at_utc"].isoformat() if intake_events else None
 
-    next_reminder_at = None
+
+def _progress_percent(total_intake_ml: int, goal_liters: float) -> int:
+    return min(round((total_intake_ml / max(goal_liters * 1000, 1)) * 100), 100)
+
+
+def _next_reminder_at(sched: dict) -> str | None:
     if sched.get("enabled") and sched.get("interval_min"):
         last_triggered_at = sched.get("last_triggered_at")
         if last_triggered_at:
-            next_reminder_at = (
-                last_triggered_at + timedelta(minutes=int(sched["interval_min"]))
-            ).isoformat()
+            return (last_triggered_at + timedelta(minutes=int(sched["interval_min"]))).isoformat()
+    return None
+
+
+def _utc_offset_min(timezone_name: str, now_utc: datetime) -> int:
+    offset = now_utc.astimezone(get_timezone(timezone_name)).utcoffset()
+    return int(offset.total_seconds() // 60) if offset else 0
+
+
+def _schedule_view(sched: dict) -> dict:
+    timezone_name = _schedule_timezone(sched)
+    return {
+        "timezone": timezone_name,
+        # Devices keep the reminder window with this instead of a tz database.
+        # It changes (and so does the section version) when DST does.
+        "utc_offset_min": _utc_offset_min(timezone_name, _now_utc()),
+        "start_time": sched.get("start_time", "09:00"),
+        "end_time": sched.get("end_time", "18:00"),
+        "interval_min": _safe_interval_min(sched.get("interval_min", 45)),
+        "enabled": bool(sched.get("enabled", True)),
+        "daily_goal_liters": _safe_daily_goal_liters(sched.get("daily_goal_liters", 2.5)),
+    }
+
+
+def _summary_payload(db, user_id: str) -> dict:
+    sched = db.water_schedules.find_one({"user_id": user_id}, {"_id": 0}) or {}
+    timezone_name = _schedule_timezone(sched)
+    now_utc = _now_utc()
+
+    intake_events = _today_intake_events(db, user_id, timezone_name, now_utc)
+    total_intake_ml = sum(int(event.get("amount_ml", 0)) for event in intake_events)
+    last_intake_at = intake_events[-1]["at_utc"].isoformat() if intake_events else None
+    goal_liters = _safe_daily_goal_liters(sched.get("daily_goal_liters", 2.5))
 
     return {
         "user_id": user_id,
         "today": {
             "total_intake_ml": total_intake_ml,
             "total_intake_liters": round(total_intake_ml / 1000, 2),
-            "goal_liters": _safe_daily_goal_liters(sched.get("daily_goal_liters", 2.5)),
-            "progress_percent": min(
-                round((total_intake_ml / max(_safe_daily_goal_liters(sched.get("daily_goal_liters", 2.5)) * 1000, 1)) * 100),
-                100,
-            ),
+            "goal_liters": goal_liters,
+            "progress_percent": _progress_percent(total_intake_ml, goal_liters),
             "last_intake_at": last_intake_at,
-            "next_reminder_at": next_reminder_at,
+            "next_reminder_at": _next_reminder_at(sched),
         },
         "weekly_history": _weekly_history(db, user_id, timezone_name),
-        "schedule": {
-            "timezone": timezone_name,
-            "start_time": sched.get("start_time", "09:00"),
-            "end_time": sched.get("end_time", "18:00"),
-            "interval_min": _safe_interval_min(sched.get("interval_min", 45)),
-            "enabled": bool(sched.get("enabled", True)),
-            "daily_goal_liters": _safe_daily_goal_liters(sched.get("daily_goal_liters", 2.5)),
-        },
+        "schedule": _schedule_view(sched),
     }
 
 
@@ -182,7 +217,253 @@ def _latest_stress_percent(db, user_id: str) -> int:
 
     return 0
 
+
+def _device_status(db, user_id: str, sched: dict, now_utc: datetime) -> dict:
+    """Water and stress numbers the ESP32 draws; no weekly history."""
+    intake_events = _today_intake_events(db, user_id, _schedule_timezone(sched), now_utc)
+    total_intake_ml = sum(int(event.get("amount_ml", 0)) for event in intake_events)
+    goal_liters = _safe_daily_goal_liters(sched.get("daily_goal_liters", 2.5))
+
+    return {
+        "water_percent": _progress_percent(total_intake_ml, goal_liters),
+        "stress_percent": _latest_stress_percent(db, user_id),
+        "water": {
+            "total_intake_ml": total_intake_ml,
+            "total_intake_liters": round(total_intake_ml / 1000, 2),
+            "goal_liters": goal_liters,
+            "next_reminder_at": _next_reminder_at(sched),
+        },
+    }
+
+
+def _reminder_decision(db, user_id: str, sched: dict | None, now_utc: datetime) -> dict:
+    """Whether to remind now. Marks the schedule triggered (in the database
+    and in sched) when a reminder is due."""
+    if not sched:
+        return {"remind_now": False, "reason": "no_schedule"}
+
+    if not sched.get("enabled", False):
+        return {"remind_now": False, "reason": "disabled"}
+
+    tz = get_timezone(sched.get("timezone", "America/Toronto"))
+    now_local = now_utc.astimezone(tz)
+
+    if not in_window(now_local, sched["start_time"], sched["end_time"]):
+        return {
+            "remind_now": False,
+            "reason": "outside_window",
+            "server_time_utc": now_utc.isoformat(),
+        }
+
+    last = sched.get("last_triggered_at")  # stored in UTC as datetime
+    interval_min = int(sched["interval_min"])
+
+    if not is_due(now_utc, last, interval_min):
+        return {
+            "remind_now": False,
+            "reason": "not_due_yet",
+            "server_time_utc": now_utc.isoformat(),
+        }
+
+    # Due: mark triggered and return remind_now
+    db.water_schedules.update_one(
+        {"user_id": user_id},
+        {"$set": {"last_triggered_at": now_utc}},
+    )
+    sched["last_triggered_at"] = now_utc
+
+    # Optional log
+    db.water_events.insert_one({"user_id": user_id, "at_utc": now_utc, "type": "REMINDER_SENT"})
+
+    return {
+        "remind_now": True,
+        "reason": "due",
+        "server_time_utc": now_utc.isoformat(),
+        # Future: you can add graphics instructions here later
+        "payload": {
+            "title": "Drink water",
+            "message": "Time to hydrate!",
+            "animation": "WATER_DROP"  # placeholder for later ESP32 graphics
+        },
+    }
+
+
+def _section_version(section: dict) -> int:
+    """Content hash of a sync section. Never 0, which devices send before
+    their first sync."""
+    canonical = json.dumps(section, sort_keys=True, separators=(",", ":"), default=str)
+    return zlib.crc32(canonical.encode("utf-8")) or 1
+
+
+def _conditional_response(payload: dict, tagged: dict):
+    """payload with a strong ETag over tagged (payload minus fields that
+    change on every call, such as server_time_utc), or an empty 304 when
+    the request's If-None-Match already names it."""
+    response = make_response(payload)
+    # The MessagePack and JSON encodings are different representations, so
+    # they need different strong tags.
+    suffix = "-mp" if wants_msgpack() else ""
+    response.set_etag(f"{_section_version(tagged):08x}{suffix}")
+    response.vary.add("Accept")
+    return response.make_conditional(request)
+
+
+def _from_epoch_ms(value) -> datetime:
+    return datetime.fromtimestamp(int(value) / 1000, tz=get_timezone("UTC"))
+
+
+def _record_device_reminders(db, user_id: str, reminded_at: list[datetime], sent_logged: bool = False) -> bool:
+    """Logs reminders a device showed on its own schedule as sent (unless
+    the caller already did) and acknowledged, and moves last_triggered_at
+    up to the latest. True when last_triggered_at moved."""
+    if not reminded_at:
+        return False
+
+    event_types = ("DEVICE_ACK",) if sent_logged else ("REMINDER_SENT", "DEVICE_ACK")
+    db.water_events.insert_many(
+        [
+            {"user_id": user_id, "at_utc": at_utc, "type": event_type}
+            for at_utc in reminded_at
+            for event_type in event_types
+        ]
+    )
+
+    sched = db.water_schedules.find_one({"user_id": user_id}, {"_id": 0, "last_triggered_at": 1})
+    latest = max(reminded_at)
+    if sched is None or (sched.get("last_triggered_at") and sched["last_triggered_at"] >= latest):
+        return False
+    db.water_schedules.update_one({"user_id": user_id}, {"$set": {"last_triggered_at": latest}})
+    return True
+
+
+_unique_keys_created: set[tuple[str, tuple[str, ...]]] = set()
+
+
+def _unique_key(collection, fields: tuple[str, ...]) -> bool:
+    """Makes fields a unique key of collection for the documents that have
+    them all, so an insert of a key already stored raises DuplicateKeyError
+    however many requests race for it. The index is created once per
+    process. False for the in-memory store, which has no indexes: callers
+    look the key up before inserting instead."""
+    if not hasattr(collection, "create_index"):
+        return False
+    name = (collection.full_name, fields)
+    if name not in _unique_keys_created:
+        collection.create_index(
+            [(field, 1) for field in fields],
+            unique=True,
+            partialFilterExpression={field: {"$exists": True} for field in fields},
+        )
+        _unique_keys_created.add(name)
+    return True
+
+
+def _parse_version(value: str | None) -> int:
+    try:
+        return int(value or 0)
+    except (TypeError, ValueError):
+        return 0
+
+
+def _wants_local_reminders() -> bool:
+    return request.args.get("local_reminders") == "1"
+
+
+def _device_sync_payload(
+    db, user_id: str, status_v: int, schedule_v: int, local_reminders: bool = False
+) -> dict:
+    """Body of /device-sync and of each /events "sync" event. Devices that
+    schedule reminders themselves get no "reminder" section, and nothing is
+    marked triggered on their behalf."""
+    stored = db.water_schedules.find_one({"user_id": user_id}, {"_id": 0})
+    sched = stored or {}
+    now_utc = _now_utc()
+
+    response = {"server_time_utc": now_utc.isoformat()}
+    if not local_reminders:
+        reminder = _reminder_decision(db, user_id, stored, now_utc)
+        reminder.pop("server_time_utc", None)
+        response["reminder"] = reminder
+
+    status = _device_status(db, user_id, sched, now_utc)
+    status_version = _section_version(status)
+    if status_version != status_v:
+        response["status"] = {"v": status_version, **status}
+
+    schedule = _schedule_view(sched)
+    schedule_version = _section_version(schedule)
+    if schedule_version != schedule_v:
+        response["schedule"] = {"v": schedule_version, **schedule}
+
+    return response
+
+
+# /events streams wait on this between checks; writes that change what a
+# device shows notify it so the event goes out at once instead of on the
+# next one-second check.
+EVENT_CHECK_SECONDS = 1.0
+EVENT_HEARTBEAT_SECONDS = 20
+EVENT_STREAM_MAX_SECONDS = 60 * 60
+_device_changes = Condition()
+
+
+def _notify_devices() -> None:
+    with _device_changes:
+        _device_changes.notify_all()
+
+
+def _sse_event(name: str, data: dict) -> str:
+    return f"event: {name}\ndata: {json.dumps(data, separators=(',', ':'), default=str)}\n\n"
+
+
+# Device telemetry histograms count durations below each bound (the last
+# bucket is everything from 10 s up). The ESP32's LatencyHistogram uses the
+# same bounds, so uploads add up bucket by bucket across the fleet.
+TELEMETRY_BOUNDS_MS = [1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000]
+TELEMETRY_STAGES = ("dns", "connect", "tls", "ttfb", "transfer", "parse", "request", "redraw", "loop_late")
+TELEMETRY_PERCENTILES = (50, 90, 99)
+
+
+def _histogram_counts(value) -> list[int] | None:
+    """Bucket counts as uploaded (trailing empty buckets may be left off),
+    or None when they are not a valid histogram."""
+    if not isinstance(value, list) or len(value) > len(TELEMETRY_BOUNDS_MS) + 1:
+        return None
+    try:
+        counts = [int(count) for count in value]
+    except (TypeError, ValueError):
+        return None
+    return counts if all(count >= 0 for count in counts) else None
+
+
+def _histogram_percentile(counts: list[int], percent: int) -> int | None:
+    """Upper bound in ms of the bucket holding the percentile, or None when
+    it falls in the open-ended last bucket."""
+    samples = sum(counts)
+    rank = -(-samples * percent // 100)
+    seen = 0
+    for bucket, count in enumerate(counts):
+        seen += count
+        if seen >= rank and seen > 0:
+            return TELEMETRY_BOUNDS_MS[bucket] if bucket < len(TELEMETRY_BOUNDS_MS) else None
+    return None
+
+
+def _int_fields(value, keys: tuple[str, ...]) -> dict:
+    if not isinstance(value, dict):
+        return {}
+    fields = {}
+    for key in keys:
+        try:
+            fields[key] = int(value[key])
+        except (KeyError, TypeError, ValueError):
+            continue
+    return fields
+
 bp = Blueprint("pets", __name__)
+# Answers in MessagePack instead of JSON when the client sends
+# Accept: application/msgpack (the ESP32 does).
+bp.after_request(negotiate_encoding)
 
 # Routes 
 
@@ -201,7 +482,7 @@ def set_schedule():
       }
     """
     db = get_db()
-    data = request.get_json(force=True)
+    data = read_body()
 
     user_id = data.get("user_id")
     if not user_id:
@@ -244,6 +525,7 @@ def set_schedule():
         {"$set": doc, "$setOnInsert": {"last_triggered_at": None}}, # if user not found -> last triggered is none, otherwise update 
         upsert=True,
     )
+    _notify_devices()
 
     return {"ok": True, "schedule": doc}
 
@@ -262,7 +544,8 @@ def get_schedule():
     # last_triggered_at is datetime (ok to return if Flask auto-json can handle it? safer stringify)
     if sched.get("last_triggered_at"):
         sched["last_triggered_at"] = sched["last_triggered_at"].isoformat()
-    return sched
+    sched["utc_offset_min"] = _utc_offset_min(_schedule_timezone(sched), _now_utc())
+    return _conditional_response(sched, sched)
 
 
 @bp.get("/poll")
@@ -284,76 +567,258 @@ def poll_for_reminder():
         return {"error": "missing user_id"}, 400
 
     sched = db.water_schedules.find_one({"user_id": user_id})
-    if not sched:
-        return {"remind_now": False, "reason": "no_schedule"}
+    return _reminder_decision(db, user_id, sched, datetime.now(tz=get_timezone("UTC")))
 
-    if not sched.get("enabled", False):
-        return {"remind_now": False, "reason": "disabled"}
 
-    now_utc = datetime.now(tz=get_timezone("UTC"))
-    tz = get_timezone(sched.get("timezone", "America/Toronto"))
-    now_local = now_utc.astimezone(tz)
+@bp.post("/ack")
+def ack_reminder():
+    """
+    ESP32 can call after it displays the reminder (optional).
+    Body: {"user_id":"audrey"}
+    A device that schedules reminders itself reports the ones it showed in
+    batches instead, as epoch milliseconds:
+      {"user_id":"audrey", "reminded_at_ms":[1772398800000, ...]}
+    Each is logged as sent and acknowledged at that time, and the latest
+    becomes the schedule's last_triggered_at.
+    """
+    db = get_db()
+    data = read_body()
+    user_id = data.get("user_id")
+    if not user_id:
+        return {"error": "missing user_id"}, 400
 
-    if not in_window(now_local, sched["start_time"], sched["end_time"]):
-        return {
-            "remind_now": False,
-            "reason": "outside_window",
-            "server_time_utc": now_utc.isoformat(),
-        }
+    reminded_at_ms = data.get("reminded_at_ms")
+    if reminded_at_ms is None:
+        now_utc = datetime.now(tz=get_timezone("UTC"))
+        db.water_events.insert_one({"user_id": user_id, "at_utc": now_utc, "type": "DEVICE_ACK"})
+        return {"ok": True}
 
-    last = sched.get("last_triggered_at")  # stored in UTC as datetime
-    interval_min = int(sched["interval_min"])
+    try:
+        reminded_at = [_from_epoch_ms(ms) for ms in reminded_at_ms]
+    except (TypeError, ValueError, OverflowError, OSError):
+        return {"error": "reminded_at_ms must be a list of epoch milliseconds"}, 400
 
-    if not is_due(now_utc, last, interval_min):
-        return {
-            "remind_now": False,
-            "reason": "not_due_yet",
-            "server_time_utc": now_utc.isoformat(),
-        }
+    if _record_device_reminders(db, user_id, reminded_at):
+        _notify_devices()
+    return {"ok": True, "acked": len(reminded_at)}
 
-    # Due: mark triggered and return remind_now
-    db.water_schedules.update_one(
-        {"user_id": user_id},
-        {"$set": {"last_triggered_at": now_utc}},
-    )
 
-    # Optional log
-    db.water_events.insert_one({"user_id": user_id, "at_utc": now_utc, "type": "REMINDER_SENT"})
+@bp.post("/device-events")
+def upload_device_events():
+    """
+    ESP32 uploads its offline event log in batches.
+    Body:
+      {
+        "user_id": "audrey",
+        "log_id": 305419896,
+        "events": [
+          {"seq": 41, "type": "intake", "amount_ml": 250, "at_ms": 1772398800000},
+          {"seq": 42, "type": "reminder", "at_ms": 1772402400000}
+        ]
+      }
+    (log_id, seq) is the idempotency key: an event already stored is
+    counted as a duplicate and skipped, so a batch whose response was lost
+    can simply be sent again. On MongoDB a unique index enforces it, so two
+    overlapping resends cannot both store an event. at_ms of 0 (the device had no clock yet)
+    means now. Malformed events are skipped too, so one bad record cannot
+    wedge the device's log; the whole batch is acknowledged either way.
+    """
+    db = get_db()
+    data = read_body()
 
-    return {
-        "remind_now": True,
-        "reason": "due",
-        "server_time_utc": now_utc.isoformat(),
-        # Future: you can add graphics instructions here later
-        "payload": {
-            "title": "Drink water",
-            "message": "Time to hydrate!",
-            "animation": "WATER_DROP"  # placeholder for later ESP32 graphics
-        },
-    }
+    user_id = data.get("user_id")
+    events = data.get("events")
+    if not user_id:
+        return {"error": "missing user_id"}, 400
+    if data.get("log_id") is None or not isinstance(events, list):
+        return {"error": "missing log_id/events"}, 400
 
+    log_id = data["log_id"]
+    keyed = _unique_key(db.water_events, ("user_id", "log_id", "seq"))
+    accepted = duplicates = rejected = 0
+    intake_logged = False
+    reminded_at: list[datetime] = []
 
-@bp.post("/ack")
-def ack_reminder():
+    for event in events:
+        try:
+            seq = int(event["seq"])
+            at_ms = int(event.get("at_ms") or 0)
+            at_utc = _from_epoch_ms(at_ms) if at_ms > 0 else _now_utc()
+            event_type = event["type"]
+            amount_ml = int(event.get("amount_ml", 0))
+        except (KeyError, TypeError, ValueError, OverflowError, OSError):
+            rejected += 1
+            continue
+
+        key = {"user_id": user_id, "log_id": log_id, "seq": seq}
+        if not keyed and db.water_events.find_one(key, {"_id": 1}):
+            duplicates += 1
+            continue
+
+        if event_type == "intake" and amount_ml > 0:
+            record = {**key, "at_utc": at_utc, "type": "INTAKE", "amount_ml": amount_ml, "source": "esp32"}
+        elif event_type == "reminder":
+            # The key goes on the REMINDER_SENT record only.
+            record = {**key, "at_utc": at_utc, "type": "REMINDER_SENT"}
+        else:
+            rejected += 1
+            continue
+        try:
+            db.water_events.insert_one(record)
+        except DuplicateKeyError:
+            duplicates += 1
+            continue
+
+        if record["type"] == "INTAKE":
+            intake_logged = True
+        else:
+            reminded_at.append(at_utc)
+        accepted += 1
+
+    moved = _record_device_reminders(db, user_id, reminded_at, sent_logged=True)
+    if intake_logged or moved:
+        _notify_devices()
+
+    return {"ok": True, "accepted": accepted, "duplicates": duplicates, "rejected": rejected}
+
+
+@bp.post("/device-telemetry")
+def upload_device_telemetry():
     """
-    ESP32 can call after it displays the reminder (optional).
-    Body: {"user_id":"audrey"}
+    ESP32 uploads timing histograms and health readings every 15 minutes.
+    Body:
+      {
+        "user_id": "audrey",
+        "upload_id": 2882400001,
+        "seq": 3,
+        "uptime_ms": 900000,
+        "bounds_ms": [1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000],
+        "stages": {"dns": [0, 0, 0, 0, 0, 2], "request": [0, 0, 0, 0, 0, 0, 3, 9]},
+        "heap": {"free": 181244, "min_free": 150320, "largest_block": 110580},
+        "wifi": {"rssi": -61, "min_rssi": -70}
+      }
+    Each histogram holds only the samples taken since the device's last
+    accepted upload. Unknown stages are ignored; a histogram with other
+    bounds than TELEMETRY_BOUNDS_MS is refused, as it cannot be added up.
+    (upload_id, seq) is the idempotency key, as (log_id, seq) is for
+    device-events: upload_id is picked at each boot, and an upload whose
+    response was lost is sent again under the same seq, so a copy already
+    stored is acknowledged as a duplicate instead of being counted twice.
     """
     db = get_db()
-    data = request.get_json(force=True)
+    data = read_body()
+
     user_id = data.get("user_id")
     if not user_id:
         return {"error": "missing user_id"}, 400
+    try:
+        key = {"user_id": user_id, "upload_id": int(data["upload_id"]), "seq": int(data["seq"])}
+    except (KeyError, TypeError, ValueError):
+        return {"error": "missing upload_id/seq"}, 400
+    if data.get("bounds_ms") != TELEMETRY_BOUNDS_MS:
+        return {"error": "bounds_ms must be " + json.dumps(TELEMETRY_BOUNDS_MS)}, 400
+    stages = data.get("stages") or {}
+    if not isinstance(stages, dict):
+        return {"error": "stages must be an object"}, 400
+
+    histograms = {}
+    for stage in TELEMETRY_STAGES:
+        if stage not in stages:
+            continue
+        counts = _histogram_counts(stages[stage])
+        if counts is None:
+            return {"error": f"stages.{stage} must be a list of bucket counts"}, 400
+        histograms[stage] = counts
+
+    keyed = _unique_key(db.device_telemetry, ("user_id", "upload_id", "seq"))
+    if not keyed and db.device_telemetry.find_one(key, {"_id": 1}):
+        return {"ok": True, "duplicate": True}
+    try:
+        db.device_telemetry.insert_one(
+            {
+                **key,
+                "received_at": _now_utc(),
+                "uptime_ms": _int_fields(data, ("uptime_ms",)).get("uptime_ms"),
+                "stages": histograms,
+                "heap": _int_fields(data.get("heap"), ("free", "min_free", "largest_block")),
+                "wifi": _int_fields(data.get("wifi"), ("rssi", "min_rssi")),
+            }
+        )
+    except DuplicateKeyError:
+        return {"ok": True, "duplicate": True}
+    return {"ok": True, "duplicate": False}
+
+
+@bp.get("/device-telemetry")
+def get_device_telemetry():
+    """
+    Fleet-wide percentiles from the telemetry uploaded in the last `hours`
+    (default 24), across every device or just `user_id`'s. Each stage gives
+    the upper bound in ms of the bucket p50/p90/p99 fall in; null means
+    past the last bound. Also the lowest heap and weakest WiFi signal seen.
+    """
+    try:
+        hours = float(request.args.get("hours", 24))
+    except ValueError:
+        return {"error": "hours must be a number"}, 400
+    # float() also takes "nan" and "inf", which timedelta() cannot.
+    if not math.isfinite(hours) or hours <= 0:
+        return {"error": "hours must be a positive number"}, 400
+    try:
+        since = _now_utc() - timedelta(hours=hours)
+    except OverflowError:
+        return {"error": "hours is too large"}, 400
+
+    query = {"received_at": {"$gte": since}}
+    if request.args.get("user_id"):
+        query["user_id"] = request.args["user_id"]
+
+    db = get_db()
+    totals = {stage: [0] * (len(TELEMETRY_BOUNDS_MS) + 1) for stage in TELEMETRY_STAGES}
+    devices = set()
+    uploads = 0
+    min_free_heap = None
+    min_rssi = None
+    for record in db.device_telemetry.find(query, {"_id": 0}):
+        uploads += 1
+        devices.add(record.get("user_id"))
+        for stage, counts in (record.get("stages") or {}).items():
+            if stage in totals:
+                for bucket, count in enumerate(counts):
+                    totals[stage][bucket] += count
+        heap_low = (record.get("heap") or {}).get("min_free")
+        if heap_low is not None and (min_free_heap is None or heap_low < min_free_heap):
+            min_free_heap = heap_low
+        # 0 is a device with no reading.
+        rssi_low = (record.get("wifi") or {}).get("min_rssi")
+        if rssi_low and (min_rssi is None or rssi_low < min_rssi):
+            min_rssi = rssi_low
+
+    stages = {}
+    for stage, counts in totals.items():
+        samples = sum(counts)
+        if samples == 0:
+            continue
+        stages[stage] = {
+            "samples": samples,
+            **{f"p{percent}_ms": _histogram_percentile(counts, percent) for percent in TELEMETRY_PERCENTILES},
+        }
 
-    now_utc = datetime.now(tz=get_timezone("UTC"))
-    db.water_events.insert_one({"user_id": user_id, "at_utc": now_utc, "type": "DEVICE_ACK"})
-    return {"ok": True}
+    return {
+        "hours": hours,
+        "devices": len(devices),
+        "uploads": uploads,
+        "bounds_ms": TELEMETRY_BOUNDS_MS,
+        "stages": stages,
+        "min_free_heap": min_free_heap,
+        "min_rssi": min_rssi,
+    }
 
 
 @bp.post("/intake")
 def log_intake():
     db = get_db()
-    data = request.get_json(force=True)
+    data = read_body()
 
     user_id = data.get("user_id")
     if not user_id:
@@ -377,6 +842,7 @@ def log_intake():
             "source": data.get("source", "frontend"),
         }
     )
+    _notify_devices()
 
     return {"ok": True, "logged_at": consumed_at.isoformat(), "summary": _summary_payload(db, user_id)}, 201
 
@@ -398,19 +864,86 @@ def get_device_status():
         return {"error": "missing user_id"}, 400
 
     db = get_db()
-    summary = _summary_payload(db, user_id)
-    today = summary.get("today", {})
+    sched = db.water_schedules.find_one({"user_id": user_id}, {"_id": 0}) or {}
+    now_utc = _now_utc()
 
-    return {
+    status = {
         "user_id": user_id,
-        "server_time_utc": _now_utc().isoformat(),
-        "water_percent": int(today.get("progress_percent", 0) or 0),
-        "stress_percent": _latest_stress_percent(db, user_id),
-        "water": {
-            "total_intake_ml": int(today.get("total_intake_ml", 0) or 0),
-            "total_intake_liters": float(today.get("total_intake_liters", 0.0) or 0.0),
-            "goal_liters": float(today.get("goal_liters", 0.0) or 0.0),
-            "next_reminder_at": today.get("next_reminder_at"),
-        },
-        "schedule": summary.get("schedule", {}),
+        **_device_status(db, user_id, sched, now_utc),
+        "schedule": _schedule_view(sched),
     }
+    return _conditional_response({"server_time_utc": now_utc.isoformat(), **status}, status)
+
+
+@bp.get("/device-sync")
+def device_sync():
+    """
+    One ESP32 round trip in place of /poll, /device-status and /schedule.
+    Query: ?user_id=audrey&status_v=<n>&schedule_v=<n>[&local_reminders=1]
+    The reminder decision is returned (and, like /poll, marks a due reminder
+    triggered) unless local_reminders=1 says the device schedules them
+    itself. "status" and "schedule" are only included when their version
+    differs from the one the device sent; 0 means it has none.
+    """
+    user_id = request.args.get("user_id")
+    if not user_id:
+        return {"error": "missing user_id"}, 400
+
+    db = get_db()
+    return _device_sync_payload(
+        db,
+        user_id,
+        _parse_version(request.args.get("status_v")),
+        _parse_version(request.args.get("schedule_v")),
+        _wants_local_reminders(),
+    )
+
+
+@bp.get("/events")
+def device_events():
+    """
+    Server-Sent Events push channel for the ESP32, replacing /device-sync
+    polling while it is open.
+    Query: same as /device-sync.
+    Sends an "event: sync" whose data is a /device-sync body whenever a
+    reminder is due (unless local_reminders=1) or status/schedule changed since the versions the device
+    has (starting from the query), within about a second. A ": ping" comment
+    goes out after EVENT_HEARTBEAT_SECONDS of quiet so the device can tell a
+    dead connection from an idle one. The stream ends after
+    EVENT_STREAM_MAX_SECONDS; the device reconnects with its latest versions.
+    """
+    user_id = request.args.get("user_id")
+    if not user_id:
+        return {"error": "missing user_id"}, 400
+
+    db = get_db()
+    status_v = _parse_version(request.args.get("status_v"))
+    schedule_v = _parse_version(request.args.get("schedule_v"))
+    local_reminders = _wants_local_reminders()
+
+    def generate():
+        nonlocal status_v, schedule_v
+        started_at = last_sent_at = time.monotonic()
+        # Flushes the response headers so the device's GET returns.
+        yield ": connected\n\n"
+
+        while time.monotonic() - started_at < EVENT_STREAM_MAX_SECONDS:
+            payload = _device_sync_payload(db, user_id, status_v, schedule_v, local_reminders)
+            remind_now = payload.get("reminder", {}).get("remind_now", False)
+            if remind_now or "status" in payload or "schedule" in payload:
+                status_v = payload.get("status", {}).get("v", status_v)
+                schedule_v = payload.get("schedule", {}).get("v", schedule_v)
+                last_sent_at = time.monotonic()
+                yield _sse_event("sync", payload)
+            elif time.monotonic() - last_sent_at >= EVENT_HEARTBEAT_SECONDS:
+                last_sent_at = time.monotonic()
+                yield ": ping\n\n"
+
+            with _device_changes:
+                _device_changes.wait(timeout=EVENT_CHECK_SECONDS)
+
+    return Response(
+        stream_with_context(generate()),
+        mimetype="text/event-stream",
+        headers={"Cache-Control": "no-cache"},
+    )
@@ -7,8 +7,15 @@ Usage:
 """
 import os
 
+from werkzeug.serving import WSGIRequestHandler
+
 from app import create_app
 
+# Werkzeug's dev server speaks HTTP/1.0 by default and closes the socket after
+# every response. HTTP/1.1 lets the ESP32 keep one connection (and its TLS
+# session) open between polls. Set here so `flask run` picks it up too.
+WSGIRequestHandler.protocol_version = "HTTP/1.1"
+
 app = create_app()
 
 if __name__ == "__main__":
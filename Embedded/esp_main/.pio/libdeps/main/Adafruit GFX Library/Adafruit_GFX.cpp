@@ -1215,6 +1215,16 @@ void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap,
 
 // TEXT- AND CHARACTER-HANDLING FUNCTIONS ----------------------------------
 
+/**************************************************************************/
+/*!
+   @brief   Get the built-in 'classic' font table, for renderers that
+            rasterize glyphs themselves. 5 bytes per character, one per
+            column, LSB = top row.
+    @returns  Pointer to the table (in PROGMEM on AVR)
+*/
+/**************************************************************************/
+const uint8_t *Adafruit_GFX::classicFont(void) { return font; }
+
 // Draw a character
 /**************************************************************************/
 /*!
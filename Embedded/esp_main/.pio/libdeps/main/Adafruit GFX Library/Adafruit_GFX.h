@@ -184,6 +184,8 @@ public:
   /**********************************************************************/
   void cp437(bool x = true) { _cp437 = x; }
 
+  static const uint8_t *classicFont(void);
+
   using Print::write;
 #if ARDUINO >= 100
   virtual size_t write(uint8_t);
@@ -98,8 +98,18 @@ static const struct {
 #define NUM_TIMERS (sizeof tcList / sizeof tcList[0]) ///< # timer/counters
 #endif                                                // end __SAMD51__
 
+#elif defined(USE_SPI_DMA) && defined(ESP32)
+// #pragma message ("GFX ESP32 DMA IS ENABLED.")
 #endif // end USE_SPI_DMA
 
+#if defined(USE_SPI_DMA) && defined(ESP32)
+// Any CPU-driven SPI write (or CS/DC change) has to wait until queued DMA
+// transfers have drained, else bytes would interleave on the wire.
+#define ESP32_DMA_SYNC() dmaSync() ///< Drain DMA queue before CPU SPI I/O
+#else
+#define ESP32_DMA_SYNC() ///< Nothing queued behind the CPU's back
+#endif
+
 // Possible values for Adafruit_SPITFT.connection:
 #define TFT_HARD_SPI 0 ///< Display interface = hardware SPI
 #define TFT_SOFT_SPI 1 ///< Display interface = software SPI
@@ -896,6 +906,49 @@ void Adafruit_SPITFT::initSPI(uint32_t freq, uint8_t spiMode) {
     } // end addDescriptor()
     dma.free(); // Deallocate DMA channel
   }
+#elif defined(USE_SPI_DMA) && defined(ESP32)
+  if ((connection == TFT_HARD_SPI) && !dmaDevice) {
+    // One scanline on the display's major axis per pixel buffer, plus a
+    // third scanline kept filled with a solid color for writeColor().
+    int major = (WIDTH > HEIGHT) ? WIDTH : HEIGHT;
+    maxFillLen = major;
+    if ((pixelBuf[0] = (uint16_t *)heap_caps_malloc(
+             maxFillLen * 3 * sizeof(uint16_t), MALLOC_CAP_DMA))) {
+      pixelBuf[1] = &pixelBuf[0][maxFillLen];
+      fillBuf = &pixelBuf[0][maxFillLen * 2];
+      // Pins are all -1: SPI.begin() already routed SCK/MOSI/MISO to this
+      // peripheral through the GPIO matrix, and CS/DC stay under our own
+      // control, so the IDF driver mustn't touch any of them.
+      spi_bus_config_t buscfg = {};
+      buscfg.mosi_io_num = -1;
+      buscfg.miso_io_num = -1;
+      buscfg.sclk_io_num = -1;
+      buscfg.quadwp_io_num = -1;
+      buscfg.quadhd_io_num = -1;
+      buscfg.max_transfer_sz = maxFillLen * sizeof(uint16_t);
+      // Only a bus this display initializes itself: one some other driver
+      // already set up may be configured in ways CPU writes can't share.
+      if (spi_bus_initialize(ADAGFX_ESP32_DMA_HOST, &buscfg,
+                             SPI_DMA_CH_AUTO) == ESP_OK) {
+        // Same clock and mode as the Arduino SPISettings, so CPU writes
+        // and DMA writes leave the peripheral configured identically.
+        spi_device_interface_config_t devcfg = {};
+        devcfg.mode = spiMode;
+        devcfg.clock_speed_hz = freq;
+        devcfg.spics_io_num = -1;
+        devcfg.queue_size = 2; // Double-buffered, see writePixels()
+        devcfg.flags = SPI_DEVICE_NO_DUMMY;
+        if (spi_bus_add_device(ADAGFX_ESP32_DMA_HOST, &devcfg, &dmaDevice) !=
+            ESP_OK) {
+          dmaDevice = NULL;
+        }
+      }
+      if (!dmaDevice) { // Fall back on blocking SPIClass writes
+        heap_caps_free(pixelBuf[0]);
+        pixelBuf[0] = pixelBuf[1] = fillBuf = NULL;
+      }
+    }
+  }
 #endif // end USE_SPI_DMA
 }
 
@@ -919,6 +972,7 @@ void Adafruit_SPITFT::setSPISpeed(uint32_t freq) {
             for all display types; not an SPI-specific function.
 */
 void Adafruit_SPITFT::startWrite(void) {
+  SPITFT_BUS_STAT(busStartMicros = micros());
   SPI_BEGIN_TRANSACTION();
   if (_cs >= 0)
     SPI_CS_LOW();
@@ -931,9 +985,11 @@ void Adafruit_SPITFT::startWrite(void) {
             for all display types; not an SPI-specific function.
 */
 void Adafruit_SPITFT::endWrite(void) {
+  ESP32_DMA_SYNC();
   if (_cs >= 0)
     SPI_CS_HIGH();
   SPI_END_TRANSACTION();
+  SPITFT_BUS_STAT(busCounters.busyMicros += micros() - busStartMicros);
 }
 
 // -------------------------------------------------------------------------
@@ -955,6 +1011,7 @@ void Adafruit_SPITFT::writePixel(int16_t x, int16_t y, uint16_t color) {
   if ((x >= 0) && (x < _width) && (y >= 0) && (y < _height)) {
     setAddrWindow(x, y, 1, 1);
     SPI_WRITE16(color);
+    SPITFT_BUS_STAT(busCounters.pixels++; busCounters.bytes += 2);
   }
 }
 
@@ -1011,8 +1068,41 @@ void Adafruit_SPITFT::writePixels(uint16_t *colors, uint32_t len, bool block,
   (void)block;
   (void)bigEndian;
 
+  SPITFT_BUS_STAT(busCounters.pixels += len; busCounters.bytes += len * 2);
+
+#if defined(ESP32)
+  if (connection != TFT_HARD_SPI)
+#endif
+    lastCommand = 0; // RAM stream position not tracked here
+
 #if defined(ESP32)
   if (connection == TFT_HARD_SPI) {
+    ramPixels += len;
+#if defined(USE_SPI_DMA)
+    if (dmaDevice) {
+      // Copy (and byte-swap, if needed) each chunk into whichever DMA
+      // pixel buffer is not being transmitted, then queue it. The CPU
+      // prepares chunk N+1 while chunk N goes out over the wire, and the
+      // caller's buffer is free for reuse as soon as this returns.
+      while (len) {
+        uint32_t count = (len < maxFillLen) ? len : maxFillLen;
+        uint16_t *buf = pixelBuf[pixelBufIdx];
+        dmaRelease(buf);
+        if (!bigEndian) {
+          swapBytes(colors, count, buf);
+        } else {
+          memcpy(buf, colors, count * sizeof(uint16_t));
+        }
+        dmaQueue(buf, count);
+        pixelBufIdx = 1 - pixelBufIdx; // Swap DMA pixel buffers
+        colors += count;
+        len -= count;
+      }
+      if (block)
+        dmaWait();
+      return;
+    }
+#endif // end USE_SPI_DMA
     if (!bigEndian) {
       hwspi._spi->writePixels(colors, len * 2); // Inbuilt endian-swap
     } else {
@@ -1186,9 +1276,63 @@ void Adafruit_SPITFT::dmaWait(void) {
     pinPeripheral(tft8._wr, PIO_OUTPUT); // Switch WR back to GPIO
   }
 #endif // end __SAMD51__ || ARDUINO_SAMD_ZERO
+#elif defined(USE_SPI_DMA) && defined(ESP32)
+  while (dmaQueued)
+    dmaRetire();
 #endif
 }
 
+#if defined(USE_SPI_DMA) && defined(ESP32)
+/*!
+    @brief  Queue one DMA transfer of big-endian pixels. At most two
+            transfers are ever in flight; if both slots are taken, this
+            first waits for the older one to finish. 'buf' must be in
+            DMA-capable memory and stay untouched until it's released
+            (see dmaRelease()).
+    @param  buf  Pixel data, already in display byte order.
+    @param  len  Number of pixels (at most maxFillLen).
+*/
+void Adafruit_SPITFT::dmaQueue(const uint16_t *buf, uint32_t len) {
+  if (dmaQueued == 2)
+    dmaRetire();
+  spi_transaction_t *t = &dmaTrans[dmaSlot];
+  memset(t, 0, sizeof(spi_transaction_t));
+  t->length = len * 16; // In bits
+  t->tx_buffer = buf;
+  if (spi_device_queue_trans(dmaDevice, t, portMAX_DELAY) == ESP_OK) {
+    dmaQueued++;
+    dmaSlot = 1 - dmaSlot;
+  }
+}
+
+/*!
+    @brief  Block until the oldest queued DMA transfer has finished and
+            hand its slot back. Transfers complete in the order queued.
+*/
+void Adafruit_SPITFT::dmaRetire(void) {
+  spi_transaction_t *done;
+  if (spi_device_get_trans_result(dmaDevice, &done, portMAX_DELAY) == ESP_OK)
+    dmaQueued--;
+  else
+    dmaQueued = 0; // Driver lost track of it; don't spin forever
+}
+
+/*!
+    @brief  Retire queued transfers, oldest first, until none of those
+            still in flight is reading from the given buffer.
+    @param  buf  Pixel buffer the caller is about to overwrite.
+*/
+void Adafruit_SPITFT::dmaRelease(const uint16_t *buf) {
+  while (dmaQueued) {
+    uint8_t newest = 1 - dmaSlot;
+    if ((dmaTrans[newest].tx_buffer != buf) &&
+        ((dmaQueued < 2) || (dmaTrans[dmaSlot].tx_buffer != buf)))
+      break; // Neither in-flight slot references buf
+    dmaRetire();
+  }
+}
+#endif // end USE_SPI_DMA && ESP32
+
 /*!
     @brief  Check if DMA transfer is active. Always returts false if DMA
             is not enabled.
@@ -1197,6 +1341,14 @@ void Adafruit_SPITFT::dmaWait(void) {
 bool Adafruit_SPITFT::dmaBusy(void) const {
 #if defined(USE_SPI_DMA) && (defined(__SAMD51__) || defined(ARDUINO_SAMD_ZERO))
   return dma_busy;
+#elif defined(USE_SPI_DMA) && defined(ESP32)
+  // Reclaim, without waiting, whatever the driver has already finished;
+  // only the task touches dmaQueued, so no ISR-side counter can race it.
+  spi_transaction_t *done;
+  while (dmaQueued &&
+         (spi_device_get_trans_result(dmaDevice, &done, 0) == ESP_OK))
+    dmaQueued--;
+  return dmaQueued > 0;
 #else
   return false;
 #endif
@@ -1213,10 +1365,39 @@ void Adafruit_SPITFT::writeColor(uint16_t color, uint32_t len) {
   if (!len)
     return; // Avoid 0-byte transfers
 
+  SPITFT_BUS_STAT(busCounters.pixels += len; busCounters.bytes += len * 2);
+
+#if defined(ESP32)
+  if (connection != TFT_HARD_SPI)
+#endif
+    lastCommand = 0; // RAM stream position not tracked here
+
   uint8_t hi = color >> 8, lo = color;
 
 #if defined(ESP32) // ESP32 has a special SPI pixel-writing function...
   if (connection == TFT_HARD_SPI) {
+#if defined(USE_SPI_DMA)
+    if (dmaDevice) {
+      ramPixels += len;
+      // fillBuf is read-only while in flight, so the same scanline can be
+      // queued back-to-back. Only refilling it needs those xfers retired.
+      uint32_t bufLen = (len < maxFillLen) ? len : maxFillLen;
+      if ((color != lastFillColor) || (bufLen > lastFillLen)) {
+        dmaRelease(fillBuf);
+        uint16_t swapped = __builtin_bswap16(color);
+        for (uint32_t i = 0; i < bufLen; i++)
+          fillBuf[i] = swapped;
+        lastFillColor = color;
+        lastFillLen = bufLen;
+      }
+      while (len) {
+        uint32_t count = (len < bufLen) ? len : bufLen;
+        dmaQueue(fillBuf, count);
+        len -= count;
+      }
+      return;
+    }
+#endif // end USE_SPI_DMA
 #define SPI_MAX_PIXELS_AT_ONCE 32
 #define TMPBUF_LONGWORDS (SPI_MAX_PIXELS_AT_ONCE + 1) / 2
 #define TMPBUF_PIXELS (TMPBUF_LONGWORDS * 2)
@@ -1229,7 +1410,8 @@ void Adafruit_SPITFT::writeColor(uint16_t color, uint32_t len) {
     for (uint32_t t = 0; t < fillLen; t++) {
       temp[t] = c32;
     }
-    // Issue pixels in blocks from temp buffer
+    // Issue pixels in blocks from temp buffer; writePixels() counts them
+    SPITFT_BUS_STAT(busCounters.pixels -= len; busCounters.bytes -= len * 2);
     while (len) {                              // While pixels remain
       xferLen = (bufLen < len) ? bufLen : len; // How many this pass?
       writePixels((uint16_t *)temp, xferLen);
@@ -1253,6 +1435,8 @@ void Adafruit_SPITFT::writeColor(uint16_t color, uint32_t len) {
       pixbuf[i] = swap_color;
     }
 
+    // writePixels() counts these
+    SPITFT_BUS_STAT(busCounters.pixels -= len; busCounters.bytes -= len * 2);
     while (len) {
       uint32_t const count = min(len, pixbufcount);
       writePixels(pixbuf, count, true, true);
@@ -1282,6 +1466,8 @@ void Adafruit_SPITFT::writeColor(uint16_t color, uint32_t len) {
   if (pixbuf) {
     uint16_t const swap_color = __builtin_bswap16(color);
 
+    // writePixels() counts these
+    SPITFT_BUS_STAT(busCounters.pixels -= len; busCounters.bytes -= len * 2);
     while (len) {
       uint16_t count = min(len, pixbufcount);
       // fill buffer with color
@@ -1704,6 +1890,7 @@ void Adafruit_SPITFT::drawPixel(int16_t x, int16_t y, uint16_t color) {
     startWrite();
     setAddrWindow(x, y, 1, 1);
     SPI_WRITE16(color);
+    SPITFT_BUS_STAT(busCounters.pixels++; busCounters.bytes += 2);
     endWrite();
   }
 }
@@ -1862,6 +2049,7 @@ void Adafruit_SPITFT::drawFastVLine(int16_t x, int16_t y, int16_t h,
 void Adafruit_SPITFT::pushColor(uint16_t color) {
   startWrite();
   SPI_WRITE16(color);
+  SPITFT_BUS_STAT(busCounters.pixels++; busCounters.bytes += 2);
   endWrite();
 }
 
@@ -1918,6 +2106,212 @@ void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y, uint16_t *pcolors,
   endWrite();
 }
 
+/*!
+    @brief  Draw a PROGMEM-resident 16-bit image (565 RGB) at the specified
+            (x,y) position. Replaces Adafruit_GFX's pixel-at-a-time version
+            with row bursts. With ESP32 DMA each (clipped) row is queued
+            straight from flash, so the next row is staged while the
+            previous one is on the wire; elsewhere each row is copied out
+            of flash into a small RAM line buffer and pushed with a
+            blocking writePixels(). Handles its own transaction and edge
+            clipping/rejection.
+    @param  x       Top left corner horizontal coordinate.
+    @param  y       Top left corner vertical coordinate.
+    @param  bitmap  Byte array of 16-bit color values in PROGMEM.
+    @param  w       Width of bitmap in pixels.
+    @param  h       Height of bitmap in pixels.
+*/
+void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y,
+                                    const uint16_t bitmap[], int16_t w,
+                                    int16_t h) {
+
+  int16_t x2, y2;                 // Lower-right coord
+  if ((x >= _width) ||            // Off-edge right
+      (y >= _height) ||           // " top
+      ((x2 = (x + w - 1)) < 0) || // " left
+      ((y2 = (y + h - 1)) < 0))
+    return; // " bottom
+
+  int16_t bx1 = 0, by1 = 0, // Clipped top-left within bitmap
+      saveW = w;            // Save original bitmap width value
+  if (x < 0) {              // Clip left
+    w += x;
+    bx1 = -x;
+    x = 0;
+  }
+  if (y < 0) { // Clip top
+    h += y;
+    by1 = -y;
+    y = 0;
+  }
+  if (x2 >= _width)
+    w = _width - x; // Clip right
+  if (y2 >= _height)
+    h = _height - y; // Clip bottom
+
+  bitmap += by1 * saveW + bx1; // Offset bitmap ptr to clipped top-left
+  startWrite();
+  setAddrWindow(x, y, w, h); // Clipped area
+#if defined(USE_SPI_DMA) && defined(ESP32)
+  if (dmaDevice) {
+    // Flash is memory-mapped and writePixels() already stages (and
+    // byte-swaps) through its own pair of DMA buffers; don't copy twice.
+    while (h--) {
+      writePixels((uint16_t *)bitmap, w, false);
+      bitmap += saveW;
+    }
+    endWrite();
+    return;
+  }
+#endif
+  // Rows wider than the line buffer go out in several bursts. Blocking:
+  // SAMD's DMA writePixels() byte-swaps every call into the same pixelBuf,
+  // which a non-blocking previous burst may still be sending from.
+  const int16_t linePixels = 64;
+  uint16_t line[linePixels];
+  while (h--) { // For each (clipped) scanline...
+    const uint16_t *src = bitmap;
+    for (int16_t left = w; left > 0;) {
+      int16_t n = (left < linePixels) ? left : linePixels;
+      memcpy_P(line, src, n * sizeof(uint16_t));
+      writePixels(line, n);
+      src += n;
+      left -= n;
+    }
+    bitmap += saveW; // Advance pointer by one full (unclipped) line
+  }
+  dmaWait();
+  endWrite();
+}
+
+#if defined(SPITFT_BUS_STATS)
+/*!
+    @brief  Bus traffic since this FrameProfile was created.
+    @return Counter deltas
+*/
+Adafruit_SPITFT::BusStats Adafruit_SPITFT::FrameProfile::result(void) const {
+  const BusStats &now = display.busCounters;
+  BusStats delta;
+  delta.transactions = now.transactions - start.transactions;
+  delta.commands = now.commands - start.commands;
+  delta.addrWindows = now.addrWindows - start.addrWindows;
+  delta.pixels = now.pixels - start.pixels;
+  delta.bytes = now.bytes - start.bytes;
+  delta.busyMicros = now.busyMicros - start.busyMicros;
+  return delta;
+}
+
+/*!
+    @brief  Print result() as one line, prefixed with the label if any.
+    @param  p  Destination, e.g. Serial
+*/
+void Adafruit_SPITFT::FrameProfile::print(Print &p) const {
+  BusStats d = result();
+  if (label) {
+    p.print(label);
+    p.print(": ");
+  }
+  p.print("tx=");
+  p.print((unsigned long)d.transactions);
+  p.print(" cmd=");
+  p.print((unsigned long)d.commands);
+  p.print(" win=");
+  p.print((unsigned long)d.addrWindows);
+  p.print(" px=");
+  p.print((unsigned long)d.pixels);
+  p.print(" bytes=");
+  p.print((unsigned long)d.bytes);
+  p.print(" busy=");
+  p.print((unsigned long)d.busyMicros);
+  p.println("us");
+}
+#endif // SPITFT_BUS_STATS
+
+/*!
+    @brief  Draw a palette-indexed image stored in PROGMEM. Pixels are
+            packed 8/bpp per byte, leftmost pixel in the most significant
+            bits, and each row starts on a byte boundary. Indices are
+            expanded through the palette straight into a pair of small RAM
+            line buffers, so flash reads drop to
+            bpp/16 of an RGB565 image. Handles its own transaction and edge
+            clipping/rejection.
+    @param  x        Top left corner horizontal coordinate.
+    @param  y        Top left corner vertical coordinate.
+    @param  bitmap   Packed indices in PROGMEM.
+    @param  palette  (1 << bpp) 16-bit '565' colors in PROGMEM.
+    @param  bpp      Bits per pixel: 1, 2, 4 or 8.
+    @param  w        Width of bitmap in pixels.
+    @param  h        Height of bitmap in pixels.
+*/
+void Adafruit_SPITFT::drawIndexedBitmap(int16_t x, int16_t y,
+                                        const uint8_t bitmap[],
+                                        const uint16_t palette[], uint8_t bpp,
+                                        int16_t w, int16_t h) {
+
+  if ((bpp != 1) && (bpp != 2) && (bpp != 4) && (bpp != 8))
+    return;
+
+  int16_t x2, y2;                 // Lower-right coord
+  if ((x >= _width) ||            // Off-edge right
+      (y >= _height) ||           // " top
+      ((x2 = (x + w - 1)) < 0) || // " left
+      ((y2 = (y + h - 1)) < 0))
+    return; // " bottom
+
+  int16_t bx1 = 0, by1 = 0,        // Clipped top-left within bitmap
+      stride = (w * bpp + 7) / 8; // Bytes per (unclipped) row
+  if (x < 0) {                    // Clip left
+    w += x;
+    bx1 = -x;
+    x = 0;
+  }
+  if (y < 0) { // Clip top
+    h += y;
+    by1 = -y;
+    y = 0;
+  }
+  if (x2 >= _width)
+    w = _width - x; // Clip right
+  if (y2 >= _height)
+    h = _height - y; // Clip bottom
+
+  // Byte-swap the palette once, so expanded rows are already in display
+  // order and writePixels() can send them as-is.
+  uint16_t lut[256];
+  uint16_t colors = 1 << bpp;
+  for (uint16_t i = 0; i < colors; i++) {
+    uint16_t c = pgm_read_word(&palette[i]);
+    lut[i] = (c << 8) | (c >> 8);
+  }
+  const uint8_t mask = colors - 1;
+
+  bitmap += by1 * stride; // Offset bitmap ptr to clipped top row
+  startWrite();
+  setAddrWindow(x, y, w, h); // Clipped area
+  const int16_t linePixels = 64;
+  uint16_t line[2][linePixels];
+  uint8_t idx = 0;
+  while (h--) { // For each (clipped) scanline...
+    uint32_t bit = (uint32_t)bx1 * bpp;
+    for (int16_t left = w; left > 0;) {
+      int16_t n = (left < linePixels) ? left : linePixels;
+      uint16_t *dst = line[idx];
+      for (int16_t i = 0; i < n; i++, bit += bpp) {
+        uint8_t b = pgm_read_byte(&bitmap[bit >> 3]);
+        dst[i] = lut[(b >> (8 - bpp - (bit & 7))) & mask];
+      }
+      writePixels(line[idx], n, false, true);
+      idx = 1 - idx;
+      left -= n;
+    }
+    bitmap += stride;
+  }
+  // Big-endian rows can go out by DMA straight from line[], which is gone
+  // once this returns, and CS mustn't rise under a running transfer.
+  dmaWait();
+  endWrite();
+}
+
 // -------------------------------------------------------------------------
 // Miscellaneous class member functions that don't draw anything.
 
@@ -1955,12 +2349,15 @@ data
 */
 void Adafruit_SPITFT::sendCommand(uint8_t commandByte, uint8_t *dataBytes,
                                   uint8_t numDataBytes) {
+  ESP32_DMA_SYNC();
+  SPITFT_BUS_STAT(busStartMicros = micros());
   SPI_BEGIN_TRANSACTION();
   if (_cs >= 0)
     SPI_CS_LOW();
 
   SPI_DC_LOW();          // Command mode
   spiWrite(commandByte); // Send the command byte
+  SPITFT_BUS_STAT(busCounters.commands++; busCounters.bytes += numDataBytes);
 
   SPI_DC_HIGH();
   for (int i = 0; i < numDataBytes; i++) {
@@ -1976,6 +2373,7 @@ void Adafruit_SPITFT::sendCommand(uint8_t commandByte, uint8_t *dataBytes,
   if (_cs >= 0)
     SPI_CS_HIGH();
   SPI_END_TRANSACTION();
+  SPITFT_BUS_STAT(busCounters.busyMicros += micros() - busStartMicros);
 }
 
 /*!
@@ -1987,12 +2385,15 @@ void Adafruit_SPITFT::sendCommand(uint8_t commandByte, uint8_t *dataBytes,
  */
 void Adafruit_SPITFT::sendCommand(uint8_t commandByte, const uint8_t *dataBytes,
                                   uint8_t numDataBytes) {
+  ESP32_DMA_SYNC();
+  SPITFT_BUS_STAT(busStartMicros = micros());
   SPI_BEGIN_TRANSACTION();
   if (_cs >= 0)
     SPI_CS_LOW();
 
   SPI_DC_LOW();          // Command mode
   spiWrite(commandByte); // Send the command byte
+  SPITFT_BUS_STAT(busCounters.commands++; busCounters.bytes += numDataBytes);
 
   SPI_DC_HIGH();
   for (int i = 0; i < numDataBytes; i++) {
@@ -2007,6 +2408,7 @@ void Adafruit_SPITFT::sendCommand(uint8_t commandByte, const uint8_t *dataBytes,
   if (_cs >= 0)
     SPI_CS_HIGH();
   SPI_END_TRANSACTION();
+  SPITFT_BUS_STAT(busCounters.busyMicros += micros() - busStartMicros);
 }
 
 /*!
@@ -2023,9 +2425,12 @@ void Adafruit_SPITFT::sendCommand(uint8_t commandByte, const uint8_t *dataBytes,
 void Adafruit_SPITFT::sendCommand16(uint16_t commandWord,
                                     const uint8_t *dataBytes,
                                     uint8_t numDataBytes) {
+  ESP32_DMA_SYNC();
+  SPITFT_BUS_STAT(busStartMicros = micros());
   SPI_BEGIN_TRANSACTION();
   if (_cs >= 0)
     SPI_CS_LOW();
+  SPITFT_BUS_STAT(busCounters.commands++; busCounters.bytes += numDataBytes);
 
   if (numDataBytes == 0) {
     SPI_DC_LOW();             // Command mode
@@ -2043,6 +2448,7 @@ void Adafruit_SPITFT::sendCommand16(uint16_t commandWord,
   if (_cs >= 0)
     SPI_CS_HIGH();
   SPI_END_TRANSACTION();
+  SPITFT_BUS_STAT(busCounters.busyMicros += micros() - busStartMicros);
 }
 
 /*!
@@ -2118,6 +2524,7 @@ uint16_t Adafruit_SPITFT::readcommand16(uint16_t addr) {
             encapsulated both actions.
 */
 inline void Adafruit_SPITFT::SPI_BEGIN_TRANSACTION(void) {
+  SPITFT_BUS_STAT(busCounters.transactions++);
   if (connection == TFT_HARD_SPI) {
 #if defined(SPI_HAS_TRANSACTION)
     hwspi._spi->beginTransaction(hwspi.settings);
@@ -2163,10 +2570,12 @@ inline void Adafruit_SPITFT::SPI_END_TRANSACTION(void) {
     @param  b  8-bit value to write.
 */
 void Adafruit_SPITFT::spiWrite(uint8_t b) {
+  lastCommand = 0; // Byte-wise data; no longer a known pixel stream
   if (connection == TFT_HARD_SPI) {
 #if defined(__AVR__)
     AVR_WRITESPI(b);
 #elif defined(ESP8266) || defined(ESP32)
+    ESP32_DMA_SYNC();
     hwspi._spi->write(b);
 #elif defined(ARDUINO_ARCH_RP2040)
     spi_inst_t *pi_spi = hwspi._spi == &SPI ? __SPI0_DEVICE : __SPI1_DEVICE;
@@ -2206,9 +2615,13 @@ void Adafruit_SPITFT::spiWrite(uint8_t b) {
     @param  cmd  8-bit command to write.
 */
 void Adafruit_SPITFT::writeCommand(uint8_t cmd) {
+  ESP32_DMA_SYNC();
   SPI_DC_LOW();
   spiWrite(cmd);
   SPI_DC_HIGH();
+  lastCommand = cmd;
+  ramPixels = 0;
+  SPITFT_BUS_STAT(busCounters.commands++);
 }
 
 /*!
@@ -2285,6 +2698,7 @@ uint8_t Adafruit_SPITFT::spiRead(void) {
     @param  w  16-bit value to write.
 */
 void Adafruit_SPITFT::write16(uint16_t w) {
+  lastCommand = 0;
   if (connection == TFT_PARALLEL) {
 #if defined(USE_FAST_PINIO)
     if (tft8.wide)
@@ -2308,6 +2722,7 @@ void Adafruit_SPITFT::writeCommand16(uint16_t cmd) {
   SPI_DC_LOW();
   write16(cmd);
   SPI_DC_HIGH();
+  SPITFT_BUS_STAT(busCounters.commands++);
 }
 
 /*!
@@ -2447,11 +2862,13 @@ inline bool Adafruit_SPITFT::SPI_MISO_READ(void) {
     @param  w  16-bit value to write.
 */
 void Adafruit_SPITFT::SPI_WRITE16(uint16_t w) {
+  ramPixels++;
   if (connection == TFT_HARD_SPI) {
 #if defined(__AVR__)
     AVR_WRITESPI(w >> 8);
     AVR_WRITESPI(w);
 #elif defined(ESP8266) || defined(ESP32)
+    ESP32_DMA_SYNC();
     hwspi._spi->write16(w);
 #elif defined(ARDUINO_ARCH_RP2040)
     spi_inst_t *pi_spi = hwspi._spi == &SPI ? __SPI0_DEVICE : __SPI1_DEVICE;
@@ -2503,6 +2920,7 @@ void Adafruit_SPITFT::SPI_WRITE16(uint16_t w) {
     @param  l  32-bit value to write.
 */
 void Adafruit_SPITFT::SPI_WRITE32(uint32_t l) {
+  ramPixels += 2;
   if (connection == TFT_HARD_SPI) {
 #if defined(__AVR__)
     AVR_WRITESPI(l >> 24);
@@ -2510,6 +2928,7 @@ void Adafruit_SPITFT::SPI_WRITE32(uint32_t l) {
     AVR_WRITESPI(l >> 8);
     AVR_WRITESPI(l);
 #elif defined(ESP8266) || defined(ESP32)
+    ESP32_DMA_SYNC();
     hwspi._spi->write32(l);
 #elif defined(ARDUINO_ARCH_RP2040)
     spi_inst_t *pi_spi = hwspi._spi == &SPI ? __SPI0_DEVICE : __SPI1_DEVICE;
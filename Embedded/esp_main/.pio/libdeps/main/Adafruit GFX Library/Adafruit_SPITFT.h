@@ -90,6 +90,32 @@ typedef volatile ADAGFX_PORT_t *PORTreg_t; ///< PORT register type
 
 #if defined(USE_SPI_DMA) && (defined(__SAMD51__) || defined(ARDUINO_SAMD_ZERO))
 #include <Adafruit_ZeroDMA.h>
+#elif defined(USE_SPI_DMA) && defined(ESP32)
+// ESP32 DMA goes through the ESP-IDF SPI master driver, which shares the
+// SPI peripheral (and its GPIO routing) already set up by SPI.begin().
+// Experimental: the driver rewrites the peripheral's registers on every
+// transaction and SPIClass writes in between have only been checked
+// against the host sim, not on hardware.
+// Estimated RAM usage: 6 bytes/pixel on display major axis (two pixel
+// buffers plus one solid-fill buffer), all in DMA-capable memory.
+#include <driver/spi_master.h>
+#include <esp_heap_caps.h>
+#if !defined(ADAGFX_ESP32_DMA_HOST)
+#if defined(CONFIG_IDF_TARGET_ESP32)
+#define ADAGFX_ESP32_DMA_HOST SPI3_HOST ///< VSPI, Arduino's default SPI
+#else
+#define ADAGFX_ESP32_DMA_HOST SPI2_HOST ///< FSPI, Arduino's default SPI
+#endif
+#endif
+#endif
+
+// Bus traffic counters (see Adafruit_SPITFT::busStats() and FrameProfile)
+// are compiled in only with -DSPITFT_BUS_STATS. Otherwise every hook below
+// expands to nothing and the display code is unchanged.
+#if defined(SPITFT_BUS_STATS)
+#define SPITFT_BUS_STAT(statement) statement ///< Counter update
+#else
+#define SPITFT_BUS_STAT(statement) ///< Compiled out
 #endif
 
 // This is kind of a kludge. Needed a way to disambiguate the software SPI
@@ -264,10 +290,69 @@ public:
   using Adafruit_GFX::drawRGBBitmap; // Check base class first
   void drawRGBBitmap(int16_t x, int16_t y, uint16_t *pcolors, int16_t w,
                      int16_t h);
+  void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w,
+                     int16_t h);
+  // Palette-indexed (1/2/4/8 bpp) PROGMEM image, expanded at blit time
+  void drawIndexedBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                         const uint16_t palette[], uint8_t bpp, int16_t w,
+                         int16_t h);
 
   void invertDisplay(bool i);
   uint16_t color565(uint8_t r, uint8_t g, uint8_t b);
 
+  /// What the display has sent over the bus, see busStats()
+  struct BusStats {
+    uint32_t transactions; ///< Transactions begun (startWrite(), sendCommand())
+    uint32_t commands;     ///< Command bytes/words
+    uint32_t addrWindows;  ///< setAddrWindow() calls
+    uint32_t pixels;       ///< Pixels pushed
+    uint32_t bytes;        ///< Data bytes: pixels, window and command args
+    uint32_t busyMicros;   ///< Time between transaction begin and end
+  };
+#if defined(SPITFT_BUS_STATS)
+  /*!
+    @brief  Bus totals since power-up or the last resetBusStats(). Only
+            available when built with -DSPITFT_BUS_STATS.
+    @return Reference to the live counters
+  */
+  const BusStats &busStats(void) const { return busCounters; }
+  /// Zero the busStats() counters.
+  void resetBusStats(void) { busCounters = BusStats(); }
+#endif
+
+  /*!
+    @brief  Scoped bus profile: counts what the display sends between
+            construction and destruction and, given a Print, reports it
+            there as one line when it goes out of scope. Without
+            SPITFT_BUS_STATS the class is empty and compiles away.
+  */
+  class FrameProfile {
+  public:
+#if defined(SPITFT_BUS_STATS)
+    FrameProfile(Adafruit_SPITFT &display, const char *label = nullptr,
+                 Print *out = nullptr)
+        : display(display), label(label), out(out),
+          start(display.busCounters) {}
+    ~FrameProfile() {
+      if (out)
+        print(*out);
+    }
+    BusStats result(void) const;
+    void print(Print &p) const;
+
+  private:
+    Adafruit_SPITFT &display;
+    const char *label;
+    Print *out;
+    BusStats start;
+#else
+    FrameProfile(Adafruit_SPITFT &, const char * = nullptr,
+                 Print * = nullptr) {}
+    BusStats result(void) const { return BusStats(); }
+    void print(Print &) const {}
+#endif
+  };
+
   // Despite parallel additions, function names kept for compatibility:
   void spiWrite(uint8_t b);          // Write single byte as DATA
   void writeCommand(uint8_t cmd);    // Write single byte as COMMAND
@@ -391,6 +476,19 @@ protected:
   inline void TFT_WR_STROBE(void); // Parallel interface write strobe
   inline void TFT_RD_HIGH(void);   // Parallel interface read high
   inline void TFT_RD_LOW(void);    // Parallel interface read low
+#if defined(USE_SPI_DMA) && defined(ESP32)
+  void dmaQueue(const uint16_t *buf, uint32_t len); // Start one DMA xfer
+  void dmaRetire(void); // Reclaim oldest finished (or finishing) xfer
+  void dmaRelease(const uint16_t *buf); // Wait until buf isn't in flight
+  /*!
+      @brief  Finish any queued DMA transfers before the CPU touches the
+              SPI bus or the DC/CS lines directly. Cheap when idle.
+  */
+  void dmaSync(void) {
+    if (dmaQueued)
+      dmaWait();
+  }
+#endif
 
   // CLASS INSTANCE VARIABLES --------------------------------------------
 
@@ -510,6 +608,17 @@ protected:
   uint16_t lastFillColor = 0;        ///< Last color used w/fill
   uint32_t lastFillLen = 0;          ///< # of pixels w/last fill
   uint8_t onePixelBuf;               ///< For hi==lo fill
+#elif defined(USE_SPI_DMA) && defined(ESP32) // Used by hardware SPI only
+  spi_device_handle_t dmaDevice = NULL; ///< IDF SPI master device (or NULL)
+  spi_transaction_t dmaTrans[2];        ///< One slot per in-flight xfer
+  uint16_t *pixelBuf[2] = {NULL, NULL}; ///< Working buffers (DMA-capable)
+  uint16_t *fillBuf = NULL;             ///< Solid-color buffer for fills
+  uint16_t maxFillLen = 0;              ///< Max pixels per DMA xfer
+  uint16_t lastFillColor = 0;           ///< Color currently in fillBuf
+  uint16_t lastFillLen = 0;             ///< # of valid pixels in fillBuf
+  uint8_t pixelBufIdx = 0;              ///< Next pixelBuf to be filled
+  uint8_t dmaSlot = 0;                  ///< Next dmaTrans slot to queue
+  mutable uint8_t dmaQueued = 0;        ///< Xfers queued, not yet reclaimed
 #endif
 #if defined(USE_FAST_PINIO)
 #if defined(HAS_PORT_SET_CLR)
@@ -529,6 +638,17 @@ protected:
   int8_t _cs;              ///< Chip select pin # (or -1)
   int8_t _dc;              ///< Data/command pin #
 
+#if defined(SPITFT_BUS_STATS)
+  BusStats busCounters = BusStats(); ///< busStats() totals
+  uint32_t busStartMicros = 0;       ///< micros() at transaction begin
+#endif
+  // Position in the current RAM write stream, so subclasses can tell
+  // whether a new address window just continues it. Only tracked where
+  // every pixel write can be counted (ESP32 hardware SPI); all other
+  // paths clear lastCommand, which makes the position unknown.
+  uint32_t ramPixels = 0;  ///< Pixels written since lastCommand
+  uint8_t lastCommand = 0; ///< Last writeCommand() byte, 0 = unknown
+
   int16_t _xstart = 0;          ///< Internal framebuffer X offset
   int16_t _ystart = 0;          ///< Internal framebuffer Y offset
   uint8_t invertOnCommand = 0;  ///< Command to enable invert mode
@@ -108,41 +108,49 @@ static const uint8_t PROGMEM
     ST77XX_DISPON,    ST_CMD_DELAY, // 18: Main screen turn on, no args, delay
       255 },                        //     255 = max (500 ms) delay
 
-  Rcmd1[] = {                       // 7735R init, part 1 (red or green tab)
-    15,                             // 15 commands in list:
+  Rcmd0[] = {                       // 7735R init, part 0: reset and wake
+    2,                              //  2 commands in list:
     ST77XX_SWRESET,   ST_CMD_DELAY, //  1: Software reset, 0 args, w/delay
       150,                          //     150 ms delay
     ST77XX_SLPOUT,    ST_CMD_DELAY, //  2: Out of sleep mode, 0 args, w/delay
-      255,                          //     500 ms delay
-    ST7735_FRMCTR1, 3,              //  3: Framerate ctrl - normal mode, 3 arg:
+      255 },                        //     500 ms delay
+
+  Rcmd0wake[] = {                   // 7735R startR(): wake from a hardware reset
+    1,                              //  1 command in list:
+    ST77XX_SLPOUT,    ST_CMD_DELAY, //  1: Out of sleep mode, 0 args, w/delay
+      5 },                          //     5 ms until commands are taken
+
+  Rcmd1[] = {                       // 7735R init, part 1 (red or green tab)
+    13,                             // 13 commands in list:
+    ST7735_FRMCTR1, 3,              //  1: Framerate ctrl - normal mode, 3 arg:
       0x01, 0x2C, 0x2D,             //     Rate = fosc/(1x2+40) * (LINE+2C+2D)
-    ST7735_FRMCTR2, 3,              //  4: Framerate ctrl - idle mode, 3 args:
+    ST7735_FRMCTR2, 3,              //  2: Framerate ctrl - idle mode, 3 args:
       0x01, 0x2C, 0x2D,             //     Rate = fosc/(1x2+40) * (LINE+2C+2D)
-    ST7735_FRMCTR3, 6,              //  5: Framerate - partial mode, 6 args:
+    ST7735_FRMCTR3, 6,              //  3: Framerate - partial mode, 6 args:
       0x01, 0x2C, 0x2D,             //     Dot inversion mode
       0x01, 0x2C, 0x2D,             //     Line inversion mode
-    ST7735_INVCTR,  1,              //  6: Display inversion ctrl, 1 arg:
+    ST7735_INVCTR,  1,              //  4: Display inversion ctrl, 1 arg:
       0x07,                         //     No inversion
-    ST7735_PWCTR1,  3,              //  7: Power control, 3 args, no delay:
+    ST7735_PWCTR1,  3,              //  5: Power control, 3 args, no delay:
       0xA2,
       0x02,                         //     -4.6V
       0x84,                         //     AUTO mode
-    ST7735_PWCTR2,  1,              //  8: Power control, 1 arg, no delay:
+    ST7735_PWCTR2,  1,              //  6: Power control, 1 arg, no delay:
       0xC5,                         //     VGH25=2.4C VGSEL=-10 VGH=3 * AVDD
-    ST7735_PWCTR3,  2,              //  9: Power control, 2 args, no delay:
+    ST7735_PWCTR3,  2,              //  7: Power control, 2 args, no delay:
       0x0A,                         //     Opamp current small
       0x00,                         //     Boost frequency
-    ST7735_PWCTR4,  2,              // 10: Power control, 2 args, no delay:
+    ST7735_PWCTR4,  2,              //  8: Power control, 2 args, no delay:
       0x8A,                         //     BCLK/2,
       0x2A,                         //     opamp current small & medium low
-    ST7735_PWCTR5,  2,              // 11: Power control, 2 args, no delay:
+    ST7735_PWCTR5,  2,              //  9: Power control, 2 args, no delay:
       0x8A, 0xEE,
-    ST7735_VMCTR1,  1,              // 12: Power control, 1 arg, no delay:
+    ST7735_VMCTR1,  1,              // 10: Power control, 1 arg, no delay:
       0x0E,
-    ST77XX_INVOFF,  0,              // 13: Don't invert display, no args
-    ST77XX_MADCTL,  1,              // 14: Mem access ctl (directions), 1 arg:
+    ST77XX_INVOFF,  0,              // 11: Don't invert display, no args
+    ST77XX_MADCTL,  1,              // 12: Mem access ctl (directions), 1 arg:
       0xC8,                         //     row/col addr, bottom-top refresh
-    ST77XX_COLMOD,  1,              // 15: set color mode, 1 arg, no delay:
+    ST77XX_COLMOD,  1,              // 13: set color mode, 1 arg, no delay:
       0x05 },                       //     16-bit color
 
   Rcmd2green[] = {                  // 7735R init, part 2 (green tab only)
@@ -192,7 +200,7 @@ static const uint8_t PROGMEM
       0x00, 0x9F },                 //     XEND = 159
 
   Rcmd3[] = {                       // 7735R init, part 3 (red or green tab)
-    4,                              //  4 commands in list:
+    3,                              //  3 commands in list:
     ST7735_GMCTRP1, 16      ,       //  1: Gamma Adjustments (pos. polarity), 16 args + delay:
       0x02, 0x1c, 0x07, 0x12,       //     (Not entirely necessary, but provides
       0x37, 0x32, 0x29, 0x2d,       //      accurate colors)
@@ -204,8 +212,11 @@ static const uint8_t PROGMEM
       0x2E, 0x2E, 0x37, 0x3F,
       0x00, 0x00, 0x02, 0x10,
     ST77XX_NORON,     ST_CMD_DELAY, //  3: Normal display on, no args, w/delay
-      10,                           //     10 ms delay
-    ST77XX_DISPON,    ST_CMD_DELAY, //  4: Main screen turn on, no args w/delay
+      10 },                         //     10 ms delay
+
+  Rcmd4[] = {                       // 7735R init, part 4 (red or green tab)
+    1,                              //  1 command in list:
+    ST77XX_DISPON,    ST_CMD_DELAY, //  1: Main screen turn on, no args w/delay
       100 };                        //     100 ms delay
 
 // clang-format on
@@ -227,7 +238,53 @@ void Adafruit_ST7735::initB(void) {
 */
 /**************************************************************************/
 void Adafruit_ST7735::initR(uint8_t options) {
-  commonInit(Rcmd1);
+  commonInit(Rcmd0);
+  configureR(options);
+  displayInit(Rcmd4);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Faster initR() for a controller whose RST pin was just pulsed
+            and held off for the reset time (120 ms when the panel was
+            awake, 5 ms after power-on): no software reset, and only the
+            5 ms after SLPOUT the datasheet asks before further commands.
+            The display is left off, so the first frame can be drawn into
+            frame memory first; displayOn() then shows it whole.
+    @param  options  Tab color from adafruit purchase
+*/
+/**************************************************************************/
+void Adafruit_ST7735::startR(uint8_t options) {
+  commonInit(NULL);
+  sleepOutAt = millis();
+  displayInit(Rcmd0wake);
+  configureR(options);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Switches the display on after startR(), once the 120 ms the
+            supply voltages need to settle after SLPOUT have passed
+            (waiting out whatever is left of them).
+*/
+/**************************************************************************/
+void Adafruit_ST7735::displayOn(void) {
+  uint32_t awake = millis() - sleepOutAt;
+  if (awake < ST7735_SLPOUT_SETTLE_MS) {
+    delay(ST7735_SLPOUT_SETTLE_MS - awake);
+  }
+  enableDisplay(true);
+}
+
+/**************************************************************************/
+/*!
+    @brief  The part of ST7735R initialization after wake-up: frame rate,
+            power, geometry and gamma for the tab, display still off
+    @param  options  Tab color from adafruit purchase
+*/
+/**************************************************************************/
+void Adafruit_ST7735::configureR(uint8_t options) {
+  displayInit(Rcmd1);
   if (options == INITR_GREENTAB) {
     displayInit(Rcmd2green);
     _colstart = 2;
@@ -381,4 +438,5 @@ void Adafruit_ST7735::setRotation(uint8_t m) {
   }
 
   sendCommand(ST77XX_MADCTL, &madctl, 1);
+  invalidateAddrWindow();
 }
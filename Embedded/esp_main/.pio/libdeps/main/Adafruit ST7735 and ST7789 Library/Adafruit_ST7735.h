@@ -15,6 +15,10 @@
 #define INITR_HALLOWING 0x05
 #define INITR_MINI160x80_PLUGIN 0x06
 
+// ST7735R datasheet: after SLPOUT the supply voltages need 120 ms before
+// the display shows a stable image.
+#define ST7735_SLPOUT_SETTLE_MS 120
+
 // Some register settings
 #define ST7735_MADCTL_BGR 0x08
 #define ST7735_MADCTL_MH 0x04
@@ -61,11 +65,16 @@ public:
   // plastic overlay) are odd enough that we need to do this 'by hand':
   void initB(void);                             // for ST7735B displays
   void initR(uint8_t options = INITR_GREENTAB); // for ST7735R
+  void startR(uint8_t options = INITR_GREENTAB); // initR() after a RST pulse
+  void displayOn(void);                          // ends startR()
 
   void setRotation(uint8_t m);
 
 private:
+  void configureR(uint8_t options);
+
   uint8_t tabcolor;
+  uint32_t sleepOutAt = 0; ///< millis() at startR()'s SLPOUT
 };
 
 #endif // _ADAFRUIT_ST7735H_
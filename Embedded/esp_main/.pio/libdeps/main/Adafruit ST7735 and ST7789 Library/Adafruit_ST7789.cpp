@@ -171,4 +171,5 @@ void Adafruit_ST7789::setRotation(uint8_t m) {
   }
 
   sendCommand(ST77XX_MADCTL, &madctl, 1);
+  invalidateAddrWindow();
 }
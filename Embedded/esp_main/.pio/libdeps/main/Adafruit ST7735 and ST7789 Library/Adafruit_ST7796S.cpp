@@ -175,4 +175,5 @@ void Adafruit_ST7796S::setRotation(uint8_t m) {
 
   Serial.println(madctl, HEX);
   sendCommand(ST77XX_MADCTL, &madctl, 1);
+  invalidateAddrWindow();
 }
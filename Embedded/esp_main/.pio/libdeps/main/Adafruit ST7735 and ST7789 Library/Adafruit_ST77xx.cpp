@@ -111,6 +111,7 @@ void Adafruit_ST77xx::displayInit(const uint8_t *addr) {
       delay(ms);
     }
   }
+  invalidateAddrWindow(); // Init lists may reset the controller
 }
 
 /**************************************************************************/
@@ -130,6 +131,7 @@ void Adafruit_ST77xx::begin(uint32_t freq) {
   invertOffCommand = ST77XX_INVOFF;
 
   initSPI(freq, spiMode);
+  invalidateAddrWindow();
 }
 
 /**************************************************************************/
@@ -148,7 +150,14 @@ void Adafruit_ST77xx::commonInit(const uint8_t *cmdList) {
 
 /**************************************************************************/
 /*!
-  @brief  SPI displays set an address window rectangle for blitting pixels
+  @brief  SPI displays set an address window rectangle for blitting pixels.
+          The row range is opened down to the bottom of the screen (callers
+          never write more than w*h pixels, so the extra rows are left
+          alone); a following window with the same columns that starts on
+          the next row -- a band-by-band fill, a bitmap sent row by row --
+          then just continues the open RAMWR stream and sends nothing.
+          Otherwise CASET/RASET are only sent when they differ from the
+          controller's current values.
   @param  x  Top left corner x coordinate
   @param  y  Top left corner y coordinate
   @param  w  Width of window
@@ -159,16 +168,55 @@ void Adafruit_ST77xx::setAddrWindow(uint16_t x, uint16_t y, uint16_t w,
                                     uint16_t h) {
   x += _xstart;
   y += _ystart;
+  uint16_t yEnd = _ystart + _height - 1;
+  if (y + h - 1 > yEnd)
+    yEnd = y + h - 1;
   uint32_t xa = ((uint32_t)x << 16) | (x + w - 1);
-  uint32_t ya = ((uint32_t)y << 16) | (y + h - 1);
+  uint32_t ya = ((uint32_t)y << 16) | yEnd;
+
+  SPITFT_BUS_STAT(busCounters.addrWindows++);
+
+  if ((xa == _winCols) && (lastCommand == ST77XX_RAMWR)) {
+    // Where will the controller put the next pixel? Only trust streams
+    // that haven't wrapped past the end of their window.
+    uint16_t cols = w;
+    uint16_t row0 = _winRows >> 16, row1 = _winRows & 0xFFFF;
+    uint32_t rows = ramPixels / cols;
+    if (((ramPixels % cols) == 0) && (row0 + rows == y) &&
+        (y + h - 1 <= row1)) {
+      SPITFT_BUS_STAT(windowStats.coalesced++);
+      return;
+    }
+  }
 
-  writeCommand(ST77XX_CASET); // Column addr set
-  SPI_WRITE32(xa);
+  if (xa != _winCols) {
+    writeCommand(ST77XX_CASET); // Column addr set
+    SPI_WRITE32(xa);
+    _winCols = xa;
+    SPITFT_BUS_STAT(windowStats.caset++; busCounters.bytes += 4);
+  }
 
-  writeCommand(ST77XX_RASET); // Row addr set
-  SPI_WRITE32(ya);
+  if (ya != _winRows) {
+    writeCommand(ST77XX_RASET); // Row addr set
+    SPI_WRITE32(ya);
+    _winRows = ya;
+    SPITFT_BUS_STAT(windowStats.raset++; busCounters.bytes += 4);
+  }
 
   writeCommand(ST77XX_RAMWR); // write to RAM
+  SPITFT_BUS_STAT(windowStats.ramwr++);
+}
+
+/**************************************************************************/
+/*!
+  @brief  Forget the cached address window, so the next setAddrWindow()
+          sends CASET, RASET and RAMWR unconditionally. Needed after
+          anything other than setAddrWindow() changes the controller's
+          window (reset, rotation, raw sendCommand() of CASET/RASET).
+*/
+/**************************************************************************/
+void Adafruit_ST77xx::invalidateAddrWindow(void) {
+  _winCols = _winRows = 0xFFFFFFFF;
 }
 
 /**************************************************************************/
@@ -206,6 +254,7 @@ void Adafruit_ST77xx::setRotation(uint8_t m) {
   }
 
   sendCommand(ST77XX_MADCTL, &madctl, 1);
+  invalidateAddrWindow();
 }
 
 /**************************************************************************/
@@ -240,6 +289,39 @@ void Adafruit_ST77xx::enableTearing(boolean enable) {
   sendCommand(enable ? ST77XX_TEON : ST77XX_TEOFF);
 }
 
+/**************************************************************************/
+/*!
+ @brief  Define the vertical scrolling area (VSCRDEF). All three values are
+         frame-memory lines counted from memory row 0, so they must add up
+         to the controller's line count (162 on ST7735, 320 on ST7789).
+         MADCTL MY flips RASET rows against memory rows; callers working
+         in screen rows have to convert for the current rotation.
+ @param  topFixed     Lines above the scrolling area
+ @param  scrollLines  Height of the scrolling area
+ @param  bottomFixed  Lines below the scrolling area
+ */
+/**************************************************************************/
+void Adafruit_ST77xx::setScrollArea(uint16_t topFixed, uint16_t scrollLines,
+                                    uint16_t bottomFixed) {
+  uint8_t data[] = {(uint8_t)(topFixed >> 8), (uint8_t)topFixed,
+                    (uint8_t)(scrollLines >> 8), (uint8_t)scrollLines,
+                    (uint8_t)(bottomFixed >> 8), (uint8_t)bottomFixed};
+  sendCommand(ST77XX_VSCRDEF, data, sizeof(data));
+}
+
+/**************************************************************************/
+/*!
+ @brief  Set the vertical scroll start address (VSCRSADD): the memory line
+         shown on the first line of the scrolling area. Costs one command
+         and two data bytes; nothing in frame memory is rewritten.
+ @param  line  Memory line, from topFixed to topFixed + scrollLines - 1
+ */
+/**************************************************************************/
+void Adafruit_ST77xx::scrollTo(uint16_t line) {
+  uint8_t data[] = {(uint8_t)(line >> 8), (uint8_t)line};
+  sendCommand(ST77XX_VSCRSADD, data, sizeof(data));
+}
+
 /**************************************************************************/
 /*!
  @brief  Change whether sleep mode is on or off
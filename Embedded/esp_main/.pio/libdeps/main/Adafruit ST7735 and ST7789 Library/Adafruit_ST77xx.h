@@ -58,9 +58,11 @@
 #define ST77XX_RAMRD 0x2E
 
 #define ST77XX_PTLAR 0x30
+#define ST77XX_VSCRDEF 0x33
 #define ST77XX_TEOFF 0x34
 #define ST77XX_TEON 0x35
 #define ST77XX_MADCTL 0x36
+#define ST77XX_VSCRSADD 0x37
 #define ST77XX_COLMOD 0x3A
 
 #define ST77XX_MADCTL_MY 0x80
@@ -98,15 +100,42 @@ public:
 #endif // end !ESP8266
 
   void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+  void invalidateAddrWindow(void);
   void setRotation(uint8_t r);
   void enableDisplay(boolean enable);
   void enableTearing(boolean enable);
   void enableSleep(boolean enable);
+  void setScrollArea(uint16_t topFixed, uint16_t scrollLines,
+                     uint16_t bottomFixed);
+  void scrollTo(uint16_t line);
+
+#if defined(SPITFT_BUS_STATS)
+  /// Address-window traffic counters, see addrWindowStats(). The number of
+  /// setAddrWindow() calls is busStats().addrWindows.
+  struct AddrWindowStats {
+    uint32_t coalesced; ///< Calls that continued the RAMWR stream as-is
+    uint32_t caset;     ///< CASET commands actually sent
+    uint32_t raset;     ///< RASET commands actually sent
+    uint32_t ramwr;     ///< RAMWR commands actually sent
+  };
+  /*!
+    @brief  Counters for setAddrWindow() since the last reset.
+    @return Reference to the live counters
+  */
+  const AddrWindowStats &addrWindowStats(void) const { return windowStats; }
+  /// Zero the addrWindowStats() counters.
+  void resetAddrWindowStats(void) { windowStats = AddrWindowStats(); }
+#endif
 
 protected:
   uint8_t _colstart = 0,   ///< Some displays need this changed to offset
       _rowstart = 0,       ///< Some displays need this changed to offset
       spiMode = SPI_MODE0; ///< Certain display needs MODE3 instead
+  uint32_t _winCols = 0xFFFFFFFF, ///< Last CASET argument sent
+      _winRows = 0xFFFFFFFF;      ///< Last RASET argument sent
+#if defined(SPITFT_BUS_STATS)
+  AddrWindowStats windowStats = AddrWindowStats(); ///< setAddrWindow() stats
+#endif
 
   void begin(uint32_t freq = 0);
   void commonInit(const uint8_t *cmdList);
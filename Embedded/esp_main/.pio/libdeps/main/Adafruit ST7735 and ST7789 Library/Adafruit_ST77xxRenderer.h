@@ -0,0 +1,380 @@
+/**************************************************************************
+  Compile-time specialized drawing front end for ST77xx displays.
+
+  Adafruit_GFX routes every primitive through virtual writePixel(),
+  writeFillRect(), startWrite() and setAddrWindow(), so text and circles
+  pay one or more indirect calls per pixel. Adafruit_ST77xxRenderer is
+  keyed on the concrete display class and on the rotation, and only makes
+  qualified (non-virtual) calls into it, so the hot primitives below
+  inline down to address-window + SPI writes. Clip bounds are constants.
+
+  It draws on the same display object and can be freely mixed with the
+  regular Adafruit_GFX API, as long as the display's rotation matches the
+  template argument (begin() sets it).
+
+    Adafruit_ST7735 tft(TFT_CS, TFT_DC, TFT_RST);
+    Adafruit_ST77xxRenderer<Adafruit_ST7735, 0> fastTft(tft);
+
+  MIT license, all text above must be included in any redistribution
+ **************************************************************************/
+
+#ifndef _ADAFRUIT_ST77XX_RENDERER_H_
+#define _ADAFRUIT_ST77XX_RENDERER_H_
+
+#include "Adafruit_ST77xx.h"
+
+/// Largest text size rasterized into pixel rows for opaque text; bigger
+/// text is drawn as one fill per vertical run of each glyph.
+#define ST77XX_RENDERER_MAX_TEXT_SIZE 8
+
+/*!
+  @brief  Non-virtual renderer for an Adafruit_ST77xx subclass.
+  @tparam Display   Concrete display class, e.g. Adafruit_ST7735
+  @tparam Rotation  Display rotation 0-3, fixed at compile time
+  @tparam NativeW   Panel width in pixels at rotation 0
+  @tparam NativeH   Panel height in pixels at rotation 0
+*/
+template <class Display, uint8_t Rotation,
+          int16_t NativeW = ST7735_TFTWIDTH_128,
+          int16_t NativeH = ST7735_TFTHEIGHT_160>
+class Adafruit_ST77xxRenderer {
+public:
+  static_assert(Rotation < 4, "rotation must be 0-3");
+
+  /// Drawable width at this rotation
+  static constexpr int16_t WIDTH = (Rotation & 1) ? NativeH : NativeW;
+  /// Drawable height at this rotation
+  static constexpr int16_t HEIGHT = (Rotation & 1) ? NativeW : NativeH;
+
+  /*!
+    @brief  Wrap an already constructed display.
+    @param  display  The display to draw on; must outlive the renderer
+  */
+  explicit Adafruit_ST77xxRenderer(Display &display) : tft(display) {}
+
+  /*!
+    @brief  Apply the compile-time rotation to the display. Call after
+            the display's own init (initR() etc.).
+  */
+  void begin(void) { tft.setRotation(Rotation); }
+
+  /*!
+    @brief  Same as Adafruit_GFX::cp437(), for glyphs drawn here.
+    @param  x  true = correct CP437 indices, false = classic behavior
+  */
+  void cp437(bool x = true) { _cp437 = x; }
+
+  /// @return The wrapped display
+  Display &display(void) { return tft; }
+
+  /*!
+    @brief  Start an SPI transaction; lets a caller batch several
+            write*() calls under one chip-select.
+  */
+  void startWrite(void) { tft.Display::startWrite(); }
+
+  /// End an SPI transaction started with startWrite().
+  void endWrite(void) { tft.Display::endWrite(); }
+
+  /*!
+    @brief  Draw one pixel, inside a transaction (clipped).
+    @param  x      Column
+    @param  y      Row
+    @param  color  16-bit 5-6-5 color
+  */
+  void writePixel(int16_t x, int16_t y, uint16_t color) {
+    if ((uint16_t)x < (uint16_t)WIDTH && (uint16_t)y < (uint16_t)HEIGHT) {
+      tft.Display::setAddrWindow(x, y, 1, 1);
+      tft.SPI_WRITE16(color);
+    }
+  }
+
+  /*!
+    @brief  Fill a rectangle, inside a transaction (clipped).
+    @param  x      Left edge
+    @param  y      Top edge
+    @param  w      Width in pixels
+    @param  h      Height in pixels
+    @param  color  16-bit 5-6-5 color
+  */
+  void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                     uint16_t color) {
+    if (x < 0) {
+      w += x;
+      x = 0;
+    }
+    if (y < 0) {
+      h += y;
+      y = 0;
+    }
+    if (x + w > WIDTH)
+      w = WIDTH - x;
+    if (y + h > HEIGHT)
+      h = HEIGHT - y;
+    if (w <= 0 || h <= 0)
+      return;
+    tft.Display::setAddrWindow(x, y, w, h);
+    tft.writeColor(color, (uint32_t)w * h);
+  }
+
+  /// Clipped single pixel with its own transaction.
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    startWrite();
+    writePixel(x, y, color);
+    endWrite();
+  }
+
+  /// Clipped filled rectangle with its own transaction.
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    startWrite();
+    writeFillRect(x, y, w, h, color);
+    endWrite();
+  }
+
+  /// Horizontal line, @p w pixels from (x, y).
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    fillRect(x, y, w, 1, color);
+  }
+
+  /// Vertical line, @p h pixels from (x, y).
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    fillRect(x, y, 1, h, color);
+  }
+
+  /*!
+    @brief  Circle outline; same midpoint walk as Adafruit_GFX.
+    @param  x0     Center column
+    @param  y0     Center row
+    @param  r      Radius
+    @param  color  16-bit 5-6-5 color
+  */
+  void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+
+    startWrite();
+    writePixel(x0, y0 + r, color);
+    writePixel(x0, y0 - r, color);
+    writePixel(x0 + r, y0, color);
+    writePixel(x0 - r, y0, color);
+
+    while (x < y) {
+      if (f >= 0) {
+        y--;
+        ddF_y += 2;
+        f += ddF_y;
+      }
+      x++;
+      ddF_x += 2;
+      f += ddF_x;
+
+      writePixel(x0 + x, y0 + y, color);
+      writePixel(x0 - x, y0 + y, color);
+      writePixel(x0 + x, y0 - y, color);
+      writePixel(x0 - x, y0 - y, color);
+      writePixel(x0 + y, y0 + x, color);
+      writePixel(x0 - y, y0 + x, color);
+      writePixel(x0 + y, y0 - x, color);
+      writePixel(x0 - y, y0 - x, color);
+    }
+    endWrite();
+  }
+
+  /*!
+    @brief  Draw one glyph of the built-in 'classic' 5x7 font. An opaque
+            glyph goes out as a single address window and pixel stream;
+            a transparent one as one clipped fill per vertical run.
+    @param  x      Left edge
+    @param  y      Top edge
+    @param  c      Character
+    @param  color  Foreground 5-6-5 color
+    @param  bg     Background 5-6-5 color (same as color = transparent)
+    @param  size   Magnification, 1 is original size
+  */
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+                uint16_t bg, uint8_t size = 1) {
+    startWrite();
+    writeText(x, y, &c, 1, color, bg, size);
+    endWrite();
+  }
+
+  /*!
+    @brief  Draw a string with the classic font. With an opaque
+            background each line is rasterized into pixel rows and sent
+            with one address window, instead of a window per pixel.
+            '\n' (and wrapping, if enabled) returns to @p left, @p x by
+            default, one line down; '\r' is ignored.
+    @param  x      Left edge of the first glyph
+    @param  y      Top edge of the first line
+    @param  s      NUL-terminated text
+    @param  color  Foreground 5-6-5 color
+    @param  bg     Background 5-6-5 color (same as color = transparent)
+    @param  size   Magnification, 1 is original size
+    @param  wrap   Break lines that would run past the right edge
+    @param  left   Column later lines start at, -1 for @p x. 0 lays text
+                   out like Adafruit_GFX::print() from a cursor at (x, y).
+    @return Column just past the last glyph drawn
+  */
+  int16_t drawText(int16_t x, int16_t y, const char *s, uint16_t color,
+                   uint16_t bg, uint8_t size = 1, bool wrap = false,
+                   int16_t left = -1) {
+    if (size == 0)
+      return x;
+    const int16_t cw = 6 * size;
+    int16_t cx = x;
+    const char *run = s;
+    uint16_t n = 0;
+
+    startWrite();
+    for (;;) {
+      char ch = *s;
+      if (ch && ch != '\n' && ch != '\r' &&
+          !(wrap && n > 0 && cx + (n + 1) * cw > WIDTH)) {
+        n++;
+        s++;
+        continue;
+      }
+      writeText(cx, y, (const unsigned char *)run, n, color, bg, size);
+      cx += n * cw;
+      n = 0;
+      if (!ch)
+        break;
+      if (ch == '\r') {
+        s++;
+      } else {
+        if (ch == '\n')
+          s++;
+        cx = (left < 0) ? x : left;
+        y += 8 * size;
+      }
+      run = s;
+    }
+    endWrite();
+    return cx;
+  }
+
+  /*!
+    @brief  Draw a PROGMEM 16-bit 5-6-5 bitmap; forwards to the
+            row-burst Adafruit_SPITFT::drawRGBBitmap() (no per-pixel calls
+            to begin with, so nothing to specialize here).
+    @param  x       Left edge
+    @param  y       Top edge
+    @param  bitmap  w*h pixels, row-major
+    @param  w       Width in pixels
+    @param  h       Height in pixels
+  */
+  void drawRGBBitmap(int16_t x, int16_t y, const uint16_t *bitmap, int16_t w,
+                     int16_t h) {
+    tft.Adafruit_SPITFT::drawRGBBitmap(x, y, bitmap, w, h);
+  }
+
+private:
+  // Row buffer for an opaque text span: every glyph that is at least
+  // partly visible, including one clipped at each edge.
+  static constexpr int16_t SPAN_PIXELS =
+      WIDTH + 12 * ST77XX_RENDERER_MAX_TEXT_SIZE;
+
+  /*!
+    @brief  Draw @p n glyphs on one line, inside a transaction.
+  */
+  void writeText(int16_t x, int16_t y, const unsigned char *s, uint16_t n,
+                 uint16_t color, uint16_t bg, uint8_t size) {
+    if (n == 0 || size == 0)
+      return;
+    if (bg != color && size <= ST77XX_RENDERER_MAX_TEXT_SIZE)
+      writeTextSpan(x, y, s, n, color, bg, size);
+    else
+      for (uint16_t i = 0; i < n; i++)
+        writeGlyphRuns(x + i * 6 * size, y, s[i], color, bg, size);
+  }
+
+  /*!
+    @brief  Opaque text line: one address window over the visible part,
+            then one pixel row per writePixels(). Rows are only rebuilt
+            when the font row changes (i.e. every @p size rows).
+  */
+  void writeTextSpan(int16_t x, int16_t y, const unsigned char *s,
+                     uint16_t n, uint16_t color, uint16_t bg, uint8_t size) {
+    const int16_t cw = 6 * size;
+    if (x < 0) { // Drop glyphs entirely left of the screen
+      uint16_t skip = (-x) / cw;
+      if (skip >= n)
+        return;
+      s += skip;
+      n -= skip;
+      x += skip * cw;
+    }
+    if (x >= WIDTH)
+      return;
+    uint16_t fit = (WIDTH - x + cw - 1) / cw; // ...and right of it
+    if (n > fit)
+      n = fit;
+
+    int16_t y0 = y < 0 ? 0 : y;
+    int16_t y1 = y + 8 * size > HEIGHT ? HEIGHT : y + 8 * size;
+    if (y0 >= y1)
+      return;
+    int16_t px0 = x < 0 ? -x : 0;
+    int16_t px1 = x + n * cw > WIDTH ? WIDTH - x : n * cw;
+
+    uint8_t cols[SPAN_PIXELS];
+    const uint8_t *font = Adafruit_GFX::classicFont();
+    for (uint16_t i = 0; i < n; i++) {
+      unsigned char c = s[i];
+      if (!_cp437 && (c >= 176))
+        c++; // Handle 'classic' charset behavior
+      for (uint8_t k = 0; k < 5; k++)
+        cols[i * 6 + k] = pgm_read_byte(&font[c * 5 + k]);
+      cols[i * 6 + 5] = 0;
+    }
+
+    uint16_t row[SPAN_PIXELS];
+    tft.Display::setAddrWindow(x + px0, y0, px1 - px0, y1 - y0);
+    for (int16_t py = y0; py < y1; py++) {
+      if (py == y0 || (py - y) % size == 0) {
+        uint8_t bit = (py - y) / size;
+        uint16_t *p = row;
+        for (uint16_t c = 0; c < n * 6; c++) {
+          uint16_t pc = (cols[c] >> bit) & 1 ? color : bg;
+          for (uint8_t k = 0; k < size; k++)
+            *p++ = pc;
+        }
+      }
+      tft.writePixels(row + px0, px1 - px0, false);
+    }
+  }
+
+  /*!
+    @brief  One glyph as clipped vertical fills; used for transparent
+            text and magnifications beyond the span buffer.
+  */
+  void writeGlyphRuns(int16_t x, int16_t y, unsigned char c, uint16_t color,
+                      uint16_t bg, uint8_t size) {
+    if (x >= WIDTH || y >= HEIGHT || x + 6 * size <= 0 || y + 8 * size <= 0)
+      return;
+    if (!_cp437 && (c >= 176))
+      c++; // Handle 'classic' charset behavior
+    const uint8_t *glyph = Adafruit_GFX::classicFont() + c * 5;
+    for (uint8_t i = 0; i < 6; i++) {
+      uint8_t bits = i < 5 ? pgm_read_byte(&glyph[i]) : 0;
+      uint8_t j = 0;
+      while (j < 8) {
+        uint8_t on = (bits >> j) & 1, n = 1;
+        while (j + n < 8 && ((bits >> (j + n)) & 1) == on)
+          n++;
+        if (on || bg != color)
+          writeFillRect(x + i * size, y + j * size, size, n * size,
+                        on ? color : bg);
+        j += n;
+      }
+    }
+  }
+
+  Display &tft;
+  bool _cp437 = false;
+};
+
+#endif // _ADAFRUIT_ST77XX_RENDERER_H_
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ima_adpcm.h"
+
+// A sound kept in flash as IMA ADPCM (see ima_adpcm.h).
+struct AudioClip {
+  const uint8_t *adpcm;
+  uint32_t samples;
+  uint8_t stepIndex;
+};
+
+// Plays up to Voices clips at once, decoding each straight from flash into
+// the buffer being rendered, so nothing is unpacked ahead of time. Output is
+// unsigned 8-bit samples centred on 128, which is what the ESP32 DAC takes.
+// The voices add up and the sum saturates rather than wrapping.
+//
+// Not thread safe: one task owns the mixer.
+template <size_t Voices>
+class AudioMixer {
+  static_assert(Voices > 0, "AudioMixer needs a voice");
+
+public:
+  static constexpr uint16_t UNITY_GAIN = 256;
+
+  // Starts clip from the top. When every voice is busy, the one nearest its
+  // end gives way.
+  void play(const AudioClip *clip, uint16_t gain = UNITY_GAIN) {
+    if (clip == nullptr || clip->samples == 0) {
+      return;
+    }
+    Voice *voice = &voices_[0];
+    for (Voice &candidate : voices_) {
+      if (candidate.clip == nullptr) {
+        voice = &candidate;
+        break;
+      }
+      if (remaining(candidate) < remaining(*voice)) {
+        voice = &candidate;
+      }
+    }
+    voice->clip = clip;
+    voice->position = 0;
+    voice->gain = gain;
+    voice->decoder.reset(clip->stepIndex);
+    ++started_;
+  }
+
+  // Silences every voice playing clip, or every voice for nullptr.
+  void stop(const AudioClip *clip = nullptr) {
+    for (Voice &voice : voices_) {
+      if (clip == nullptr || voice.clip == clip) {
+        voice.clip = nullptr;
+      }
+    }
+  }
+
+  bool active() const {
+    for (const Voice &voice : voices_) {
+      if (voice.clip != nullptr) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Fills out with the next count samples; silence once every clip ended.
+  void render(uint8_t *out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      int32_t sum = 0;
+      for (Voice &voice : voices_) {
+        if (voice.clip != nullptr) {
+          sum += (next(voice) * static_cast<int32_t>(voice.gain)) >> 8;
+        }
+      }
+      if (sum > 32767) {
+        sum = 32767;
+        ++clipped_;
+      } else if (sum < -32768) {
+        sum = -32768;
+        ++clipped_;
+      }
+      out[i] = static_cast<uint8_t>((sum >> 8) + 128);
+    }
+  }
+
+  // Clips started since boot.
+  uint32_t started() const { return started_; }
+  // Output samples where the voices added up past full scale.
+  uint32_t clipped() const { return clipped_; }
+
+private:
+  struct Voice {
+    const AudioClip *clip = nullptr;
+    uint32_t position = 0;
+    uint16_t gain = UNITY_GAIN;
+    ImaAdpcmDecoder decoder;
+  };
+
+  static uint32_t remaining(const Voice &voice) {
+    return voice.clip == nullptr ? 0 : voice.clip->samples - voice.position;
+  }
+
+  static int16_t next(Voice &voice) {
+    const uint8_t packed = voice.clip->adpcm[voice.position >> 1];
+    const int16_t sample = voice.decoder.decode((voice.position & 1) ? packed >> 4 : packed & 0x0f);
+    if (++voice.position == voice.clip->samples) {
+      voice.clip = nullptr;
+    }
+    return sample;
+  }
+
+  Voice voices_[Voices];
+  uint32_t started_ = 0;
+  uint32_t clipped_ = 0;
+};
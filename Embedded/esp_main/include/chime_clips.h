@@ -0,0 +1,623 @@
+#pragma once
+
+// Generated by tools/make_chime_clips.py; edit the script, not this file.
+
+#include <stdint.h>
+
+constexpr uint32_t CHIME_SAMPLE_RATE = 16000;
+
+constexpr uint32_t CHIME_REMINDER_SAMPLES = 19200;
+constexpr uint8_t CHIME_REMINDER_STEP_INDEX = 38;
+constexpr uint8_t CHIME_REMINDER_ADPCM[9600] = {
+    0x20, 0x05, 0xA8, 0xEC, 0xDB, 0x0C, 0x77, 0x81, 0x99, 0xA9, 0xB9, 0x0B, 0x77, 0x81, 0x89, 0xA9,
+    0xA9, 0x8B, 0x57, 0x82, 0x99, 0xA9, 0xAA, 0x9B, 0x67, 0x82, 0x99, 0xA8, 0x99, 0x9A, 0x74, 0x02,
+    0x99, 0x99, 0x9A, 0x9A, 0x73, 0x04, 0x89, 0x99, 0x9A, 0x9A, 0x72, 0x04, 0x98, 0x99, 0x9A, 0xA9,
+    0x71, 0x14, 0x99, 0x98, 0x9A, 0xAA, 0x71, 0x14, 0x98, 0x99, 0x9A, 0xB9, 0x60, 0x25, 0x99, 0x98,
+    0x9A, 0xB9, 0x68, 0x25, 0x98, 0x99, 0xA9, 0xA9, 0x59, 0x26, 0xA0, 0x98, 0x9A, 0xB9, 0x49, 0x37,
+    0x98, 0x98, 0x9A, 0xAA, 0x39, 0x57, 0x90, 0x98, 0x99, 0xA9, 0x19, 0x37, 0x91, 0x99, 0xA9, 0xAA,
+    0x1A, 0x67, 0x80, 0x89, 0x99, 0x99, 0x89, 0x46, 0x81, 0x99, 0x99, 0xA9, 0x8A, 0x56, 0x82, 0x99,
+    0xA9, 0x99, 0x9A, 0x65, 0x82, 0x89, 0xA9, 0x99, 0x8B, 0x74, 0x02, 0x99, 0x99, 0x9A, 0x9A, 0x73,
+    0x05, 0x99, 0x98, 0x99, 0x9A, 0x71, 0x13, 0x99, 0xA9, 0xA9, 0xAA, 0x72, 0x15, 0x99, 0x98, 0x9A,
+    0xA9, 0x70, 0x14, 0x98, 0x99, 0x9A, 0xA9, 0x68, 0x15, 0x98, 0x98, 0x9A, 0xA9, 0x58, 0x26, 0x98,
+    0x99, 0x99, 0xAA, 0x48, 0x27, 0x90, 0x99, 0xA9, 0xA9, 0x39, 0x47, 0x90, 0x98, 0x9A, 0xA9, 0x3A,
+    0x47, 0x91, 0x99, 0xA9, 0xA9, 0x19, 0x47, 0x91, 0x89, 0x9A, 0xA9, 0x1A, 0x47, 0x81, 0x99, 0xA9,
+    0xA9, 0x0A, 0x47, 0x81, 0x89, 0x9A, 0xA9, 0x8A, 0x56, 0x82, 0x99, 0xA9, 0x99, 0x8B, 0x65, 0x02,
+    0x99, 0xA9, 0xA9, 0x9A, 0x74, 0x83, 0x89, 0xA9, 0xA9, 0x9A, 0x73, 0x05, 0x89, 0x99, 0x99, 0xAA,
+    0x72, 0x04, 0x89, 0x99, 0x99, 0x9A, 0x70, 0x04, 0x98, 0x98, 0x9A, 0xA9, 0x60, 0x15, 0x98, 0x99,
+    0x99, 0x9A, 0x58, 0x16, 0x98, 0x98, 0x99, 0xAA, 0x58, 0x25, 0x90, 0xA9, 0xA9, 0xB9, 0x59, 0x27,
+    0x88, 0x99, 0x99, 0xA9, 0x3A, 0x47, 0x90, 0x89, 0xA9, 0xA9, 0x29, 0x47, 0x80, 0x99, 0x99, 0x9A,
+    0x1A, 0x47, 0x91, 0x89, 0xA9, 0xA9, 0x1A, 0x47, 0x91, 0x98, 0xA9, 0x99, 0x8A, 0x47, 0x81, 0x99,
+    0x99, 0xA9, 0x8A, 0x56, 0x82, 0x99, 0x99, 0x9A, 0x9A, 0x65, 0x82, 0x89, 0xA9, 0x99, 0x9A, 0x73,
+    0x85, 0x98, 0xA8, 0x89, 0x9A, 0x72, 0x03, 0x99, 0xA8, 0x9A, 0xAA, 0x72, 0x15, 0x99, 0xA8, 0x99,
+    0xA9, 0x70, 0x14, 0x99, 0x98, 0x9A, 0xA9, 0x60, 0x15, 0x98, 0x99, 0x99, 0xB9, 0x50, 0x26, 0x98,
+    0x99, 0x9A, 0xA9, 0x48, 0x27, 0x98, 0x98, 0xA9, 0xA9, 0x49, 0x27, 0x90, 0x99, 0x99, 0xB9, 0x39,
+    0x47, 0x80, 0x99, 0xA9, 0xA9, 0x3A, 0x47, 0x91, 0x99, 0xA9, 0x99, 0x1A, 0x47, 0x91, 0x89, 0x9A,
+    0xA9, 0x0A, 0x47, 0x81, 0x99, 0x99, 0xA9, 0x8A, 0x47, 0x92, 0x89, 0xA9, 0xA9, 0x8A, 0x75, 0x01,
+    0x99, 0x99, 0x99, 0x99, 0x64, 0x02, 0x99, 0xA9, 0x99, 0x9B, 0x74, 0x83, 0x89, 0xA9, 0x99, 0x9B,
+    0x72, 0x05, 0x98, 0x99, 0x99, 0xA9, 0x71, 0x04, 0x98, 0x99, 0x99, 0xA9, 0x70, 0x23, 0x99, 0xA9,
+    0xA9, 0xBA, 0x70, 0x16, 0x98, 0x89, 0x99, 0x9A, 0x58, 0x15, 0xA0, 0x98, 0x9A, 0xA9, 0x59, 0x26,
+    0x98, 0x98, 0x9A, 0xB9, 0x49, 0x37, 0x98, 0x89, 0x9A, 0xA9, 0x3A, 0x57, 0x90, 0x89, 0x99, 0xA9,
+    0x19, 0x37, 0x91, 0x99, 0xA9, 0xB9, 0x1A, 0x67, 0x80, 0x89, 0x99, 0x99, 0x09, 0x55, 0x81, 0x99,
+    0x99, 0xA9, 0x8A, 0x56, 0x01, 0x99, 0xA9, 0x99, 0x9A, 0x56, 0x82, 0x99, 0x99, 0x9A, 0x9A, 0x74,
+    0x02, 0x99, 0x99, 0x99, 0xAA, 0x73, 0x05, 0x99, 0x98, 0x99, 0x9A, 0x72, 0x03, 0x99, 0xA8, 0x9A,
+    0xAA, 0x71, 0x06, 0x98, 0x98, 0x99, 0x99, 0x50, 0x15, 0x89, 0x99, 0xA9, 0xA9, 0x60, 0x15, 0x98,
+    0x99, 0x99, 0xB9, 0x50, 0x16, 0x90, 0x99, 0xA9, 0xA9, 0x48, 0x27, 0x88, 0x99, 0xA9, 0xA9, 0x49,
+    0x36, 0x90, 0x99, 0xAA, 0xB9, 0x4A, 0x37, 0x91, 0x9A, 0xA9, 0xB9, 0x2A, 0x67, 0x80, 0x89, 0x99,
+    0x99, 0x1A, 0x46, 0x91, 0x89, 0x9A, 0xA9, 0x0A, 0x47, 0x81, 0x99, 0x99, 0xA9, 0x8A, 0x56, 0x82,
+    0x99, 0xA9, 0x99, 0x8B, 0x65, 0x02, 0x8A, 0xA9, 0xA9, 0x9A, 0x65, 0x02, 0x99, 0x99, 0x9A, 0xAA,
+    0x74, 0x12, 0x99, 0xA9, 0x99, 0xAA, 0x72, 0x05, 0x98, 0x99, 0x99, 0xA9, 0x71, 0x13, 0xA8, 0x99,
+    0x9A, 0xBA, 0x71, 0x15, 0x98, 0x99, 0x99, 0xAA, 0x60, 0x15, 0x98, 0x98, 0x9A, 0xAA, 0x68, 0x25,
+    0x98, 0x99, 0xA9, 0xA9, 0x59, 0x26, 0x98, 0x98, 0x9A, 0xA9, 0x4A, 0x27, 0x90, 0x98, 0x9A, 0xA9,
+    0x3A, 0x57, 0x90, 0x89, 0x99, 0xA9, 0x19, 0x37, 0x91, 0x99, 0xA9, 0xA9, 0x1B, 0x57, 0x81, 0x99,
+    0x99, 0xA9, 0x0A, 0x47, 0x81, 0x99, 0x99, 0xA9, 0x8A, 0x56, 0x81, 0x98, 0xA9, 0x99, 0x9A, 0x65,
+    0x82, 0x89, 0xA9, 0x99, 0x9A, 0x74, 0x02, 0x99, 0x99, 0x9A, 0x9A, 0x73, 0x04, 0x98, 0x99, 0x9A,
+    0xAA, 0x72, 0x05, 0x98, 0x99, 0x99, 0xA9, 0x71, 0x13, 0x99, 0xA8, 0x9A, 0xAA, 0x70, 0x15, 0x98,
+    0x99, 0x99, 0xA9, 0x68, 0x15, 0x98, 0x89, 0x9A, 0xA9, 0x48, 0x27, 0x98, 0x98, 0x9A, 0xA9, 0x49,
+    0x27, 0x90, 0x99, 0x99, 0xAA, 0x39, 0x47, 0x90, 0x98, 0xA9, 0xA9, 0x29, 0x47, 0x80, 0x99, 0x99,
+    0x9A, 0x1A, 0x47, 0x91, 0x89, 0x9A, 0xA9, 0x1A, 0x47, 0x81, 0x99, 0xA9, 0x99, 0x0B, 0x47, 0x81,
+    0x99, 0x99, 0xA9, 0x8A, 0x56, 0x82, 0x99, 0xA9, 0x99, 0x9A, 0x65, 0x02, 0x8A, 0xA9, 0x99, 0x9B,
+    0x74, 0x83, 0x89, 0xA9, 0x99, 0x9B, 0x73, 0x05, 0x99, 0x98, 0x99, 0x9A, 0x71, 0x13, 0x99, 0x99,
+    0x9A, 0xAB, 0x71, 0x06, 0x88, 0x99, 0x99, 0x99, 0x68, 0x14, 0x98, 0x99, 0x99, 0xAA, 0x68, 0x25,
+    0x89, 0x99, 0x9A, 0xA9, 0x59, 0x26, 0x98, 0x98, 0x9A, 0xB9, 0x48, 0x27, 0x90, 0x99, 0xA9, 0xA9,
+    0x39, 0x57, 0x90, 0x89, 0x99, 0xA9, 0x19, 0x37, 0x91, 0x99, 0x9A, 0xAA, 0x2A, 0x57, 0x91, 0x89,
+    0xA9, 0x99, 0x0A, 0x47, 0x81, 0x99, 0xA9, 0x99, 0x0A, 0x46, 0x82, 0x99, 0x9A, 0x9A, 0x8B, 0x66,
+    0x82, 0x99, 0x99, 0xA9, 0x8A, 0x74, 0x02, 0x99, 0xA9, 0x99, 0x9A, 0x73, 0x04, 0x89, 0xA9, 0x99,
+    0xAA, 0x73, 0x14, 0x99, 0x99, 0x9A, 0x9A, 0x71, 0x14, 0x99, 0xA8, 0x99, 0xAA, 0x71, 0x14, 0x98,
+    0x99, 0x9A, 0xAA, 0x70, 0x14, 0x98, 0xA8, 0x99, 0xAA, 0x68, 0x25, 0x98, 0x99, 0x9A, 0xB9, 0x58,
+    0x26, 0x90, 0x99, 0x9A, 0xAA, 0x49, 0x37, 0x98, 0x98, 0x9A, 0xAA, 0x39, 0x57, 0x90, 0x98, 0x99,
+    0xA9, 0x19, 0x47, 0x90, 0x98, 0x99, 0xA9, 0x09, 0x47, 0x80, 0x89, 0xA9, 0x99, 0x0A, 0x56, 0x81,
+    0x99, 0x99, 0xA9, 0x0A, 0x46, 0x82, 0x99, 0x9A, 0x9A, 0x8B, 0x66, 0x01, 0x99, 0x99, 0x99, 0x9A,
+    0x74, 0x82, 0x98, 0x99, 0x9A, 0xA9, 0x73, 0x04, 0x99, 0x98, 0x9A, 0x9A, 0x72, 0x04, 0x98, 0x99,
+    0xA9, 0xA9, 0x71, 0x14, 0x99, 0xA8, 0x99, 0x9A, 0x70, 0x14, 0x89, 0x99, 0x9A, 0xA9, 0x78, 0x14,
+    0x98, 0x99, 0x99, 0xAA, 0x68, 0x25, 0x98, 0x99, 0x9A, 0xA9, 0x59, 0x26, 0x98, 0x98, 0x9A, 0xA9,
+    0x39, 0x57, 0x88, 0x89, 0xA9, 0xA8, 0x29, 0x37, 0x90, 0x99, 0xA9, 0xA9, 0x2A, 0x57, 0x91, 0x89,
+    0x9A, 0x99, 0x1A, 0x47, 0x80, 0x99, 0x99, 0x99, 0x0A, 0x56, 0x81, 0x99, 0x99, 0xA9, 0x8A, 0x56,
+    0x81, 0x98, 0xA9, 0x99, 0x8A, 0x65, 0x82, 0x99, 0x99, 0xA9, 0x8A, 0x73, 0x04, 0x99, 0x99, 0x99,
+    0xAA, 0x73, 0x05, 0x99, 0x98, 0x99, 0x9A, 0x72, 0x03, 0x99, 0xA8, 0x9A, 0xAA, 0x72, 0x15, 0x99,
+    0x98, 0x9A, 0xA9, 0x70, 0x14, 0x99, 0x98, 0x9A, 0xA9, 0x60, 0x24, 0x98, 0xA9, 0xA9, 0xB9, 0x68,
+    0x16, 0x90, 0x99, 0x99, 0xA9, 0x49, 0x27, 0x88, 0x99, 0xA9, 0xA9, 0x49, 0x36, 0x90, 0x99, 0xAA,
+    0xB9, 0x39, 0x67, 0x90, 0x98, 0x99, 0xA8, 0x19, 0x46, 0x80, 0x99, 0x99, 0xA9, 0x1A, 0x47, 0x91,
+    0x89, 0xA9, 0x99, 0x0B, 0x47, 0x81, 0x99, 0x99, 0xA9, 0x8A, 0x56, 0x82, 0x99, 0xA9, 0x99, 0x9A,
+    0x65, 0x82, 0x89, 0xA9, 0x99, 0xAA, 0x65, 0x02, 0x99, 0x99, 0x9A, 0xAA, 0x73, 0x05, 0x89, 0x99,
+    0x99, 0x9A, 0x72, 0x13, 0x99, 0xA9, 0x9A, 0xAA, 0x71, 0x15, 0x98, 0x99, 0x9A, 0xA9, 0x70, 0x14,
+    0x98, 0x99, 0x9A, 0xA9, 0x68, 0x15, 0x98, 0x98, 0x9A, 0xA9, 0x58, 0x26, 0x98, 0x99, 0x99, 0xAA,
+    0x59, 0x26, 0x88, 0x99, 0x9A, 0xA9, 0x39, 0x47, 0x90, 0x98, 0x9A, 0xA9, 0x3A, 0x47, 0x91, 0x99,
+    0xA9, 0xA9, 0x2A, 0x47, 0x91, 0x89, 0xA9, 0xA9, 0x1A, 0x47, 0x81, 0x99, 0xA9, 0xA9, 0x0A, 0x47,
+    0x81, 0x89, 0x9A, 0xA9, 0x8A, 0x56, 0x82, 0x99, 0xA9, 0x99, 0x8B, 0x65, 0x02, 0x99, 0xA9, 0xA9,
+    0x9A, 0x74, 0x83, 0x89, 0xA9, 0xA9, 0x9A, 0x72, 0x05, 0x98, 0x99, 0x99, 0x9A, 0x71, 0x04, 0x98,
+    0x99, 0x99, 0x9A, 0x70, 0x04, 0x98, 0x98, 0x9A, 0xA9, 0x70, 0x23, 0xA8, 0x99, 0xAA, 0xB9, 0x78,
+    0x25, 0x98, 0x99, 0x9A, 0xB9, 0x58, 0x17, 0x90, 0x89, 0x9A, 0x99, 0x39, 0x37, 0x90, 0x99, 0x9A,
+    0xAA, 0x4A, 0x37, 0x90, 0x99, 0xA9, 0xB9, 0x3A, 0x67, 0x80, 0x99, 0x99, 0xA8, 0x19, 0x46, 0x91,
+    0x99, 0x99, 0xA9, 0x0A, 0x47, 0x81, 0x99, 0x99, 0x9A, 0x0A, 0x56, 0x81, 0x99, 0xA8, 0xA9, 0x8A,
+    0x56, 0x82, 0x99, 0x99, 0x9A, 0x9A, 0x65, 0x82, 0x89, 0xA9, 0x99, 0xAA, 0x74, 0x02, 0x89, 0xA9,
+    0x99, 0xAA, 0x73, 0x05, 0x99, 0x98, 0x99, 0x9A, 0x71, 0x13, 0x99, 0x99, 0x9A, 0xBA, 0x71, 0x06,
+    0x98, 0x98, 0x99, 0x99, 0x50, 0x15, 0x98, 0x99, 0x99, 0xAA, 0x68, 0x15, 0xA0, 0x98, 0x9A, 0xA9,
+    0x48, 0x27, 0x88, 0x99, 0x9A, 0xA9, 0x49, 0x27, 0x90, 0x99, 0x99, 0xAA, 0x39, 0x47, 0x80, 0x99,
+    0xA9, 0xA9, 0x3A, 0x47, 0x91, 0x99, 0xA9, 0x99, 0x1A, 0x47, 0x91, 0x89, 0xA9, 0xA9, 0x0A, 0x47,
+    0x81, 0x99, 0x99, 0xA9, 0x8A, 0x47, 0x92, 0x89, 0xA9, 0xA9, 0x8A, 0x75, 0x01, 0x99, 0x99, 0x99,
+    0x8A, 0x64, 0x02, 0x99, 0xA9, 0x99, 0x9B, 0x74, 0x83, 0x98, 0xA9, 0xA9, 0x9A, 0x72, 0x05, 0x98,
+    0x99, 0x99, 0xA9, 0x71, 0x04, 0x98, 0x99, 0x99, 0x9A, 0x70, 0x23, 0x99, 0xA9, 0xA9, 0xBA, 0x70,
+    0x16, 0x98, 0x89, 0x99, 0x9A, 0x58, 0x25, 0xA8, 0x98, 0x9A, 0xB9, 0x58, 0x26, 0x98, 0x98, 0x9A,
+    0xB9, 0x49, 0x37, 0x98, 0x98, 0x9A, 0xAA, 0x39, 0x57, 0x90, 0x89, 0x99, 0xA9, 0x19, 0x37, 0x91,
+    0x99, 0xA9, 0xB9, 0x1A, 0x67, 0x80, 0x98, 0x99, 0x99, 0x09, 0x55, 0x81, 0x99, 0x99, 0x9A, 0x8A,
+    0x56, 0x92, 0x89, 0xA9, 0x99, 0x9A, 0x56, 0x82, 0x99, 0x99, 0x9A, 0x9A, 0x74, 0x02, 0x99, 0xA8,
+    0x99, 0x9B, 0x73, 0x05, 0x99, 0x98, 0x99, 0x9A, 0x72, 0x03, 0xA8, 0xA8, 0x9A, 0xAA, 0x71, 0x06,
+    0x98, 0x98, 0x99, 0xA9, 0x51, 0x15, 0x98, 0x99, 0x9A, 0xA9, 0x60, 0x15, 0x98, 0x99, 0x99, 0xAA,
+    0x68, 0x15, 0x90, 0x99, 0xA9, 0xA9, 0x59, 0x26, 0x98, 0x98, 0x9A, 0xA9, 0x39, 0x47, 0x90, 0x89,
+    0x9A, 0xA9, 0x29, 0x47, 0x91, 0x99, 0xA9, 0xA9, 0x19, 0x57, 0x80, 0x99, 0x99, 0x99, 0x09, 0x46,
+    0x81, 0x99, 0xA9, 0xA9, 0x0A, 0x47, 0x81, 0x99, 0x99, 0xA9, 0x8A, 0x56, 0x82, 0x99, 0xA9, 0x99,
+    0x9A, 0x65, 0x02, 0x99, 0xA9, 0xA9, 0x9A, 0x74, 0x83, 0x89, 0xA9, 0xA9, 0x9A, 0x73, 0x05, 0x89,
+    0x99, 0x99, 0x9A, 0x71, 0x04, 0x89, 0x99, 0x99, 0x9A, 0x70, 0x04, 0x98, 0x89, 0x9A, 0xA9, 0x70,
+    0x23, 0x99, 0x99, 0xAA, 0xAA, 0x78, 0x25, 0x98, 0x99, 0x9A, 0xA9, 0x69, 0x25, 0x98, 0x99, 0xA9,
+    0xA9, 0x59, 0x26, 0x90, 0x99, 0x9A, 0xB9, 0x49, 0x27, 0x90, 0x98, 0x9A, 0xA9, 0x2A, 0x57, 0x80,
+    0x99, 0x99, 0x99, 0x1A, 0x37, 0x91, 0x99, 0xA9, 0xA9, 0x1B, 0x67, 0x80, 0x98, 0x99, 0xA8, 0x89,
+    0x46, 0x81, 0x99, 0x99, 0xA9, 0x8A, 0x56, 0x01, 0x99, 0xA9, 0x99, 0x9A, 0x65, 0x82, 0x89, 0xA9,
+    0x99, 0x9A, 0x73, 0x85, 0x98, 0x98, 0x8A, 0x9A, 0x72, 0x03, 0x99, 0x99, 0x9A, 0xAA, 0x72, 0x15,
+    0x99, 0xA8, 0x99, 0xA9, 0x71, 0x04, 0x98, 0x99, 0x99, 0xA9, 0x60, 0x15, 0x98, 0x99, 0x99, 0xAA,
+    0x68, 0x15, 0x98, 0x98, 0xA9, 0xA9, 0x58, 0x26, 0x98, 0x99, 0x99, 0xAA, 0x48, 0x27, 0x88, 0x99,
+    0xA9, 0xA9, 0x39, 0x47, 0x90, 0x98, 0x9A, 0xA9, 0x29, 0x47, 0x80, 0x99, 0xA9, 0x99, 0x1A, 0x47,
+    0x91, 0x89, 0xA9, 0xA9, 0x1A, 0x47, 0x81, 0x99, 0xA9, 0xA9, 0x0A, 0x47, 0x81, 0x99, 0xA8, 0xA9,
+    0x8A, 0x56, 0x82, 0x99, 0xA9, 0x99, 0x9A, 0x65, 0x02, 0x8A, 0xA9, 0x99, 0x9B, 0x74, 0x83, 0x89,
+    0xA9, 0xA9, 0x9A, 0x73, 0x05, 0x89, 0x99, 0x99, 0xAA, 0x72, 0x13, 0x99, 0x99, 0xAA, 0xAA, 0x71,
+    0x06, 0x88, 0x99, 0x99, 0xA9, 0x60, 0x14, 0x98, 0x99, 0x99, 0xAA, 0x68, 0x25, 0x98, 0x99, 0x9A,
+    0xB9, 0x58, 0x26, 0x98, 0x98, 0x9A, 0xB9, 0x48, 0x27, 0x90, 0x99, 0xA9, 0xA9, 0x39, 0x57, 0x90,
+    0x89, 0x99, 0xA9, 0x19, 0x37, 0x91, 0x99, 0x9A, 0xAA, 0x2A, 0x57, 0x91, 0x98, 0xA9, 0x99, 0x0A,
+    0x47, 0x81, 0x8A, 0xA9, 0x99, 0x8A, 0x47, 0x81, 0x99, 0x99, 0x99, 0x8B, 0x56, 0x01, 0x99, 0x99,
+    0x9A, 0x9A, 0x65, 0x82, 0x89, 0xA9, 0x99, 0x9A, 0x73, 0x04, 0x89, 0xA9, 0x99, 0xAA, 0x73, 0x14,
+    0x99, 0x99, 0x9A, 0xAA, 0x72, 0x05, 0x98, 0x99, 0x89, 0x9A, 0x60, 0x14, 0x98, 0x99, 0x9A, 0xAA,
+    0x70, 0x14, 0x98, 0x99, 0x99, 0xAA, 0x68, 0x25, 0x98, 0x99, 0x9A, 0xB9, 0x58, 0x26, 0x90, 0x99,
+    0x9A, 0xAA, 0x49, 0x37, 0x88, 0x99, 0x9A, 0xAA, 0x39, 0x57, 0x90, 0x98, 0x99, 0xA9, 0x2A, 0x47,
+    0x90, 0x98, 0x99, 0xA9, 0x1A, 0x47, 0x80, 0x89, 0xA9, 0x99, 0x0A, 0x56, 0x81, 0x99, 0x99, 0xA9,
+    0x0A, 0x46, 0x82, 0x99, 0xA9, 0x9A, 0x8B, 0x66, 0x01, 0x99, 0x99, 0x99, 0x9A, 0x74, 0x82, 0x98,
+    0x99, 0x9A, 0x9A, 0x73, 0x04, 0x99, 0x98, 0x9A, 0x9A, 0x72, 0x04, 0x98, 0x99, 0xA9, 0xA9, 0x71,
+    0x14, 0x99, 0xA8, 0x99, 0xAA, 0x71, 0x14, 0x98, 0x99, 0x9A, 0xA9, 0x78, 0x14, 0x98, 0x99, 0x99,
+    0xAA, 0x68, 0x25, 0x98, 0x99, 0x9A, 0xA9, 0x59, 0x26, 0x98, 0x98, 0x9A, 0xA9, 0x4A, 0x27, 0x90,
+    0x98, 0x9A, 0xA9, 0x3A, 0x57, 0x90, 0x89, 0x99, 0xA9, 0x19, 0x37, 0x91, 0x99, 0xA9, 0xA9, 0x1B,
+    0x67, 0x80, 0x89, 0x99, 0x99, 0x09, 0x55, 0x81, 0x99, 0x99, 0xA9, 0x8A, 0x56, 0x81, 0x98, 0xA9,
+    0x99, 0x8A, 0x74, 0x82, 0x98, 0xA9, 0x99, 0x9A, 0x74, 0x02, 0x99, 0x99, 0xA9, 0x9A, 0x73, 0x05,
+    0x99, 0x98, 0x99, 0x9A, 0x72, 0x03, 0x99, 0xA8, 0x9A, 0xAA, 0x71, 0x15, 0x89, 0x99, 0x99, 0xAA,
+    0x70, 0x14, 0x89, 0x99, 0xA9, 0xA9, 0x60, 0x24, 0x98, 0xA9, 0xA9, 0xB9, 0x68, 0x26, 0x98, 0x99,
+    0x99, 0xAA, 0x48, 0x27, 0x88, 0x99, 0xA9, 0xA9, 0x49, 0x36, 0x90, 0x99, 0xAA, 0xB9, 0x4A, 0x37,
+    0x91, 0x8A, 0xAA, 0xB9, 0x2A, 0x67, 0x80, 0x89, 0x99, 0x99, 0x1A, 0x46, 0x91, 0x89, 0x9A, 0xA9,
+    0x0A, 0x47, 0x81, 0x99, 0x99, 0xA9, 0x8A, 0x56, 0x82, 0x99, 0xA9, 0x99, 0x8B, 0x65, 0x82, 0x89,
+    0xA9, 0x99, 0x9B, 0x65, 0x02, 0x99, 0x99, 0x9A, 0xAA, 0x73, 0x05, 0x89, 0x99, 0x99, 0x9A, 0x72,
+    0x13, 0x99, 0xA9, 0x9A, 0xAA, 0x71, 0x06, 0x98, 0x98, 0x99, 0xA9, 0x60, 0x14, 0x98, 0x99, 0xA9,
+    0xA9, 0x68, 0x25, 0x99, 0x98, 0x9A, 0xA9, 0x58, 0x26, 0x98, 0x99, 0x99, 0xAA, 0x59, 0x26, 0x88,
+    0x99, 0x9A, 0xA9, 0x39, 0x47, 0x90, 0x98, 0x9A, 0xA9, 0x3A, 0x47, 0x91, 0x99, 0xA9, 0xA9, 0x2A,
+    0x47, 0x91, 0x89, 0xA9, 0xA9, 0x0A, 0x57, 0x91, 0x89, 0x99, 0x99, 0x0A, 0x55, 0x92, 0x89, 0x9A,
+    0xA9, 0x8A, 0x56, 0x82, 0x99, 0xA9, 0x99, 0x8B, 0x65, 0x02, 0x99, 0xA9, 0xA9, 0x9A, 0x74, 0x03,
+    0x8A, 0xA9, 0xA9, 0xAA, 0x73, 0x05, 0x98, 0x99, 0x99, 0x9A, 0x71, 0x04, 0x98, 0x99, 0x99, 0x9A,
+    0x70, 0x14, 0x99, 0x98, 0x9A, 0xA9, 0x60, 0x15, 0x98, 0x99, 0x99, 0xAA, 0x50, 0x16, 0x88, 0x99,
+    0x99, 0xAA, 0x58, 0x35, 0x98, 0x9A, 0xA9, 0xB9, 0x59, 0x27, 0x90, 0x99, 0xA9, 0xA9, 0x39, 0x47,
+    0x90, 0x98, 0xA9, 0xA9, 0x29, 0x47, 0x80, 0x99, 0x99, 0x9A, 0x1A, 0x47, 0x91, 0x89, 0x9A, 0xA9,
+    0x1A, 0x47, 0x81, 0x99, 0xA9, 0x99, 0x0B, 0x56, 0x92, 0x89, 0xA9, 0x99, 0x8B, 0x56, 0x82, 0x99,
+    0x99, 0x9A, 0x9A, 0x65, 0x82, 0x98, 0xA9, 0x99, 0xAA, 0x74, 0x02, 0x89, 0xA9, 0x99, 0xAA, 0x73,
+    0x05, 0x99, 0x98, 0x99, 0x9A, 0x71, 0x13, 0x99, 0x99, 0x9A, 0xBA, 0x71, 0x15, 0x98, 0x99, 0x99,
+    0xAA, 0x60, 0x15, 0x98, 0x89, 0x9A, 0xB9, 0x50, 0x26, 0x98, 0x99, 0xA9, 0xA9, 0x59, 0x26, 0x98,
+    0x98, 0x9A, 0xA9, 0x49, 0x27, 0x90, 0x99, 0xA9, 0xA9, 0x39, 0x47, 0x80, 0x99, 0xA9, 0xA9, 0x2A,
+    0x57, 0x80, 0x99, 0x99, 0x99, 0x1A, 0x37, 0x81, 0x9A, 0xA9, 0xA9, 0x0A, 0x57, 0x81, 0x99, 0x99,
+    0x99, 0x0B, 0x56, 0x81, 0x99, 0xA8, 0x99, 0x8A, 0x65, 0x01, 0x99, 0x99, 0xA9, 0x8A, 0x74, 0x82,
+    0x98, 0x99, 0x9A, 0x9A, 0x73, 0x04, 0x89, 0xA9, 0x99, 0x9A, 0x72, 0x04, 0x98, 0x99, 0x9A, 0xA9,
+    0x71, 0x14, 0x99, 0x98, 0x9A, 0xAA, 0x71, 0x14, 0x98, 0x99, 0x9A, 0xAA, 0x70, 0x14, 0x98, 0x99,
+    0x99, 0xAA, 0x68, 0x25, 0x98, 0x99, 0x9A, 0xA9, 0x59, 0x26, 0xA0, 0x98, 0x9A, 0xB9, 0x49, 0x37,
+    0x98, 0x98, 0x9A, 0xAA, 0x39, 0x57, 0x90, 0x98, 0x99, 0xA9, 0x19, 0x37, 0x91, 0x99, 0xA9, 0xAA,
+    0x1A, 0x67, 0x80, 0x98, 0x99, 0x99, 0x0A, 0x46, 0x81, 0x99, 0x99, 0xA9, 0x8A, 0x56, 0x82, 0x8A,
+    0xA9, 0x99, 0x9A, 0x65, 0x82, 0x89, 0xA9, 0x99, 0x8B, 0x74, 0x02, 0x99, 0x99, 0x9A, 0x9A, 0x73,
+    0x05, 0x99, 0x98, 0x99, 0x9A, 0x71, 0x13, 0x99, 0x99, 0xAA, 0xAA, 0x72, 0x15, 0x99, 0x98, 0x9A,
+    0xA9, 0x70, 0x14, 0x98, 0x99, 0x9A, 0xA9, 0x78, 0x14, 0x98, 0x99, 0x99, 0xB9, 0x68, 0x15, 0x90,
+    0x99, 0xA9, 0xA9, 0x59, 0x26, 0x98, 0x98, 0x9A, 0xA9, 0x39, 0x47, 0x90, 0x98, 0x9A, 0xA9, 0x3A,
+    0x47, 0x91, 0x99, 0xA9, 0xA9, 0x2A, 0x57, 0x80, 0x99, 0x99, 0x99, 0x09, 0x46, 0x81, 0x99, 0xA9,
+    0xA9, 0x0A, 0x47, 0x81, 0x89, 0x9A, 0xA9, 0x8A, 0x56, 0x82, 0x99, 0xA9, 0x99, 0x8B, 0x65, 0x02,
+    0x99, 0xA9, 0xA9, 0x9A, 0x74, 0x83, 0x89, 0xA9, 0xA9, 0x9A, 0x73, 0x05, 0x89, 0x99, 0x99, 0xAA,
+    0x72, 0x04, 0x89, 0x99, 0x99, 0xAA, 0x71, 0x04, 0x98, 0x98, 0x9A, 0xA9, 0x70, 0x23, 0x99, 0x99,
+    0xAA, 0xAA, 0x78, 0x25, 0x98, 0x99, 0x9A, 0xB9, 0x68, 0x25, 0x98, 0x99, 0xA9, 0xA9, 0x59, 0x26,
+    0x90, 0x99, 0x9A, 0xB9, 0x49, 0x27, 0x80, 0x99, 0x9A, 0xB9, 0x29, 0x57, 0x80, 0x99, 0x99, 0x99,
+    0x1A, 0x37, 0x81, 0x9A, 0xA9, 0xA9, 0x1B, 0x67, 0x80, 0x98, 0x99, 0x99, 0x89, 0x46, 0x81, 0x99,
+    0x99, 0xA9, 0x8A, 0x56, 0x01, 0x99, 0xA9, 0x99, 0x9A, 0x65, 0x82, 0x89, 0xA9, 0x99, 0x9A, 0x73,
+    0x85, 0x98, 0xA8, 0x89, 0x9A, 0x72, 0x03, 0x99, 0xA8, 0x9A, 0xAA, 0x72, 0x15, 0x99, 0xA8, 0x99,
+    0xA9, 0x70, 0x14, 0x99, 0x98, 0x9A, 0xA9, 0x70, 0x14, 0x98, 0x99, 0x9A, 0xA9, 0x68, 0x15, 0x98,
+    0x98, 0x9A, 0xA9, 0x58, 0x26, 0x98, 0x99, 0x99, 0xAA, 0x48, 0x27, 0x90, 0x99, 0xA9, 0xA9, 0x39,
+    0x47, 0x90, 0x98, 0x9A, 0xA9, 0x3A, 0x47, 0x91, 0x99, 0xA9, 0xA9, 0x2A, 0x47, 0x91, 0x89, 0xA9,
+    0xA9, 0x0A, 0x47, 0x81, 0x99, 0x99, 0xA9, 0x8A, 0x47, 0x92, 0x89, 0xA9, 0xA9, 0x8A, 0x56, 0x82,
+    0x99, 0xA9, 0x99, 0x9A, 0x65, 0x02, 0x99, 0xA9, 0xA9, 0x9A, 0x74, 0x83, 0x89, 0xA9, 0xA9, 0x9A,
+    0x72, 0x05, 0x98, 0x99, 0x99, 0x9A, 0x71, 0x04, 0x98, 0x99, 0x99, 0xA9, 0x70, 0x04, 0x98, 0x98,
+    0x9A, 0xA9, 0x60, 0x15, 0x98, 0x99, 0x99, 0xA9, 0x58, 0x16, 0x98, 0x98, 0x99, 0xAA, 0x58, 0x25,
+    0x90, 0xA9, 0xA9, 0xB9, 0x59, 0x27, 0x88, 0x99, 0x99, 0xA9, 0x3A, 0x47, 0x90, 0x89, 0xA9, 0x99,
+    0x2A, 0x47, 0x80, 0x99, 0x99, 0x9A, 0x1A, 0x47, 0x91, 0x89, 0x9A, 0xA9, 0x1A, 0x47, 0x91, 0x98,
+    0x99, 0x98, 0x8A, 0x46, 0x91, 0xBB, 0xAC, 0x48, 0x44, 0x22, 0xA1, 0xDB, 0xBB, 0xCC, 0x0B, 0x77,
+    0x02, 0x98, 0x99, 0xA9, 0x9A, 0x99, 0x52, 0x36, 0x92, 0xAA, 0xAA, 0x89, 0xA8, 0xAD, 0x73, 0x15,
+    0x98, 0x09, 0x98, 0xAA, 0xBA, 0x1A, 0x57, 0x12, 0x90, 0xA9, 0xAA, 0xAA, 0xAC, 0x70, 0x35, 0x80,
+    0x9A, 0x99, 0xAA, 0x99, 0x08, 0x55, 0x14, 0x98, 0x9A, 0x9A, 0x80, 0xBB, 0x2B, 0x77, 0x01, 0x89,
+    0x08, 0x9A, 0xAA, 0xBA, 0x60, 0x35, 0x82, 0x99, 0xAA, 0xAB, 0xCA, 0x0B, 0x67, 0x02, 0x98, 0x89,
+    0x9A, 0x8A, 0x98, 0x38, 0x47, 0x82, 0x9A, 0xA9, 0x88, 0xB8, 0xAC, 0x71, 0x24, 0x90, 0x88, 0xA8,
+    0xBA, 0xCA, 0x8A, 0x65, 0x14, 0x90, 0x8A, 0xAA, 0xA9, 0xBA, 0x60, 0x36, 0x81, 0x9A, 0x99, 0xAA,
+    0x89, 0xA8, 0x72, 0x16, 0x90, 0x99, 0x89, 0x98, 0xB9, 0x0B, 0x56, 0x03, 0x88, 0x98, 0xBA, 0xBA,
+    0xBC, 0x48, 0x57, 0x82, 0x99, 0x99, 0xA9, 0xA9, 0x8A, 0x46, 0x14, 0xA0, 0x99, 0xA9, 0x8A, 0x98,
+    0x0A, 0x57, 0x02, 0x99, 0x99, 0x90, 0xAA, 0xCB, 0x58, 0x26, 0x81, 0x08, 0xA9, 0xAB, 0xCA, 0xAA,
+    0x74, 0x24, 0xA0, 0x89, 0x9A, 0xAA, 0xAA, 0x50, 0x45, 0x82, 0x99, 0x9A, 0xAA, 0x08, 0xBA, 0x70,
+    0x35, 0x90, 0x9A, 0x80, 0xB9, 0xCA, 0x9B, 0x65, 0x13, 0x80, 0x98, 0xAB, 0xAB, 0xBC, 0x3A, 0x77,
+    0x02, 0x99, 0x98, 0x9A, 0xA9, 0x88, 0x72, 0x33, 0x90, 0xAA, 0xAA, 0x0A, 0xB8, 0x8D, 0x55, 0x13,
+    0xA8, 0x89, 0xA8, 0xBA, 0xBC, 0x4A, 0x47, 0x11, 0x98, 0xA9, 0xAA, 0xAA, 0x9C, 0x71, 0x26, 0x88,
+    0x99, 0x99, 0x99, 0x99, 0x28, 0x55, 0x12, 0xA9, 0xA9, 0x8A, 0x88, 0xDB, 0x38, 0x47, 0x91, 0x89,
+    0x80, 0xAA, 0xBA, 0xAB, 0x73, 0x26, 0x80, 0x98, 0x9A, 0xAA, 0xBA, 0x2B, 0x77, 0x02, 0x99, 0x98,
+    0xA9, 0x89, 0x88, 0x30, 0x47, 0x80, 0x99, 0x9A, 0x88, 0xB8, 0x9B, 0x73, 0x16, 0x98, 0x08, 0xA8,
+    0x9A, 0xBA, 0x2B, 0x57, 0x12, 0x98, 0x99, 0xAA, 0xAA, 0xAC, 0x72, 0x25, 0x90, 0x99, 0xA8, 0x9A,
+    0x88, 0x89, 0x73, 0x15, 0x98, 0x8A, 0x89, 0x98, 0xBB, 0x2A, 0x67, 0x01, 0x89, 0x90, 0xA9, 0xAA,
+    0xAB, 0x70, 0x35, 0x81, 0xA9, 0xA9, 0xAA, 0xBA, 0x2B, 0x77, 0x02, 0x98, 0x99, 0xA9, 0x09, 0x98,
+    0x29, 0x47, 0x01, 0x9A, 0x89, 0x98, 0xB9, 0xAC, 0x71, 0x24, 0x90, 0x80, 0xB9, 0xAA, 0xCA, 0x8A,
+    0x75, 0x13, 0x98, 0x99, 0xAA, 0xA9, 0x9B, 0x61, 0x26, 0x81, 0x99, 0xA9, 0xAA, 0x80, 0xAA, 0x72,
+    0x26, 0x98, 0x99, 0x88, 0xA8, 0xBA, 0x0B, 0x57, 0x02, 0x80, 0x99, 0xAA, 0xBA, 0xBB, 0x69, 0x47,
+    0x81, 0x99, 0xA8, 0x99, 0xAA, 0x08, 0x64, 0x23, 0x98, 0xAA, 0xAA, 0x89, 0xB8, 0x1C, 0x57, 0x02,
+    0xA9, 0x88, 0x98, 0xBA, 0xBB, 0x78, 0x25, 0x82, 0x88, 0xAA, 0xBA, 0xBB, 0x9C, 0x75, 0x14, 0x98,
+    0x89, 0x9A, 0xA9, 0x89, 0x20, 0x47, 0x01, 0x99, 0x9A, 0x8A, 0x88, 0xBB, 0x70, 0x25, 0x91, 0x8A,
+    0x90, 0xAA, 0xBB, 0x8C, 0x74, 0x23, 0x80, 0x9A, 0xBA, 0xAA, 0xBC, 0x49, 0x57, 0x01, 0x99, 0x99,
+    0xA9, 0x89, 0x09, 0x61, 0x25, 0x88, 0x9A, 0x9A, 0x08, 0xB9, 0x8C, 0x55, 0x13, 0x99, 0x88, 0xA9,
+    0xAB, 0xBC, 0x4A, 0x47, 0x02, 0x98, 0x9A, 0xAA, 0xAA, 0x9C, 0x73, 0x16, 0x88, 0x99, 0x98, 0x9A,
+    0x88, 0x08, 0x55, 0x12, 0xA9, 0xA9, 0x89, 0x98, 0xCB, 0x49, 0x37, 0x91, 0x88, 0x98, 0xBA, 0xBA,
+    0xAC, 0x73, 0x35, 0x80, 0x9A, 0xA9, 0xAA, 0xCA, 0x39, 0x57, 0x01, 0x98, 0x99, 0xAA, 0x09, 0x98,
+    0x48, 0x37, 0x80, 0x9A, 0x99, 0x88, 0xBA, 0x9C, 0x73, 0x15, 0x88, 0x88, 0xA9, 0x9A, 0xBB, 0x1A,
+    0x77, 0x02, 0x98, 0x99, 0x99, 0x9A, 0x9A, 0x72, 0x24, 0x80, 0x9A, 0xA9, 0x9A, 0x88, 0x8A, 0x74,
+    0x14, 0xA8, 0x99, 0x88, 0xA8, 0xBB, 0x3B, 0x67, 0x01, 0x08, 0x99, 0xAA, 0xB9, 0xAB, 0x70, 0x27,
+    0x80, 0x99, 0xA8, 0x99, 0x9A, 0x29, 0x65, 0x12, 0x99, 0x9A, 0xA9, 0x09, 0xA9, 0x4A, 0x47, 0x81,
+    0xA9, 0x08, 0x99, 0xBA, 0xAB, 0x71, 0x26, 0x80, 0x88, 0x9A, 0xAA, 0xBA, 0x8B, 0x67, 0x13, 0x99,
+    0x99, 0xA9, 0xAA, 0x99, 0x61, 0x35, 0x81, 0xAA, 0xA9, 0x9A, 0x90, 0xAC, 0x73, 0x15, 0x90, 0x0A,
+    0x98, 0xA9, 0xBB, 0x1B, 0x57, 0x12, 0x80, 0xA9, 0xAA, 0xAB, 0xBC, 0x60, 0x27, 0x81, 0x99, 0x99,
+    0x9A, 0x9A, 0x08, 0x64, 0x23, 0xA8, 0xA9, 0xAA, 0x88, 0xCA, 0x2B, 0x57, 0x02, 0x99, 0x08, 0xB9,
+    0xAA, 0xBC, 0x50, 0x36, 0x01, 0xA8, 0xA9, 0xAB, 0xCA, 0x8B, 0x66, 0x13, 0x98, 0x99, 0xAA, 0x9A,
+    0x89, 0x38, 0x67, 0x01, 0xA9, 0x99, 0x88, 0x98, 0xBB, 0x61, 0x35, 0x90, 0x89, 0xA0, 0xAB, 0xBB,
+    0x8D, 0x64, 0x14, 0x80, 0xA9, 0xA9, 0xAA, 0xBA, 0x79, 0x35, 0x82, 0x9A, 0xA9, 0xAA, 0x8A, 0x98,
+    0x72, 0x26, 0x88, 0x9A, 0x89, 0x88, 0xBA, 0x0C, 0x74, 0x02, 0x88, 0x88, 0xB9, 0xA9, 0xCB, 0x39,
+    0x57, 0x02, 0x99, 0x99, 0x9A, 0xAA, 0x8B, 0x65, 0x23, 0x90, 0xAA, 0xB9, 0x9A, 0x88, 0x0A, 0x67,
+    0x12, 0xA9, 0x99, 0x88, 0xA9, 0xCB, 0x48, 0x36, 0x82, 0x09, 0xA9, 0xBB, 0xCB, 0xAB, 0x73, 0x27,
+    0x80, 0x99, 0xA9, 0x99, 0xAA, 0x38, 0x57, 0x01, 0x99, 0x99, 0xA9, 0x88, 0xA8, 0x58, 0x36, 0x80,
+    0xAA, 0x88, 0xA8, 0xCA, 0x9B, 0x74, 0x13, 0x80, 0x98, 0xAA, 0xAB, 0xDB, 0x19, 0x57, 0x02, 0x98,
+    0xA9, 0xA9, 0xA9, 0x8A, 0x73, 0x34, 0x90, 0x9A, 0xAA, 0x8A, 0xA0, 0x9B, 0x66, 0x23, 0xA9, 0x89,
+    0x98, 0xAB, 0xBC, 0x3A, 0x67, 0x01, 0x80, 0xA9, 0xA9, 0xAA, 0xAB, 0x71, 0x27, 0x90, 0x89, 0x99,
+    0xA9, 0x99, 0x28, 0x45, 0x04, 0xA8, 0x99, 0x9A, 0x88, 0xC9, 0x39, 0x47, 0x81, 0x99, 0x80, 0xB9,
+    0xAA, 0xAC, 0x62, 0x25, 0x81, 0x98, 0xAA, 0xAB, 0xCA, 0x0A, 0x67, 0x02, 0x98, 0x99, 0xA9, 0x99,
+    0x89, 0x41, 0x36, 0x81, 0xAA, 0xA9, 0x89, 0xB8, 0xAC, 0x73, 0x25, 0x98, 0x09, 0x98, 0xAB, 0xCA,
+    0x0A, 0x56, 0x13, 0x98, 0x99, 0xBA, 0xAA, 0xAC, 0x70, 0x35, 0x80, 0xA9, 0x99, 0xAA, 0x89, 0x88,
+    0x73, 0x16, 0x98, 0x99, 0x89, 0x88, 0xBA, 0x1A, 0x57, 0x01, 0x89, 0x90, 0xA9, 0xAA, 0xBB, 0x60,
+    0x36, 0x82, 0xA9, 0xA9, 0xBA, 0xBA, 0x0B, 0x77, 0x12, 0x98, 0x99, 0xA9, 0x99, 0x88, 0x29, 0x57,
+    0x81, 0x99, 0x89, 0x88, 0xB9, 0xAB, 0x70, 0x25, 0x80, 0x09, 0x99, 0xAB, 0xBA, 0x8C, 0x74, 0x14,
+    0x90, 0x99, 0x9A, 0x9A, 0xBA, 0x51, 0x36, 0x82, 0x9A, 0x9A, 0xAB, 0x88, 0xA9, 0x71, 0x17, 0x90,
+    0x99, 0x08, 0x99, 0xAA, 0x0B, 0x65, 0x03, 0x88, 0x90, 0xAB, 0xBA, 0xCB, 0x49, 0x57, 0x01, 0x99,
+    0x99, 0xA9, 0xA9, 0x09, 0x64, 0x23, 0x98, 0x9A, 0xBA, 0x0A, 0xA8, 0x0C, 0x57, 0x02, 0xA9, 0x88,
+    0x98, 0xAA, 0xBB, 0x69, 0x36, 0x81, 0x88, 0xA9, 0xAB, 0xBB, 0x9C, 0x73, 0x27, 0x98, 0x98, 0x99,
+    0x99, 0x8A, 0x38, 0x46, 0x02, 0xA9, 0xA9, 0x9A, 0x88, 0xCA, 0x50, 0x26, 0x91, 0x99, 0x08, 0xAA,
+    0xBB, 0x9C, 0x74, 0x13, 0x81, 0xA9, 0xAA, 0xBA, 0xCB, 0x3A, 0x77, 0x82, 0x98, 0x99, 0x99, 0x99,
+    0x88, 0x52, 0x34, 0x90, 0x9A, 0xBA, 0x88, 0xC8, 0x9B, 0x56, 0x23, 0xA9, 0x88, 0xA8, 0xAC, 0xCA,
+    0x29, 0x47, 0x12, 0x98, 0x9A, 0xBA, 0xAA, 0xAC, 0x73, 0x16, 0x80, 0x99, 0x99, 0xA9, 0x98, 0x00,
+    0x55, 0x03, 0x99, 0xAA, 0x89, 0x98, 0xDB, 0x28, 0x47, 0x81, 0x89, 0x90, 0xAA, 0xAA, 0x9C, 0x71,
+    0x24, 0x81, 0x99, 0xAA, 0xAA, 0xCA, 0x2A, 0x67, 0x01, 0x98, 0x99, 0x99, 0x99, 0x90, 0x30, 0x47,
+    0x91, 0x99, 0x99, 0x88, 0xB9, 0xAB, 0x73, 0x16, 0x90, 0x08, 0xA9, 0x9A, 0xBB, 0x1A, 0x57, 0x13,
+    0x98, 0x9A, 0xAA, 0xBA, 0xAB, 0x72, 0x27, 0x80, 0x99, 0x99, 0x9A, 0x08, 0x8A, 0x73, 0x14, 0xA0,
+    0xA9, 0x88, 0xA8, 0xBB, 0x2B, 0x77, 0x01, 0x88, 0x98, 0xA9, 0xA9, 0xAB, 0x60, 0x36, 0x81, 0x9A,
+    0xA9, 0x9A, 0xBA, 0x2A, 0x57, 0x13, 0x99, 0x9A, 0xAA, 0x89, 0xA8, 0x3A, 0x77, 0x81, 0xA8, 0x88,
+    0x88, 0xA9, 0xAB, 0x70, 0x24, 0x80, 0x90, 0xA9, 0xAB, 0xCA, 0x8A, 0x75, 0x23, 0x99, 0x99, 0xAA,
+    0xA9, 0x9B, 0x61, 0x45, 0x81, 0x9A, 0x99, 0x9A, 0x80, 0xAB, 0x71, 0x16, 0x90, 0x89, 0x88, 0xA9,
+    0xBA, 0x8A, 0x47, 0x13, 0x88, 0x99, 0xBA, 0xAB, 0xBC, 0x69, 0x37, 0x81, 0x99, 0xA9, 0xA9, 0x9A,
+    0x09, 0x74, 0x13, 0xA0, 0xA9, 0xA9, 0x09, 0xC9, 0x0A, 0x47, 0x03, 0x9A, 0x88, 0xA8, 0xAB, 0xBC,
+    0x58, 0x36, 0x02, 0x99, 0xA9, 0xBB, 0xCA, 0x9B, 0x75, 0x14, 0x98, 0x98, 0xA9, 0xA9, 0x89, 0x20,
+    0x37, 0x03, 0xAA, 0xAA, 0x8A, 0x98, 0xCC, 0x50, 0x26, 0x91, 0x89, 0x98, 0xAA, 0xBA, 0x9C, 0x64,
+    0x24, 0x80, 0x9A, 0xA9, 0xAB, 0xCA, 0x49, 0x47, 0x81, 0x98, 0x99, 0x9A, 0x99, 0x88, 0x61, 0x34,
+    0x90, 0xAA, 0xA9, 0x88, 0xC9, 0x8C, 0x64, 0x13, 0x99, 0x80, 0xB9, 0xBA, 0xCB, 0x3A, 0x67, 0x02,
+    0x98, 0x99, 0xAA, 0xA9, 0x9B, 0x74, 0x14, 0x90, 0x99, 0x99, 0x9A, 0x98, 0x88, 0x56, 0x12, 0x99,
+    0x9A, 0x89, 0xA8, 0xBC, 0x38, 0x57, 0x81, 0x88, 0x98, 0xAA, 0xAA, 0xAB, 0x72, 0x27, 0x80, 0x99,
+    0x99, 0x9A, 0xAA, 0x39, 0x57, 0x01, 0x98, 0x8A, 0xAA, 0x88, 0xA8, 0x58, 0x26, 0x81, 0x9A, 0x89,
+    0x98, 0xBB, 0x9C, 0x73, 0x15, 0x80, 0x98, 0xA9, 0xAA, 0xBA, 0x2B, 0x77, 0x02, 0x98, 0x99, 0x99,
+    0x9A, 0x9A, 0x72, 0x24, 0x80, 0x9A, 0xA9, 0x8A, 0x88, 0x9B, 0x74, 0x14, 0x98, 0x8A, 0x88, 0xA9,
+    0xCB, 0x19, 0x47, 0x02, 0x88, 0x99, 0xBA, 0xAA, 0xAC, 0x70, 0x35, 0x80, 0x99, 0x9A, 0xAA, 0x9A,
+    0x29, 0x56, 0x13, 0xA8, 0x9A, 0xAB, 0x08, 0xBA, 0x4B, 0x67, 0x81, 0x99, 0x08, 0x99, 0x9A, 0xBB,
+    0x71, 0x34, 0x00, 0xA8, 0xB9, 0xBA, 0xCA, 0x0B, 0x67, 0x12, 0xA8, 0x98, 0x9A, 0x9A, 0x99, 0x41,
+    0x37, 0x81, 0x9A, 0x9A, 0x8A, 0x98, 0xAC, 0x72, 0x24, 0xA0, 0x09, 0x98, 0xAB, 0xCA, 0x0B, 0x47,
+    0x13, 0x90, 0xA9, 0xBA, 0xBA, 0xCB, 0x78, 0x35, 0x81, 0xA9, 0x99, 0xBA, 0x99, 0x08, 0x73, 0x16,
+    0x90, 0x9A, 0x89, 0x88, 0xBA, 0x1A, 0x47, 0x03, 0x99, 0x88, 0xB9, 0xBB, 0xBC, 0x50, 0x37, 0x82,
+    0x99, 0xA9, 0xBA, 0xBA, 0x8B, 0x67, 0x13, 0x98, 0x99, 0xAA, 0x9A, 0x98, 0x28, 0x67, 0x01, 0x99,
+    0x99, 0x09, 0x99, 0xBB, 0x60, 0x35, 0x80, 0x09, 0x99, 0xBB, 0xCB, 0x8B, 0x74, 0x15, 0x90, 0x89,
+    0x9A, 0x9A, 0xBA, 0x68, 0x35, 0x01, 0xA9, 0xA9, 0xAA, 0x89, 0x99, 0x70, 0x26, 0x90, 0xA9, 0x88,
+    0x98, 0xBA, 0x8C, 0x55, 0x13, 0x98, 0x90, 0xBA, 0xBA, 0xBC, 0x39, 0x77, 0x02, 0x99, 0x89, 0x9A,
+    0xA9, 0x8A, 0x64, 0x23, 0x90, 0xAA, 0xB9, 0x9A, 0x90, 0x8B, 0x77, 0x02, 0x99, 0x89, 0x88, 0xA9,
+    0xBB, 0x48, 0x37, 0x01, 0x88, 0xA9, 0xAB, 0xBB, 0x9D, 0x72, 0x16, 0x80, 0x99, 0x99, 0xA9, 0xA9,
+    0x38, 0x47, 0x11, 0xA9, 0x99, 0x9A, 0x88, 0xB9, 0x69, 0x26, 0x81, 0x9A, 0x88, 0xA9, 0xBA, 0x9C,
+    0x73, 0x15, 0x80, 0x98, 0xA9, 0xAA, 0xBA, 0x1A, 0x77, 0x02, 0x98, 0x99, 0xA9, 0x99, 0x89, 0x52,
+    0x35, 0x90, 0xA9, 0xA9, 0x8A, 0xB0, 0x9C, 0x55, 0x14, 0xA8, 0x88, 0x98, 0xBA, 0xCA, 0x2A, 0x47,
+    0x12, 0x88, 0x9A, 0xBA, 0xBA, 0xAC, 0x71, 0x17, 0x80, 0x89, 0x99, 0xA9, 0x98, 0x18, 0x54, 0x13,
+    0xA8, 0xAA, 0x9A, 0x88, 0xCB, 0x4A, 0x37, 0x82, 0x99, 0x88, 0xBA, 0xCA, 0xBB, 0x72, 0x26, 0x81,
+    0x99, 0xA9, 0xAA, 0xB9, 0x1B, 0x77, 0x02, 0x89, 0x99, 0x99, 0x8A, 0x98, 0x30, 0x47, 0x91, 0x99,
+    0x99, 0x88, 0xA9, 0xAB, 0x72, 0x16, 0x90, 0x88, 0x98, 0xAA, 0xBA, 0x1B, 0x66, 0x13, 0x98, 0x99,
+    0xBA, 0xAA, 0xBB, 0x71, 0x27, 0x80, 0x89, 0x99, 0x9A, 0x89, 0x88, 0x72, 0x14, 0xA0, 0x99, 0x89,
+    0xA8, 0xCA, 0x1A, 0x47, 0x02, 0x89, 0x88, 0xBA, 0xAA, 0xAC, 0x58, 0x37, 0x81, 0x99, 0xA9, 0x9A,
+    0xBA, 0x0A, 0x57, 0x13, 0xA8, 0x99, 0xAA, 0x8A, 0x98, 0x2A, 0x77, 0x81, 0x98, 0x89, 0x88, 0xA9,
+    0xBA, 0x60, 0x25, 0x80, 0x08, 0xA9, 0xAB, 0xCA, 0x9A, 0x65, 0x14, 0x90, 0x99, 0x9A, 0xAA, 0x9A,
+    0x50, 0x36, 0x82, 0x9A, 0x9A, 0xAB, 0x80, 0xBA, 0x71, 0x17, 0x80, 0x8A, 0x88, 0xA8, 0xAA, 0x8B,
+    0x65, 0x13, 0x88, 0x98, 0xBA, 0xBA, 0xDB, 0x49, 0x47, 0x81, 0x89, 0x99, 0x9A, 0x9A, 0x09, 0x73,
+    0x24, 0x98, 0xA9, 0xA9, 0x09, 0xB8, 0x0B, 0x57, 0x03, 0xA9, 0x88, 0xA8, 0xAA, 0xBC, 0x48, 0x37,
+    0x82, 0x90, 0xAA, 0xBA, 0xBA, 0x9D, 0x73, 0x16, 0x90, 0x89, 0xA9, 0x99, 0x99, 0x20, 0x46, 0x02,
+    0xA9, 0xA9, 0x99, 0x88, 0xCB, 0x58, 0x36, 0x80, 0x8A, 0x88, 0xAA, 0xBB, 0x9C, 0x73, 0x25, 0x80,
+    0x99, 0xA9, 0xAA, 0xCA, 0x29, 0x67, 0x01, 0x99, 0x98, 0xA9, 0x89, 0x88, 0x41, 0x26, 0x91, 0x9A,
+    0x9A, 0x88, 0xB9, 0x8C, 0x74, 0x13, 0x99, 0x08, 0xA9, 0xAB, 0xDB, 0x29, 0x47, 0x02, 0x98, 0x99,
+    0xBA, 0xA9, 0xAC, 0x73, 0x25, 0x90, 0x99, 0x99, 0xAA, 0x88, 0x09, 0x65, 0x12, 0xA8, 0x9A, 0x89,
+    0x98, 0xCB, 0x39, 0x57, 0x81, 0x09, 0x98, 0xAA, 0xB9, 0xAB, 0x72, 0x26, 0x81, 0x8A, 0x9A, 0xAA,
+    0xAA, 0x2A, 0x67, 0x02, 0xA8, 0x89, 0x9A, 0x8A, 0x90, 0x49, 0x37, 0x91, 0xA9, 0x89, 0x98, 0xBA,
+    0xBB, 0x73, 0x17, 0x80, 0x88, 0x99, 0xAA, 0xB9, 0x1B, 0x66, 0x13, 0x98, 0x9A, 0xAA, 0xAA, 0xAA,
+    0x72, 0x26, 0x80, 0x99, 0x99, 0xAA, 0x80, 0x9A, 0x73, 0x25, 0xA8, 0x99, 0x88, 0xA8, 0xBB, 0x2B,
+    0x67, 0x01, 0x80, 0x98, 0xAA, 0xAA, 0xBB, 0x78, 0x36, 0x91, 0x99, 0x99, 0xAA, 0xAA, 0x19, 0x47,
+    0x13, 0xA8, 0xA9, 0xAA, 0x89, 0xB8, 0x3B, 0x77, 0x82, 0x99, 0x88, 0x98, 0xAA, 0xAB, 0x70, 0x34,
+    0x81, 0x98, 0xB9, 0xAB, 0xCB, 0x8B, 0x76, 0x13, 0x98, 0x99, 0xAA, 0xA9, 0x9A, 0x51, 0x36, 0x01,
+    0xAA, 0xA9, 0x9A, 0x90, 0xAC, 0x71, 0x25, 0x98, 0x89, 0x90, 0xAA, 0xBA, 0x8B, 0x57, 0x22, 0x90,
+    0x99, 0xBA, 0xAA, 0xBC, 0x58, 0x47, 0x00, 0x99, 0x99, 0xA9, 0x99, 0x08, 0x63, 0x24, 0xA0, 0xA9,
+    0x9A, 0x09, 0xC9, 0x1B, 0x56, 0x03, 0x99, 0x88, 0xA9, 0xBB, 0xDB, 0x48, 0x36, 0x03, 0x99, 0xAA,
+    0xBB, 0xCA, 0x9B, 0x75, 0x14, 0x88, 0x99, 0xA9, 0x9A, 0x88, 0x18, 0x47, 0x02, 0x9A, 0xA9, 0x89,
+    0x98, 0xCB, 0x58, 0x36, 0x90, 0x88, 0x98, 0xBA, 0xBA, 0x9C, 0x73, 0x16, 0x80, 0x99, 0x99, 0x9A,
+    0xAA, 0x49, 0x37, 0x02, 0xA9, 0xA9, 0xAA, 0x8A, 0x98, 0x70, 0x26, 0x90, 0x99, 0x99, 0x88, 0xBA,
+    0x8B, 0x75, 0x12, 0x88, 0x88, 0xB9, 0xAA, 0xCB, 0x29, 0x57, 0x03, 0x99, 0x99, 0xAA, 0xAA, 0x8C,
+    0x73, 0x24, 0x90, 0xA9, 0xA9, 0x8A, 0x88, 0x8A, 0x56, 0x13, 0xA9, 0x99, 0x98, 0xB9, 0xBC, 0x49,
+    0x47, 0x81, 0x88, 0x98, 0xBA, 0xB9, 0xBB, 0x72, 0x27, 0x91, 0x99, 0x99, 0x9A, 0xB9, 0x38, 0x47,
+    0x02, 0xA8, 0x99, 0xBA, 0x88, 0xB8, 0x59, 0x37, 0x81, 0x9A, 0x89, 0xA8, 0xBA, 0xAC, 0x72, 0x25,
+    0x08, 0x98, 0xA9, 0xAA, 0xBB, 0x1B, 0x77, 0x03, 0x99, 0x89, 0x9A, 0x9A, 0x8A, 0x62, 0x34, 0x91,
+    0x9A, 0xAA, 0x9A, 0xA0, 0x9C, 0x74, 0x23, 0xA8, 0x99, 0x90, 0xBA, 0xBC, 0x1A, 0x67, 0x11, 0x88,
+    0x99, 0xA9, 0xAA, 0xBB, 0x70, 0x27, 0x80, 0x99, 0x99, 0x99, 0x99, 0x08, 0x64, 0x13, 0xA8, 0x9A,
+    0xAA, 0x08, 0xCA, 0x29, 0x57, 0x01, 0x8A, 0x88, 0x99, 0xBA, 0xBB, 0x71, 0x35, 0x81, 0x99, 0xA9,
+    0xAB, 0xCA, 0x8A, 0x57, 0x13, 0x99, 0x99, 0xAA, 0x9A, 0x89, 0x40, 0x37, 0x82, 0xAA, 0xA9, 0x89,
+    0xA8, 0xAD, 0x71, 0x24, 0x98, 0x88, 0x98, 0xAA, 0xBB, 0x0C, 0x65, 0x13, 0x90, 0xA9, 0xB9, 0xAA,
+    0xAC, 0x68, 0x36, 0x91, 0x99, 0x99, 0xAA, 0x89, 0x89, 0x73, 0x25, 0x98, 0x9A, 0x89, 0x98, 0xBA,
+    0x1B, 0x57, 0x03, 0x99, 0x80, 0xBA, 0xBA, 0xAC, 0x59, 0x46, 0x82, 0x99, 0x99, 0xAA, 0xAA, 0x8B,
+    0x57, 0x13, 0x98, 0x9A, 0xA9, 0x9A, 0x98, 0x19, 0x67, 0x82, 0xA8, 0x89, 0x89, 0xA8, 0xBB, 0x68,
+    0x26, 0x91, 0x08, 0xA9, 0xAA, 0xBA, 0x9C, 0x74, 0x14, 0x90, 0x99, 0xA9, 0xA9, 0xAA, 0x58, 0x36,
+    0x82, 0xA9, 0x99, 0xAB, 0x88, 0xA9, 0x70, 0x26, 0x90, 0x99, 0x88, 0x99, 0xCA, 0x8A, 0x64, 0x13,
+    0x80, 0x98, 0xBB, 0xBA, 0xBC, 0x4A, 0x57, 0x02, 0x99, 0x99, 0x9A, 0xAA, 0x0A, 0x64, 0x14, 0x90,
+    0x99, 0xAA, 0x89, 0x98, 0x8B, 0x57, 0x12, 0xA9, 0x09, 0x98, 0xBA, 0xCB, 0x49, 0x37, 0x01, 0x88,
+    0xA9, 0xAB, 0xBB, 0xAC, 0x73, 0x27, 0x88, 0x99, 0xA8, 0x99, 0x99, 0x28, 0x46, 0x02, 0x99, 0x9A,
+    0xAA, 0x80, 0xCA, 0x48, 0x37, 0x91, 0x99, 0x88, 0xA9, 0xBB, 0x9C, 0x72, 0x25, 0x80, 0x89, 0xAA,
+    0xAA, 0xBA, 0x2B, 0x77, 0x02, 0x98, 0x99, 0x99, 0x9A, 0x09, 0x51, 0x35, 0x80, 0xAA, 0x9A, 0x89,
+    0xB8, 0x9C, 0x73, 0x16, 0x98, 0x09, 0x98, 0x9A, 0xBA, 0x1A, 0x57, 0x12, 0x98, 0xA9, 0xA9, 0xAA,
+    0xAC, 0x71, 0x25, 0x80, 0x8A, 0xA9, 0xA9, 0x89, 0x08, 0x74, 0x03, 0x98, 0x9A, 0x8A, 0x88, 0xCB,
+    0x3A, 0x47, 0x82, 0x89, 0x88, 0xAA, 0xAB, 0xAC, 0x70, 0x34, 0x82, 0x9A, 0xAA, 0xBA, 0xCA, 0x1A,
+    0x67, 0x02, 0x98, 0x99, 0xA9, 0x8A, 0x88, 0x38, 0x47, 0x92, 0xA9, 0x99, 0x88, 0xA9, 0xAC, 0x71,
+    0x24, 0x90, 0x88, 0xA8, 0xAB, 0xBB, 0x0C, 0x56, 0x14, 0x98, 0x99, 0xA9, 0x9A, 0xAB, 0x70, 0x35,
+    0x80, 0x99, 0x9A, 0xAA, 0x88, 0x99, 0x72, 0x16, 0x90, 0x8A, 0x09, 0x99, 0xBA, 0x0A, 0x57, 0x02,
+    0x09, 0x98, 0xAA, 0xBA, 0xBB, 0x68, 0x37, 0x82, 0x9A, 0x99, 0x9B, 0xBA, 0x1A, 0x57, 0x22, 0xA8,
+    0xA9, 0xA9, 0x8A, 0xA0, 0x2B, 0x67, 0x02, 0xA9, 0x89, 0x90, 0xAA, 0xBB, 0x78, 0x25, 0x81, 0x88,
+    0xA9, 0xAB, 0xCA, 0x9A, 0x74, 0x15, 0x98, 0x98, 0x99, 0x9A, 0x9A, 0x41, 0x45, 0x01, 0xA9, 0xA9,
+    0x9A, 0x08, 0xBB, 0x71, 0x26, 0x90, 0x8A, 0x08, 0xAA, 0xBA, 0x8B, 0x56, 0x14, 0x88, 0x98, 0xAA,
+    0xAA, 0xBB, 0x5A, 0x57, 0x81, 0x89, 0x99, 0xA9, 0x99, 0x09, 0x63, 0x24, 0x90, 0x9A, 0xAA, 0x09,
+    0xB9, 0x0C, 0x56, 0x03, 0x99, 0x09, 0xB8, 0xBA, 0xCB, 0x49, 0x37, 0x12, 0x99, 0xA9, 0xBB, 0xBA,
+    0x9D, 0x73, 0x16, 0x90, 0x89, 0x99, 0x9A, 0x89, 0x28, 0x55, 0x12, 0x9A, 0x9A, 0x8A, 0x98, 0xCB,
+    0x58, 0x36, 0x91, 0x99, 0x90, 0xBA, 0xBA, 0x9D, 0x73, 0x24, 0x80, 0x99, 0xAA, 0xAA, 0xCA, 0x39,
+    0x67, 0x01, 0x99, 0x98, 0xA9, 0x89, 0x88, 0x40, 0x36, 0x90, 0xA9, 0x99, 0x88, 0xBA, 0x9C, 0x74,
+    0x13, 0x98, 0x88, 0xB8, 0xAB, 0xDB, 0x19, 0x47, 0x03, 0x98, 0x9A, 0xAA, 0xAA, 0x9C, 0x72, 0x25,
+    0x90, 0x99, 0x99, 0x9A, 0x88, 0x89, 0x74, 0x13, 0x99, 0x9A, 0x89, 0xA8, 0xCB, 0x3A, 0x57, 0x01,
+    0x89, 0x90, 0xAA, 0xBA, 0xAB, 0x71, 0x36, 0x80, 0x99, 0xA9, 0xAA, 0xAA, 0x2A, 0x67, 0x02, 0x98,
+    0x99, 0xAA, 0x09, 0xA8, 0x38, 0x57, 0x81, 0xA9, 0x88, 0x98, 0xAA, 0xAB, 0x72, 0x25, 0x80, 0x88,
+    0xAA, 0xAA, 0xBB, 0x0B, 0x77, 0x03, 0x98, 0x99, 0xA9, 0x9A, 0xAA, 0x72, 0x34, 0x80, 0xA9, 0xA9,
+    0x9B, 0x80, 0xBB, 0x74, 0x15, 0x98, 0x89, 0x88, 0xA9, 0xCA, 0x09, 0x46, 0x12, 0x88, 0xA8, 0xBA,
+    0xAB, 0xBC, 0x60, 0x37, 0x80, 0x99, 0x99, 0x9A, 0xAA, 0x18, 0x55, 0x14, 0xA8, 0x99, 0xAA, 0x08,
+    0xB9, 0x2A, 0x67, 0x01, 0x99, 0x88, 0x98, 0xBA, 0xAB, 0x60, 0x26, 0x01, 0x98, 0xAA, 0xAA, 0xBA,
+    0x8C, 0x75, 0x13, 0x98, 0x99, 0xAA, 0xA9, 0x99, 0x40, 0x37, 0x82, 0xA9, 0xAA, 0x99, 0x90, 0xAD,
+    0x61, 0x34, 0x90, 0x8A, 0x90, 0xBB, 0xCA, 0x0C, 0x64, 0x23, 0x90, 0xA9, 0xBA, 0xBA, 0xCB, 0x69,
+    0x36, 0x82, 0x9A, 0x99, 0xBA, 0x99, 0x09, 0x72, 0x26, 0x98, 0x99, 0x99, 0x88, 0xB9, 0x0B, 0x66,
+    0x02, 0x98, 0x88, 0xA9, 0xAA, 0xCB, 0x38, 0x57, 0x02, 0x99, 0x99, 0xAA, 0xB9, 0x8B, 0x75, 0x23,
+    0x98, 0x9A, 0xA9, 0xAA, 0x88, 0x19, 0x57, 0x02, 0x99, 0x9A, 0x88, 0x99, 0xBC, 0x58, 0x36, 0x80,
+    0x09, 0xA8, 0xBA, 0xBA, 0x9C, 0x73, 0x26, 0x90, 0x99, 0x99, 0x9A, 0xBA, 0x48, 0x37, 0x02, 0xA9,
+    0xA9, 0xBA, 0x09, 0xA9, 0x70, 0x26, 0x80, 0x9A, 0x89, 0x98, 0xBA, 0x9B, 0x75, 0x13, 0x88, 0x98,
+    0xB9, 0xAA, 0xAC, 0x2A, 0x67, 0x02, 0xA8, 0x98, 0x9A, 0xAA, 0x8A, 0x73, 0x25, 0x88, 0x8A, 0x9A,
+    0x8A, 0x88, 0x8B, 0x75, 0x12, 0x99, 0x99, 0x90, 0xA9, 0xBB, 0x4A, 0x47, 0x01, 0x88, 0x99, 0xAA,
+    0xBA, 0x9C, 0x70, 0x26, 0x90, 0x89, 0xA9, 0x99, 0x9A, 0x28, 0x46, 0x03, 0xA8, 0x9A, 0xAB, 0x08,
+    0xBA, 0x6A, 0x46, 0x91, 0x99, 0x08, 0xA9, 0xAA, 0xAC, 0x72, 0x14, 0x81, 0x98, 0xB9, 0xAA, 0xBA,
+    0x1C, 0x57, 0x03, 0x99, 0x99, 0x9A, 0xAA, 0x89, 0x61, 0x35, 0x91, 0x9A, 0xAA, 0x89, 0x98, 0x9D,
+    0x73, 0x23, 0x98, 0x0A, 0xA8, 0xBA, 0xBC, 0x2B, 0x57, 0x13, 0x98, 0x99, 0xAB, 0xAB, 0xAC, 0x70,
+    0x26, 0x80, 0x99, 0x99, 0xA9, 0x99, 0x08, 0x64, 0x14, 0x99, 0x99, 0x99, 0x88, 0xBA, 0x2A, 0x67,
+    0x01, 0x99, 0x80, 0xA9, 0xAA, 0xAB, 0x60, 0x26, 0x82, 0x99, 0xA9, 0xAA, 0xCA, 0x0A, 0x66, 0x12,
+    0x98, 0x99, 0xAA, 0x99, 0x89, 0x20, 0x57, 0x01, 0x9A, 0x99, 0x88, 0xA9, 0xAB, 0x71, 0x25, 0x90,
+    0x88, 0xA8, 0xAA, 0xBB, 0x0C, 0x65, 0x23, 0xA0, 0xA9, 0xB9, 0xBA, 0xCB, 0x70, 0x25, 0x81, 0x99,
+    0xA9, 0x9A, 0x89, 0x99, 0x72, 0x16, 0x90, 0x99, 0x89, 0x98, 0xB9, 0x0B, 0x66, 0x02, 0x98, 0x90,
+    0xA9, 0xAA, 0xAC, 0x38, 0x67, 0x01, 0x99, 0x89, 0x9A, 0xA9, 0x0A, 0x74, 0x22, 0x98, 0x9A, 0xA9,
+    0x8A, 0xA0, 0x09, 0x57, 0x02, 0xA9, 0x89, 0x88, 0xAA, 0xCB, 0x58, 0x26, 0x81, 0x88, 0xA8, 0xAB,
+    0xBA, 0x9C, 0x73, 0x17, 0x90, 0x89, 0x99, 0x99, 0x9A, 0x30, 0x37, 0x82, 0xA9, 0xA9, 0xAA, 0x08,
+    0xBA, 0x70, 0x26, 0x91, 0x9A, 0x88, 0xA8, 0xBB, 0x9B, 0x75, 0x13, 0x80, 0x98, 0xBA, 0xBA, 0xCB,
+    0x3A, 0x77, 0x82, 0x98, 0x89, 0x9A, 0xA9, 0x09, 0x72, 0x33, 0xA0, 0x9A, 0xAA, 0x8A, 0xB0, 0x8C,
+    0x56, 0x13, 0xA9, 0x09, 0xA8, 0xBA, 0xBC, 0x4A, 0x47, 0x01, 0x90, 0xA9, 0xAA, 0xAA, 0xBB, 0x73,
+    0x37, 0x88, 0x99, 0x99, 0x9A, 0x8A, 0x28, 0x65, 0x02, 0xA8, 0xA9, 0x99, 0x88, 0xCA, 0x38, 0x47,
+    0x81, 0x99, 0x80, 0xAA, 0xBA, 0x9C, 0x72, 0x24, 0x81, 0x99, 0xAA, 0xBA, 0xCA, 0x2A, 0x67, 0x02,
+    0x99, 0x89, 0x9A, 0x8A, 0x89, 0x41, 0x27, 0x91, 0x99, 0x9A, 0x88, 0xA9, 0x9C, 0x73, 0x14, 0x98,
+    0x08, 0xA8, 0xAB, 0xCA, 0x1A, 0x47, 0x13, 0x98, 0x9A, 0xBA, 0xAA, 0xAC, 0x71, 0x26, 0x90, 0x89,
+    0xA9, 0x99, 0x89, 0x88, 0x64, 0x13, 0xA8, 0x9A, 0x89, 0x99, 0xDB, 0x29, 0x47, 0x01, 0x89, 0x88,
+    0xBA, 0xB9, 0xAC, 0x51, 0x27, 0x92, 0x99, 0x99, 0xAA, 0xAA, 0x2B, 0x67, 0x02, 0x98, 0x99, 0xA9,
+    0x8A, 0x90, 0x39, 0x57, 0x81, 0x99, 0x99, 0x88, 0xA9, 0x9C, 0x51, 0x25, 0x80, 0x88, 0xA9, 0xAB,
+    0xBB, 0x8C, 0x66, 0x23, 0xA8, 0x99, 0xAA, 0xAA, 0xAB, 0x71, 0x26, 0x81, 0x9A, 0x99, 0x9A, 0x88,
+    0xA9, 0x72, 0x25, 0x98, 0x99, 0x88, 0xA9, 0xBA, 0x0B, 0x57, 0x03, 0x88, 0x98, 0xAB, 0xBA, 0xAC,
+    0x59, 0x47, 0x81, 0x99, 0x99, 0xA9, 0x99, 0x1A, 0x64, 0x23, 0xA8, 0xA9, 0xAA, 0x89, 0xB8, 0x1B,
+    0x77, 0x02, 0x99, 0x09, 0xA8, 0xA9, 0xBB, 0x68, 0x26, 0x01, 0x89, 0xA9, 0xBA, 0xBA, 0x9B, 0x75,
+    0x15, 0x88, 0x99, 0x99, 0x9A, 0x99, 0x30, 0x47, 0x01, 0xA9, 0x99, 0x9A, 0x80, 0xBB, 0x70, 0x25,
+    0x91, 0x8A, 0x88, 0xAA, 0xBB, 0x8C, 0x74, 0x23, 0x90, 0x99, 0xAA, 0xAB, 0xDB, 0x39, 0x67, 0x81,
+    0x98, 0x98, 0x9A, 0x99, 0x08, 0x61, 0x24, 0x90, 0x9A, 0x9A, 0x09, 0xB9, 0x8C, 0x65, 0x03, 0x99,
+    0x08, 0xA9, 0xBA, 0xCB, 0x49, 0x46, 0x02, 0x98, 0xA9, 0xBA, 0xAA, 0x9C, 0x73, 0x17, 0x88, 0x89,
+    0x99, 0x99, 0x88, 0x08, 0x54, 0x03, 0xA9, 0xA9, 0x89, 0x98, 0xBC, 0x48, 0x37, 0x81, 0x89, 0x98,
+    0xBA, 0xCA, 0xAB, 0x73, 0x26, 0x80, 0x99, 0xA9, 0x9A, 0xBA, 0x39, 0x77, 0x01, 0x89, 0x99, 0x99,
+    0x89, 0x88, 0x48, 0x26, 0x91, 0xA9, 0x89, 0x98, 0xC9, 0x9A, 0x73, 0x24, 0x98, 0x08, 0xAA, 0xAB,
+    0xCA, 0x1A, 0x57, 0x03, 0x98, 0x9A, 0xB9, 0xA9, 0xAB, 0x73, 0x17, 0x80, 0x99, 0xA8, 0x99, 0x80,
+    0x8A, 0x64, 0x13, 0x99, 0x9A, 0x88, 0xA9, 0xBC, 0x29, 0x57, 0x01, 0x88, 0x98, 0xAA, 0xBA, 0xBB,
+    0x71, 0x27, 0x91, 0x89, 0xA9, 0xA9, 0xA9, 0x29, 0x47, 0x12, 0x99, 0x9A, 0xAA, 0x09, 0xB8, 0x4A,
+    0x47, 0x82, 0x9A, 0x09, 0x99, 0xBA, 0xAC, 0x72, 0x24, 0x80, 0x88, 0xAA, 0xBA, 0xCA, 0x8A, 0x57,
+    0x13, 0xA8, 0x99, 0xAA, 0xA9, 0x8B, 0x71, 0x34, 0x92, 0x9A, 0xAA, 0x8B, 0xA0, 0xBB, 0x73, 0x27,
+    0x90, 0x8A, 0x80, 0xAA, 0xCA, 0x1A, 0x65, 0x02, 0x80, 0x99, 0xAA, 0xBA, 0xBB, 0x78, 0x27, 0x81,
+    0x99, 0x99, 0x9A, 0xA9, 0x18, 0x54, 0x24, 0xA8, 0xA9, 0x9A, 0x88, 0xC9, 0x1A, 0x47, 0x83, 0x99,
+    0x88, 0xA9, 0xAB, 0xBC, 0x60, 0x35, 0x82, 0xA8, 0xB9, 0xBA, 0xCA, 0x9B, 0x67, 0x12, 0x98, 0x99,
+    0x99, 0xAA, 0x98, 0x30, 0x57, 0x81, 0x99, 0x99, 0x89, 0x98, 0xBB, 0x71, 0x25, 0x90, 0x09, 0x98,
+    0xAB, 0xBA, 0x8C, 0x74, 0x23, 0x90, 0xA9, 0xB9, 0xBA, 0xBB, 0x79, 0x27, 0x01, 0xA9, 0xA8, 0xA9,
+    0x89, 0x98, 0x72, 0x24, 0x90, 0xAA, 0x89, 0x98, 0xCA, 0x8A, 0x56, 0x03, 0x89, 0x88, 0xB9, 0xAB,
+    0xBC, 0x38, 0x77, 0x01, 0x98, 0x99, 0x99, 0xA9, 0x8A, 0x73, 0x15, 0x88, 0x99, 0xA9, 0x99, 0x90,
+    0x09, 0x56, 0x02, 0x99, 0x8A, 0x89, 0xB8, 0xBB, 0x69, 0x36, 0x81, 0x89, 0xA8, 0xBA, 0xBA, 0x9D,
+    0x72, 0x25, 0x90, 0x99, 0x99, 0x9A, 0xBA, 0x48, 0x37, 0x02, 0xA9, 0xA9, 0xAA, 0x09, 0xB9, 0x78,
+    0x26, 0x80, 0x9A, 0x88, 0xA8, 0xBA, 0x9B, 0x74, 0x14, 0x80, 0x88, 0xBA, 0xAA, 0xBB, 0x3B, 0x77,
+    0x03, 0x99, 0xA8, 0xA9, 0xA9, 0x8A, 0x73, 0x34, 0x90, 0x9A, 0xAA, 0x8A, 0xA0, 0x9B, 0x66, 0x13,
+    0xA8, 0x99, 0x90, 0xBA, 0xBC, 0x3A, 0x67, 0x01, 0x90, 0x98, 0xAA, 0xAA, 0xAB, 0x71, 0x27, 0x90,
+    0x89, 0x99, 0xA9, 0x99, 0x28, 0x55, 0x12, 0x99, 0x9A, 0xAA, 0x08, 0xCA, 0x39, 0x57, 0x81, 0x99,
+    0x08, 0xA9, 0xAA, 0xBB, 0x72, 0x16, 0x81, 0x98, 0xA9, 0x9A, 0xBA, 0x1B, 0x77, 0x02, 0x99, 0x98,
+    0x99, 0x99, 0x89, 0x31, 0x37, 0x81, 0x9A, 0xAA, 0x89, 0xA8, 0x9D, 0x72, 0x14, 0xA0, 0x88, 0xA0,
+    0xAA, 0xBB, 0x1B, 0x67, 0x12, 0x90, 0xA9, 0xB9, 0xA9, 0xCB, 0x70, 0x25, 0x80, 0x99, 0x99, 0x9A,
+    0x99, 0x08, 0x73, 0x15, 0x98, 0x9A, 0x89, 0x88, 0xBA, 0x1A, 0x57, 0x82, 0x98, 0x80, 0xAA, 0xBA,
+    0xBB, 0x70, 0x35, 0x02, 0x9A, 0xAA, 0xBA, 0xCA, 0x0B, 0x67, 0x02, 0x88, 0x8A, 0x9A, 0x8A, 0x98,
+    0x28, 0x47, 0x82, 0xA9, 0x99, 0x88, 0xA9, 0xAC, 0x60, 0x25, 0x80, 0x88, 0xA8, 0xAB, 0xBB, 0x8C,
+    0x65, 0x14, 0x90, 0x99, 0xAA, 0xA9, 0xBA, 0x70, 0x25, 0x01, 0x9A, 0xA9, 0xAA, 0x08, 0xA9, 0x71,
+    0x16, 0x90, 0x99, 0x88, 0x98, 0xAB, 0x0B, 0x56, 0x03, 0x88, 0x88, 0xBB, 0xBA, 0xBC, 0x59, 0x47,
+    0x01, 0x99, 0x99, 0x9A, 0xAA, 0x0A, 0x65, 0x13, 0x98, 0xA9, 0xA9, 0x8A, 0x98, 0x0B, 0x67, 0x02,
+    0x99, 0x89, 0x98, 0xA9, 0xCB, 0x48, 0x27, 0x01, 0x98, 0xA8, 0xBA, 0xAA, 0x9C, 0x73, 0x26, 0x98,
+    0x89, 0xA9, 0x99, 0x9A, 0x30, 0x37, 0x03, 0xAA, 0xA9, 0xAB, 0x80, 0xCB, 0x60, 0x26, 0x91, 0x8A,
+    0x88, 0xA9, 0xBB, 0x9C, 0x74, 0x13, 0x80, 0xA8, 0xB9, 0xBA, 0xCA, 0x2A, 0x77, 0x82, 0x98, 0x99,
+    0x99, 0x99, 0x09, 0x52, 0x25, 0x90, 0x9A, 0xA9, 0x09, 0xB8, 0x8C, 0x74, 0x03, 0xA8, 0x08, 0xA8,
+    0xAB, 0xCB, 0x39, 0x47, 0x12, 0x98, 0xA9, 0xBA, 0xBA, 0xAC, 0x72, 0x17, 0x80, 0x99, 0x98, 0x9A,
+    0x98, 0x00, 0x45, 0x13, 0xA9, 0xAA, 0x99, 0x98, 0xDB, 0x49, 0x46, 0x91, 0x89, 0x80, 0xAA, 0xBA,
+    0xAB, 0x72, 0x26, 0x81, 0x99, 0x9A, 0xAA, 0xBA, 0x3B, 0x77, 0x02, 0x99, 0x98, 0xA9, 0x89, 0x89,
+    0x40, 0x36, 0x80, 0x9A, 0x9A, 0x88, 0xB9, 0xAC, 0x73, 0x15, 0x90, 0x88, 0xA8, 0xAA, 0xCA, 0x1A,
+    0x56, 0x13, 0xA8, 0x99, 0xBA, 0xB9, 0xBB, 0x73, 0x27, 0x80, 0x99, 0x99, 0x9A, 0x88, 0x89, 0x73,
+    0x14, 0x98, 0xA9, 0x88, 0xA8, 0xCA, 0x2A, 0x47, 0x82, 0x88, 0x98, 0xAA, 0xAB, 0xAC, 0x60, 0x36,
+    0x81, 0x9A, 0xA9, 0x9A, 0xBA, 0x2A, 0x57, 0x03, 0x98, 0x9A, 0xAA, 0x89, 0xA8, 0x39, 0x77, 0x81,
+    0x99, 0x88, 0x98, 0xA9, 0xAA, 0x70, 0x24, 0x80, 0x88, 0xA9, 0xAB, 0xCA, 0x8A, 0x75, 0x13, 0x98,
+    0x99, 0x9A, 0xAA, 0x9B, 0x71, 0x34, 0x82, 0xAA, 0xAA, 0xAA, 0x80, 0xBB, 0x72, 0x27, 0x90, 0x8A,
+    0x90, 0x99, 0xBB, 0x0B, 0x57, 0x12, 0x88, 0x98, 0xAB, 0xAA, 0xAC, 0x59, 0x37, 0x92, 0x99, 0x99,
+    0xAA, 0xAA, 0x19, 0x55, 0x24, 0x98, 0x9A, 0xAA, 0x09, 0xB9, 0x1B, 0x77, 0x01, 0x98, 0x09, 0xA8,
+    0xA9, 0xAB, 0x58, 0x36, 0x01, 0x98, 0xAA, 0xBA, 0xCA, 0x9B, 0x75, 0x14, 0x98, 0x89, 0xA9, 0xA9,
+    0x89, 0x20, 0x47, 0x01, 0x99, 0x9A, 0x8A, 0x90, 0xBB, 0x78, 0x35, 0x90, 0x89, 0x88, 0xAB, 0xBB,
+    0x9C, 0x55, 0x24, 0x80, 0xA9, 0xB9, 0xAA, 0xCB, 0x49, 0x47, 0x82, 0x99, 0x99, 0x9A, 0x8A, 0x89,
+    0x62, 0x25, 0x90, 0xA9, 0x99, 0x88, 0xBA, 0x8C, 0x65, 0x03, 0x98, 0x88, 0xA9, 0xAB, 0xDB, 0x39,
+    0x47, 0x02, 0x98, 0xA9, 0xAA, 0xAA, 0x9C, 0x64, 0x24, 0x88, 0x9A, 0xA9, 0x9A, 0x88, 0x09, 0x66,
+    0x02, 0xA8, 0x99, 0x89, 0x98, 0xAC, 0x49, 0x36, 0x81, 0x88, 0xA8, 0xBA, 0xBB, 0x9D, 0x71, 0x25,
+    0x91, 0x99, 0xA9, 0x9A, 0xBA, 0x4A, 0x47, 0x82, 0x98, 0x9A, 0xA9, 0x89, 0xA8, 0x58, 0x27, 0x91,
+    0x99, 0x89, 0x98, 0xBA, 0xAB, 0x74, 0x14, 0x90, 0x80, 0xAA, 0xAA, 0xBB, 0x1B, 0x77, 0x03, 0xA8,
+    0x98, 0x9A, 0xAA, 0x9A, 0x73, 0x34, 0x90, 0xA9, 0xA9, 0x9A, 0x90, 0x9B, 0x75, 0x23, 0x99, 0x9A,
+    0x88, 0xAA, 0xDB, 0x19, 0x47, 0x82, 0x80, 0x99, 0xBA, 0xAA, 0xAC, 0x70, 0x35, 0x80, 0x8A, 0x9A,
+    0xAA, 0xB9, 0x28, 0x47, 0x13, 0xA9, 0xA9, 0xAA, 0x09, 0xB9, 0x4B, 0x67, 0x81, 0x99, 0x08, 0x99,
+    0xAA, 0xAA, 0x70, 0x24, 0x01, 0x99, 0xA9, 0xAB, 0xCB, 0x8A, 0x67, 0x12, 0x99, 0x98, 0x9A, 0x9A,
+    0x99, 0x51, 0x35, 0x82, 0xAA, 0xAA, 0x9A, 0xA0, 0xAC, 0x72, 0x16, 0x90, 0x89, 0x90, 0xAA, 0xBA,
+    0x0A, 0x47, 0x23, 0x88, 0xAA, 0xBA, 0xBA, 0xBC, 0x78, 0x36, 0x80, 0x99, 0x99, 0xAA, 0x99, 0x08,
+    0x73, 0x15, 0xA0, 0x99, 0x99, 0x88, 0xBA, 0x2B, 0x57, 0x02, 0x99, 0x80, 0xB9, 0xAA, 0xBC, 0x50,
+    0x36, 0x82, 0xA8, 0xA9, 0xAB, 0xBB, 0x8C, 0x66, 0x13, 0x98, 0xA9, 0xA9, 0x9A, 0x89, 0x28, 0x67,
+    0x01, 0x99, 0x99, 0x89, 0x98, 0xBB, 0x70, 0x34, 0x90, 0x88, 0xA8, 0xAB, 0xCB, 0x8B, 0x74, 0x24,
+    0x90, 0x99, 0xAA, 0x9A, 0xBB, 0x68, 0x36, 0x82, 0xA9, 0xA9, 0xAA, 0x89, 0xA8, 0x71, 0x26, 0x90,
+    0xA9, 0x98, 0x90, 0xBA, 0x0C, 0x64, 0x13, 0x89, 0x88, 0xBA, 0xBA, 0xDB, 0x39, 0x57, 0x02, 0x99,
+    0x99, 0x9A, 0xAA, 0x8B, 0x65, 0x23, 0x90, 0x9A, 0xBA, 0x9A, 0x90, 0x0B, 0x77, 0x02, 0x99, 0x89,
+    0x98, 0xA8, 0xBB, 0x48, 0x37, 0x01, 0x09, 0xA9, 0xBB, 0xBA, 0x9D, 0x72, 0x25, 0x90, 0x89, 0x9A,
+    0x99, 0xAA, 0x2A, 0x57, 0x02, 0x99, 0x98, 0x9A, 0x9A, 0xBA, 0x70, 0x35, 0x80, 0x99, 0x99, 0xAA,
+    0xB9, 0x8B, 0x75, 0x23, 0xA0, 0x99, 0xA9, 0xAA, 0xBB, 0x3A, 0x77, 0x03, 0x99, 0x99, 0xA9, 0x99,
+    0xAB, 0x71, 0x25, 0x81, 0x8A, 0xA9, 0x9A, 0xAA, 0x8B, 0x66, 0x23, 0x98, 0x9A, 0xA9, 0xAA, 0xCA,
+    0x39, 0x67, 0x01, 0x89, 0x99, 0x99, 0xA9, 0x9A, 0x71, 0x34, 0x90, 0x99, 0x99, 0xAA, 0xBA, 0x0B,
+    0x67, 0x13, 0x99, 0x99, 0xA9, 0xA9, 0xBA, 0x48, 0x57, 0x01, 0x99, 0x89, 0x9A, 0xA9, 0xAA, 0x72,
+    0x25, 0x80, 0x99, 0xA9, 0xA9, 0xB9, 0x0A, 0x57, 0x13, 0x99, 0x99, 0xA9, 0xAA, 0xBB, 0x68, 0x37,
+    0x81, 0x99, 0x99, 0x9A, 0xAA, 0x9B, 0x73, 0x27, 0x88, 0x99, 0x98, 0x9A, 0xA9, 0x1A, 0x47, 0x03,
+    0x99, 0x99, 0xA9, 0x9A, 0xBB, 0x70, 0x35, 0x82, 0x9A, 0xA9, 0xAA, 0xBA, 0x9B, 0x75, 0x15, 0x88,
+    0x99, 0x99, 0x99, 0xAA, 0x19, 0x57, 0x02, 0xA8, 0x98, 0x9A, 0x9A, 0xBA, 0x71, 0x35, 0x80, 0x99,
+    0xA9, 0x9A, 0xAA, 0x8C, 0x55, 0x14, 0x90, 0x8A, 0xA9, 0x9A, 0xBA, 0x39, 0x77, 0x01, 0x89, 0x89,
+    0xA9, 0x99, 0x9A, 0x70, 0x24, 0x91, 0x99, 0x99, 0xAA, 0xB9, 0x8A, 0x57, 0x23, 0x99, 0x99, 0xAA,
+    0xAA, 0xCA, 0x38, 0x67, 0x01, 0x99, 0x98, 0x99, 0x9A, 0xAA, 0x72, 0x25, 0x90, 0x89, 0xA9, 0xA9,
+    0xA9, 0x1B, 0x66, 0x03, 0x98, 0x99, 0xA9, 0x9A, 0xBB, 0x58, 0x47, 0x81, 0x89, 0x99, 0x9A, 0xA9,
+    0x9A, 0x72, 0x16, 0x80, 0x99, 0x99, 0x99, 0xB9, 0x09, 0x57, 0x02, 0x98, 0x99, 0xA9, 0x99, 0xAB,
+    0x68, 0x36, 0x81, 0x9A, 0xA8, 0xA9, 0xAA, 0x9B, 0x74, 0x15, 0x90, 0x89, 0xA9, 0x99, 0xAA, 0x2A,
+    0x57, 0x12, 0x99, 0x99, 0xA9, 0x9A, 0xAB, 0x70, 0x35, 0x91, 0x99, 0x99, 0xAA, 0xAA, 0x8C, 0x74,
+    0x23, 0x98, 0x99, 0xA9, 0xAA, 0xCA, 0x29, 0x67, 0x01, 0x89, 0x89, 0x9A, 0x99, 0xAA, 0x61, 0x35,
+    0x80, 0xA9, 0xA8, 0xAA, 0xB9, 0x8B, 0x57, 0x14, 0x98, 0x99, 0x99, 0x9A, 0xBA, 0x49, 0x47, 0x01,
+    0x99, 0x98, 0xAA, 0x99, 0xAB, 0x72, 0x26, 0x90, 0x89, 0x99, 0x9A, 0xA9, 0x0B, 0x66, 0x12, 0x98,
+    0x99, 0xA9, 0xA9, 0xBA, 0x58, 0x37, 0x82, 0x99, 0xA9, 0xAA, 0xA9, 0x9C, 0x72, 0x25, 0x90, 0x99,
+    0xA8, 0xA9, 0xB9, 0x1A, 0x57, 0x03, 0x98, 0x99, 0xAA, 0xA9, 0xBB, 0x60, 0x36, 0x82, 0xA9, 0x99,
+    0xAA, 0xBA, 0xAB, 0x75, 0x24, 0x90, 0x8A, 0xA9, 0x9A, 0xBA, 0x2A, 0x67, 0x02, 0x98, 0x99, 0x99,
+    0x9A, 0xAB, 0x60, 0x36, 0x91, 0x99, 0x99, 0x9A, 0xAA, 0x9B, 0x75, 0x14, 0x98, 0x98, 0x99, 0x9A,
+    0xAA, 0x3A, 0x57, 0x02, 0xA8, 0x98, 0xAA, 0xA9, 0xBA, 0x71, 0x26, 0x91, 0x99, 0x98, 0xAA, 0xA9,
+    0x0B, 0x75, 0x13, 0x98, 0x99, 0xA9, 0x9A, 0xCA, 0x39, 0x57, 0x01, 0x98, 0x99, 0xA9, 0xA9, 0xAA,
+    0x72, 0x25, 0x80, 0x99, 0x99, 0xAA, 0xB9, 0x8A, 0x57, 0x13, 0x98, 0x99, 0xAA, 0x9A, 0xBB, 0x59,
+    0x47, 0x01, 0x99, 0x99, 0xA9, 0xA9, 0xAA, 0x72, 0x26, 0x90, 0x89, 0x99, 0x9A, 0xB9, 0x0A, 0x57,
+    0x12, 0xA8, 0x98, 0x9A, 0x9A, 0xBB, 0x68, 0x36, 0x82, 0x9A, 0x99, 0xAA, 0xAA, 0xAB, 0x74, 0x25,
+    0x90, 0x99, 0x99, 0x9A, 0xAA, 0x1A, 0x67, 0x02, 0x98, 0x99, 0xA9, 0x99, 0xBA, 0x60, 0x35, 0x82,
+    0x9A, 0xA9, 0xAA, 0xBA, 0x9B, 0x75, 0x15, 0x88, 0x99, 0x99, 0x99, 0xAA, 0x19, 0x57, 0x02, 0x89,
+    0x99, 0x9A, 0x9A, 0xBA, 0x70, 0x35, 0x91, 0x99, 0x99, 0xAA, 0xAA, 0x8B, 0x75, 0x14, 0x98, 0x98,
+    0xA9, 0x99, 0xBA, 0x39, 0x67, 0x01, 0x98, 0x99, 0x99, 0xA9, 0x9A, 0x70, 0x25, 0x80, 0x99, 0x99,
+    0x9A, 0xB9, 0x8A, 0x66, 0x13, 0x98, 0x8A, 0xAA, 0xA9, 0xBA, 0x49, 0x57, 0x82, 0x99, 0x98, 0x9A,
+    0xA9, 0xAA, 0x71, 0x26, 0x90, 0x89, 0x99, 0x9A, 0xA9, 0x0A, 0x56, 0x13, 0xA8, 0x99, 0xA9, 0xAA,
+    0xBB, 0x69, 0x37, 0x01, 0xA9, 0xA8, 0x9A, 0xAA, 0xAB, 0x74, 0x15, 0x80, 0x99, 0x99, 0x9A, 0xB9,
+    0x1A, 0x57, 0x12, 0x99, 0x89, 0xAA, 0xA9, 0xBA, 0x60, 0x36, 0x81, 0x99, 0x99, 0x9B, 0xBA, 0x9B,
+    0x74, 0x16, 0x90, 0x89, 0x99, 0x99, 0xAA, 0x19, 0x47, 0x03, 0x99, 0x99, 0xAA, 0xA9, 0xBB, 0x70,
+    0x36, 0x91, 0x99, 0x99, 0x9A, 0xAA, 0x8B, 0x75, 0x23, 0x98, 0x99, 0xAA, 0x9A, 0xCA, 0x29, 0x67,
+    0x01, 0x89, 0x89, 0x9A, 0x99, 0xAA, 0x61, 0x35, 0x80, 0xA9, 0xA8, 0xAA, 0xB9, 0x8B, 0x57, 0x14,
+    0x98, 0x99, 0x99, 0x9A, 0xBA, 0x49, 0x47, 0x01, 0x99, 0x89, 0x9A, 0x9A, 0xAB, 0x72, 0x26, 0x90,
+    0x89, 0x99, 0x9A, 0xA9, 0x0B, 0x66, 0x12, 0x98, 0x99, 0xA9, 0xA9, 0xBA, 0x48, 0x57, 0x81, 0x98,
+    0x99, 0x99, 0xA9, 0x9A, 0x72, 0x25, 0x90, 0x99, 0x99, 0x9A, 0xB9, 0x1A, 0x57, 0x03, 0xA8, 0x89,
+    0xAA, 0xA9, 0xAB, 0x68, 0x36, 0x82, 0xA9, 0x99, 0xAA, 0xBA, 0xAB, 0x74, 0x16, 0x80, 0x99, 0x99,
+    0x99, 0xAA, 0x2A, 0x47, 0x03, 0xA8, 0x99, 0xAA, 0xA9, 0xBB, 0x70, 0x36, 0x81, 0x9A, 0x99, 0x9A,
+    0xAA, 0x9B, 0x75, 0x14, 0x98, 0x98, 0x99, 0x9A, 0xAA, 0x3A, 0x57, 0x02, 0xA8, 0x98, 0xAA, 0xA9,
+    0xBA, 0x71, 0x26, 0x91, 0x99, 0xA8, 0x99, 0xAA, 0x0B, 0x75, 0x13, 0x98, 0x99, 0xA9, 0x9A, 0xAB,
+    0x4A, 0x57, 0x01, 0x99, 0x98, 0xA9, 0x99, 0xAB, 0x71, 0x25, 0x91, 0x99, 0x99, 0x9A, 0xAA, 0x0B,
+    0x57, 0x13, 0x98, 0x9A, 0xA9, 0xAA, 0xBA, 0x59, 0x47, 0x01, 0x99, 0x99, 0xA9, 0xA9, 0x9B, 0x72,
+    0x26, 0x90, 0x89, 0x99, 0x9A, 0xAA, 0x1A, 0x66, 0x12, 0x98, 0x99, 0x9A, 0x9A, 0xAB, 0x69, 0x36,
+    0x01, 0x9A, 0x99, 0xAA, 0xB9, 0xAB, 0x74, 0x25, 0x90, 0x99, 0x99, 0x9A, 0xAA, 0x1A, 0x67, 0x02,
+    0x89, 0x99, 0xA9, 0x99, 0xAA, 0x68, 0x35, 0x82, 0x9A, 0xA9, 0xAA, 0xBA, 0x9B, 0x75, 0x15, 0x88,
+    0x99, 0x99, 0x99, 0xAA, 0x19, 0x57, 0x02, 0x89, 0x99, 0x9A, 0x9A, 0xBA, 0x70, 0x35, 0x91, 0x99,
+    0x99, 0xAA, 0xAA, 0x8B, 0x75, 0x14, 0x98, 0x89, 0xA9, 0x99, 0xAA, 0x3A, 0x67, 0x01, 0x98, 0x99,
+    0x99, 0x99, 0xAB, 0x71, 0x25, 0x80, 0x99, 0x99, 0x9A, 0xAA, 0x8A, 0x66, 0x13, 0x98, 0x8A, 0xAA,
+    0xA9, 0xBA, 0x49, 0x57, 0x01, 0x99, 0x98, 0x9A, 0xA9, 0xAA, 0x72, 0x25, 0x91, 0x99, 0xA9, 0xA9,
+    0xB9, 0x0B, 0x67, 0x12, 0x98, 0x99, 0xA9, 0xA9, 0xAA, 0x59, 0x37, 0x01, 0x9A, 0x99, 0x9A, 0xAA,
+    0xAB, 0x74, 0x15, 0x80, 0x99, 0x99, 0x9A, 0xB9, 0x1A, 0x57, 0x12, 0x99, 0x89, 0xAA, 0xA9, 0xBA,
+    0x68, 0x36, 0x82, 0x9A, 0x99, 0xAA, 0xAA, 0x9C, 0x74, 0x23, 0x90, 0x9A, 0xA9, 0xAA, 0xBA, 0x3B,
+    0x77, 0x02, 0x98, 0x89, 0x9A, 0xA9, 0xAA, 0x60, 0x26, 0x81, 0x99, 0x99, 0xAA, 0xA9, 0x9B, 0x75,
+    0x23, 0x98, 0x99, 0xA9, 0xAA, 0xCA, 0x29, 0x67, 0x01, 0x89, 0x89, 0x9A, 0x99, 0xAA, 0x61, 0x35,
+    0x80, 0xA9, 0xA8, 0xAA, 0xB9, 0x8B, 0x57, 0x23, 0x98, 0x9A, 0xB9, 0x9A, 0xCB, 0x49, 0x47, 0x01,
+    0x99, 0x99, 0xA9, 0x99, 0xAB, 0x72, 0x26, 0x90, 0x89, 0x99, 0x9A, 0xA9, 0x0B, 0x66, 0x12, 0x98,
+    0x99, 0xA9, 0xA9, 0xBA, 0x48, 0x57, 0x81, 0x98, 0x99, 0x99, 0xA9, 0x9A, 0x72, 0x25, 0x90, 0x99,
+    0x99, 0x9A, 0xB9, 0x0A, 0x57, 0x03, 0x98, 0x99, 0x9A, 0xAA, 0xBA, 0x68, 0x36, 0x82, 0xA9, 0x99,
+    0xAA, 0xBA, 0xAB, 0x75, 0x24, 0x90, 0x8A, 0xA9, 0x9A, 0xAA, 0x2B, 0x67, 0x02, 0x98, 0x99, 0x99,
+    0x9A, 0xAB, 0x60, 0x36, 0x91, 0x99, 0x99, 0x9A, 0xAA, 0x9B, 0x74, 0x15, 0x90, 0x89, 0xA9, 0x99,
+    0xAA, 0x2A, 0x67, 0x01, 0x98, 0x89, 0xA9, 0x99, 0xAA, 0x60, 0x26, 0x80, 0x99, 0x98, 0xAA, 0xA9,
+    0x9A, 0x75, 0x13, 0x98, 0x99, 0xA9, 0xA9, 0xBA, 0x39, 0x77, 0x82, 0x98, 0x89, 0xA9, 0x99, 0xAA,
+    0x71, 0x34, 0x80, 0x9A, 0x99, 0xAA, 0xAA, 0x8B, 0x67, 0x13, 0x99, 0x99, 0x99, 0xAA, 0xBA, 0x59,
+    0x37, 0x02, 0x9A, 0x99, 0xAA, 0xAA, 0xBB, 0x73, 0x27, 0x80, 0x99, 0xA8, 0x99, 0xAA, 0x0A, 0x47,
+    0x13, 0xA8, 0x99, 0xB9, 0x9A, 0xCB, 0x58, 0x46, 0x81, 0x99, 0x98, 0xAA, 0xA9, 0x9A, 0x72, 0x17,
+    0x90, 0x98, 0x89, 0x8A, 0xA9, 0x1A, 0x56, 0x02, 0x98, 0x99, 0xA9, 0x9A, 0xBA, 0x78, 0x35, 0x81,
+    0x9A, 0x99, 0xAA, 0xA9, 0x8C, 0x73, 0x25, 0x98, 0x89, 0xA9, 0x99, 0xBA, 0x19, 0x67, 0x02, 0x99,
+    0x98, 0xA9, 0x99, 0xAA, 0x60, 0x35, 0x81, 0x9A, 0x99, 0x9B, 0xBA, 0x9B, 0x76, 0x23, 0x98, 0x9A,
+    0xA9, 0xA9, 0xBA, 0x3A, 0x77, 0x02, 0x99, 0x98, 0xA9, 0x99, 0xAA, 0x71, 0x34, 0x91, 0xA9, 0x99,
+    0xAA, 0xBA, 0x8B, 0x67, 0x13, 0x98, 0x99, 0x9A, 0xAA, 0xBA, 0x49, 0x57, 0x01, 0x99, 0x98, 0xA9,
+    0xA9, 0xAA, 0x72, 0x25, 0x91, 0x99, 0xA9, 0xA9, 0xAA, 0x0B, 0x67, 0x12, 0x98, 0x99, 0xA9, 0xA9,
+    0xAA, 0x59, 0x37, 0x81, 0x99, 0xA8, 0x9A, 0xAA, 0xAB, 0x73, 0x27, 0x90, 0x89, 0x99, 0xA9, 0xA9,
+    0x1A, 0x47, 0x03, 0xA8, 0x99, 0xA9, 0x9A, 0xBB, 0x68, 0x37, 0x81, 0x99, 0x99, 0xAA, 0xB9, 0xAA,
+    0x74, 0x15, 0x90, 0x89, 0x99, 0x9A, 0xAA, 0x2A, 0x57, 0x02, 0x98, 0x99, 0x9A, 0x9A, 0xAB, 0x70,
+    0x35, 0x91, 0x99, 0x99, 0xAA, 0xAA, 0x9B, 0x75, 0x14, 0x90, 0x99, 0x99, 0x9A, 0xBA, 0x29, 0x67,
+    0x02, 0x99, 0x98, 0x9A, 0xA9, 0xAA, 0x71, 0x34, 0x81, 0x9A, 0xA9, 0xAA, 0xBA, 0x8B, 0x67, 0x13,
+    0x98, 0x99, 0xA9, 0xAA, 0xBA, 0x4A, 0x67, 0x01, 0x99, 0x98, 0x99, 0xA9, 0x9A, 0x71, 0x24, 0x91,
+    0x99, 0xA9, 0x9A, 0xAA, 0x0B, 0x57, 0x23, 0x99, 0xA9, 0xA9, 0xAA, 0xBB, 0x69, 0x37, 0x82, 0xA9,
+    0xA8, 0x9A, 0xAA, 0xAB, 0x73, 0x27, 0x90, 0x89, 0x99, 0x9A, 0xA9, 0x0A, 0x47, 0x13, 0x99, 0x99,
+    0xAA, 0x9A, 0xBB, 0x79, 0x36, 0x81, 0x99, 0x99, 0xAA, 0xAA, 0x9B, 0x74, 0x15, 0x90, 0x98, 0x99,
+    0x9A, 0xAA, 0x1A, 0x57, 0x03, 0x99, 0x99, 0xA9, 0xA9, 0xAB, 0x78, 0x35, 0x81, 0x99, 0xA9, 0xAA,
+    0xB9, 0x9B, 0x75, 0x24, 0x98, 0x99, 0x99, 0x9A, 0xBA, 0x3A, 0x67, 0x02, 0x99, 0x98, 0xA9, 0xA9,
+    0xAA, 0x70, 0x25, 0x81, 0x99, 0xA9, 0x9A, 0xAA, 0x8B, 0x66, 0x23, 0xA8, 0x99, 0xA9, 0xAA, 0xBA,
+    0x4A, 0x67, 0x01, 0x99, 0x98, 0x99, 0xA9, 0x9A, 0x61, 0x35, 0x80, 0x9A, 0x99, 0xAA, 0xAA, 0x8B,
+    0x67, 0x03, 0x98, 0x89, 0x9A, 0xAA, 0xBA, 0x48, 0x57, 0x01, 0x99, 0x99, 0x99, 0xA9, 0xAA, 0x72,
+    0x25, 0x80, 0x8A, 0xA9, 0xA9, 0xB9, 0x0A, 0x57, 0x13, 0x99, 0x99, 0xA9, 0xAA, 0xBA, 0x69, 0x37,
+    0x81, 0x99, 0x99, 0xAA, 0xA9, 0x9B, 0x73, 0x17, 0x80, 0x99, 0x98, 0x9A, 0xA9, 0x09, 0x47, 0x12,
+    0x99, 0x99, 0xA9, 0x9A, 0xBB, 0x60, 0x37, 0x80, 0x89, 0xA9, 0xA9, 0xA9, 0x9B, 0x74, 0x24, 0x90,
+    0x8A, 0xA9, 0x9A, 0xBA, 0x2A, 0x77, 0x01, 0x98, 0x98, 0x99, 0x99, 0xAA, 0x50, 0x36, 0x91, 0x99,
+    0x99, 0xAA, 0xB9, 0x8B, 0x75, 0x14, 0x98, 0x98, 0xA9, 0x99, 0xAA, 0x3A, 0x67, 0x01, 0x98, 0x99,
+    0x99, 0xA9, 0x9A, 0x70, 0x25, 0x80, 0x99, 0x99, 0x9A, 0xAA, 0x8A, 0x66, 0x13, 0x98, 0x8A, 0xAA,
+    0xA9, 0xBA, 0x49, 0x57, 0x01, 0x99, 0x98, 0x9A, 0xA9, 0xAA, 0x72, 0x25, 0x91, 0x99, 0xA9, 0xA9,
+    0xAA, 0x0B, 0x67, 0x12, 0x98, 0x99, 0xA9, 0xA9, 0xAA, 0x59, 0x37, 0x81, 0x99, 0x99, 0xA9, 0xAA,
+    0xAB, 0x73, 0x27, 0x90, 0x89, 0x99, 0xA9, 0xA9, 0x1A, 0x66, 0x02, 0x98, 0x99, 0x99, 0x9A, 0xBA,
+    0x50, 0x37, 0x81, 0x99, 0xA9, 0xA9, 0xB9, 0x9B, 0x74, 0x15, 0x90, 0x89, 0x99, 0x9A, 0xAA, 0x2A,
+    0x57, 0x02, 0x98, 0x99, 0xA9, 0x9A, 0xAB, 0x60, 0x27, 0x81, 0x99, 0x99, 0x9A, 0xA9, 0x8B, 0x74,
+    0x14, 0x90, 0x99, 0xA9, 0x99, 0xBA, 0x29, 0x67, 0x02, 0x99, 0x89, 0x9A, 0xA9, 0xAA, 0x71, 0x34,
+    0x81, 0x9A, 0xA9, 0xAA, 0xBA, 0x8B, 0x67, 0x13, 0x98, 0x99, 0xA9, 0xAA, 0xBA, 0x5A, 0x47, 0x01,
+    0x99, 0x89, 0xAA, 0x99, 0xAB, 0x72, 0x35, 0x90, 0x99, 0x99, 0xAA, 0xB9, 0x0B, 0x57, 0x23, 0x99,
+    0x99, 0xAA, 0xAA, 0xBB, 0x69, 0x37, 0x82, 0x99, 0xA9, 0x9A, 0xAA, 0xAB, 0x72, 0x27, 0x90, 0x98,
+    0x99, 0x99, 0xAA, 0x1A, 0x56, 0x13, 0x99, 0x99, 0xAA, 0xA9, 0xBB, 0x79, 0x36, 0x81, 0x99, 0x99,
+    0xAA, 0xB9, 0x9B, 0x73, 0x27, 0x90, 0x89, 0x99, 0x9A, 0xA9, 0x1A, 0x47, 0x03, 0xA8, 0x99, 0xA9,
+    0xAA, 0xBB, 0x70, 0x36, 0x91, 0x99, 0xA8, 0x9A, 0xAA, 0x9B, 0x75, 0x23, 0xA0, 0x99, 0xA9, 0xAA,
+    0xCA, 0x29, 0x57, 0x02, 0xA8, 0x98, 0xAA, 0x99, 0xBB, 0x71, 0x35, 0x91, 0x99, 0x99, 0x9B, 0xBA,
+    0x8B, 0x76, 0x13, 0x98, 0x99, 0xA9, 0xA9, 0xBA, 0x4A, 0x57, 0x01, 0x89, 0x99, 0xA9, 0x99, 0xAB,
+    0x71, 0x25, 0x91, 0x99, 0x99, 0x9A, 0xAA, 0x0B, 0x66, 0x13, 0x98, 0x99, 0xAA, 0xA9, 0xBB, 0x59,
+    0x47, 0x01, 0x99, 0x99, 0xA9, 0xA9, 0xAA, 0x72, 0x26, 0x90, 0x89, 0x99, 0x9A, 0xB9, 0x0A, 0x57,
+    0x12, 0xA8, 0x98, 0x9A, 0x9A, 0xAB, 0x59, 0x37, 0x82, 0x99, 0xA9, 0xAA, 0xA9, 0x9C, 0x73, 0x25,
+    0x90, 0x99, 0x99, 0x9A, 0xAA, 0x1B, 0x67, 0x02, 0x98, 0x99, 0x99, 0x9A, 0xAA, 0x68, 0x35, 0x82,
+    0x9A, 0xA9, 0xAA, 0xAA, 0x9C, 0x74, 0x14, 0x90, 0x99, 0x99, 0x9A, 0xB9, 0x2A, 0x67, 0x02, 0x99,
+    0x98, 0xA9, 0x99, 0xAB, 0x70, 0x34, 0x81, 0x9A, 0x99, 0x9B, 0xBA, 0x9B, 0x76, 0x13, 0x90, 0x8A,
+    0xAA, 0xA9, 0xBA, 0x3A, 0x77, 0x02, 0x99, 0x98, 0x99, 0x9A, 0xAA, 0x71, 0x34, 0x80, 0xA9, 0x99,
+    0xAA, 0xBA, 0x0B, 0x67, 0x13, 0xA8, 0x89, 0xAA, 0xA9, 0xBA, 0x49, 0x57, 0x01, 0x99, 0x98, 0x9A,
+    0xA9, 0xAA, 0x72, 0x25, 0x91, 0x99, 0xA9, 0xA9, 0xB9, 0x0B, 0x57, 0x13, 0x98, 0x9A, 0xA9, 0xAA,
+    0xBA, 0x69, 0x46, 0x01, 0x99, 0x99, 0xAA, 0xA9, 0xAA, 0x73, 0x26, 0x90, 0x99, 0xA8, 0x99, 0xAA,
+    0x1A, 0x57, 0x12, 0x99, 0x99, 0xA9, 0xA9, 0xBA, 0x68, 0x36, 0x81, 0x99, 0x99, 0xAA, 0xAA, 0x9C,
+    0x64, 0x24, 0x90, 0x99, 0x9A, 0xAA, 0xB9, 0x2B, 0x77, 0x02, 0x89, 0x99, 0x99, 0x99, 0xAA, 0x68,
+    0x35, 0x81, 0x9A, 0x99, 0xAA, 0xAA, 0x9B, 0x75, 0x14, 0x90, 0x99, 0x99, 0x9A, 0xBA, 0x29, 0x67,
+    0x02, 0x99, 0x98, 0x9A, 0x99, 0xAB, 0x61, 0x26, 0x91, 0x89, 0xA9, 0xA9, 0xB9, 0x8A, 0x75, 0x23,
+    0xA8, 0x99, 0xA9, 0x9A, 0xBB, 0x49, 0x57, 0x82, 0x98, 0x99, 0x9A, 0xA9, 0x9B, 0x71, 0x26, 0x90,
+    0x89, 0x99, 0x9A, 0xA9, 0x8A, 0x56, 0x23, 0x99, 0x99, 0xAA, 0xAA, 0xBB, 0x69, 0x37, 0x82, 0x99,
+    0xA9, 0x9A, 0xAA, 0xAB, 0x72, 0x27, 0x90, 0x98, 0x99, 0x99, 0xAA, 0x1A, 0x56, 0x13, 0x99, 0x99,
+    0xAA, 0x9A, 0xBB, 0x79, 0x36, 0x81, 0x99, 0x99, 0xAA, 0xAA, 0x9B, 0x73, 0x27, 0x90, 0x89, 0x99,
+    0x9A, 0xA9, 0x1A, 0x47, 0x03, 0xA8, 0x99, 0xB9, 0xA9, 0xBB, 0x70, 0x36, 0x91, 0x99, 0x99, 0x9A,
+    0xAA, 0x9B, 0x75, 0x23, 0x90, 0x9A, 0xA9, 0xAA, 0xCA, 0x29, 0x57, 0x02, 0xA8, 0x98, 0xAA, 0xA9,
+    0xBA, 0x71, 0x35, 0x91, 0x99, 0x99, 0xAA, 0xBA, 0x8B, 0x76, 0x13, 0x98, 0x99, 0xA9, 0xA9, 0xBA,
+    0x4A, 0x57, 0x01, 0x89, 0x99, 0xA9, 0x99, 0xAB, 0x71, 0x25, 0x91, 0x99, 0x99, 0x9A, 0xAA, 0x0B,
+    0x66, 0x13, 0x98, 0x99, 0xAA, 0x9A, 0xBB, 0x59, 0x47, 0x01, 0x99, 0x99, 0xA9, 0xA9, 0xAA, 0x72,
+    0x26, 0x90, 0x89, 0x99, 0x9A, 0xB9, 0x0A, 0x47, 0x13, 0x98, 0x9A, 0xB9, 0xA9, 0xCB, 0x58, 0x46,
+    0x81, 0x99, 0x98, 0x9A, 0x9A, 0x9B, 0x73, 0x16, 0x90, 0x98, 0x99, 0x99, 0xB9, 0x19, 0x56, 0x03,
+    0xA8, 0x99, 0xA9, 0x9A, 0xBB, 0x60, 0x27, 0x01, 0x8A, 0x99, 0xAA, 0xA9, 0x9B, 0x74, 0x24, 0x98,
+    0x89, 0xA9, 0x9A, 0xB9, 0x2A, 0x67, 0x02, 0x99, 0x98, 0xA9, 0x99, 0xAA, 0x60, 0x35, 0x81, 0x9A,
+    0x99, 0xAA, 0xAA, 0x9B, 0x75, 0x14, 0x90, 0x99, 0xA9, 0x99, 0xAA, 0x3A, 0x67, 0x01, 0x98, 0x99,
+    0x99, 0x99, 0xAA, 0x61, 0x35, 0x80, 0x9A, 0xA8, 0x9A, 0xBA, 0x8A, 0x66, 0x23, 0xA8, 0x99, 0xA9,
+    0xAA, 0xCA, 0x39, 0x67, 0x01, 0x99, 0x98, 0x99, 0x99, 0xAA, 0x62, 0x25, 0x80, 0x99, 0xA9, 0xA9,
+    0xB9, 0x0A, 0x66, 0x13, 0x99, 0x99, 0xA9, 0xA9, 0xBA, 0x59, 0x37, 0x82, 0x99, 0x99, 0xAA, 0xAA,
+    0xAB, 0x73, 0x27, 0x90, 0x89, 0x99, 0x99, 0xAA, 0x09, 0x56, 0x03, 0x98, 0x99, 0xAA, 0xA9, 0xBA,
+    0x68, 0x36, 0x81, 0x99, 0xA9, 0xA9, 0xAA, 0xAB, 0x75, 0x23, 0x90, 0x9A, 0xA9, 0x9A, 0xBB, 0x2A,
+    0x77, 0x02, 0x98, 0x99, 0x99, 0x99, 0xAA, 0x50, 0x36, 0x91, 0x99, 0x99, 0xAA, 0xA9, 0x9B, 0x75,
+    0x13, 0x90, 0x99, 0x9A, 0xAA, 0xBA, 0x3A, 0x77, 0x01, 0x98, 0x89, 0x99, 0x99, 0x9A, 0x50, 0x26,
+    0x80, 0x99, 0x99, 0xA9, 0xA9, 0x8A, 0x65, 0x13, 0xA0, 0x99, 0xA9, 0xAA, 0xAA, 0x4A, 0x47, 0x82,
+    0x99, 0x99, 0xA9, 0xA9, 0xAA, 0x72, 0x25, 0x90, 0x99, 0xA8, 0xA9, 0x99, 0x0B, 0x65, 0x13, 0x99,
+    0x8A, 0x9A, 0x9A, 0xBA, 0x48, 0x37, 0x82, 0x99, 0xA9, 0xA9, 0x9A, 0xAB, 0x73, 0x23, 0x90, 0x99,
+    0xA9, 0xB9, 0xB9, 0x09, 0x73, 0x01, 0x98, 0x98, 0x90, 0x99, 0x99, 0x10, 0x13, 0x01, 0x09, 0x09
+};
+
+constexpr uint32_t CHIME_CLICK_SAMPLES = 192;
+constexpr uint8_t CHIME_CLICK_STEP_INDEX = 75;
+constexpr uint8_t CHIME_CLICK_ADPCM[96] = {
+    0x40, 0xC0, 0x9B, 0x43, 0xA2, 0xAC, 0x31, 0x84, 0xAC, 0x38, 0x13, 0xCB, 0x2A, 0x24, 0xC8, 0x0B,
+    0x24, 0xB0, 0x9B, 0x53, 0x91, 0xAC, 0x31, 0x83, 0xBC, 0x38, 0x05, 0xBA, 0x2A, 0x15, 0xB8, 0x0B,
+    0x34, 0xB8, 0x8C, 0x42, 0x91, 0xAC, 0x31, 0x83, 0xBC, 0x38, 0x05, 0xBA, 0x19, 0x15, 0xB8, 0x0B,
+    0x34, 0xC0, 0x8B, 0x42, 0x91, 0xAC, 0x41, 0x82, 0xBB, 0x38, 0x14, 0xCB, 0x19, 0x24, 0xB9, 0x0B,
+    0x34, 0xB0, 0x8D, 0x32, 0xA2, 0x9D, 0x40, 0x82, 0xBB, 0x38, 0x14, 0xDA, 0x19, 0x14, 0xB8, 0x0B,
+    0x24, 0xA0, 0x9C, 0x42, 0x91, 0x9C, 0x40, 0x01, 0xBB, 0x38, 0x14, 0xCA, 0x19, 0x14, 0xC8, 0x0A
+};
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <Preferences.h>
+#include "esp_random.h"
+
+// Append-only log of fixed-size records in NVS, for events that have to
+// reach the server even across a reboot or a long stretch offline. Each
+// record gets the next sequence number; together with logId(), which is
+// drawn at random when the log is first created, that makes a key the
+// server can deduplicate on, so a batch whose answer was lost is simply
+// sent again. Records leave the log only through trimThrough(), once the
+// server has them.
+//
+// NVS layout, one namespace per log: "id", "head" (oldest sequence still
+// held), "next" (sequence of the next append) and one blob per slot,
+// "r<seq % Capacity>". An append writes its blob before "next", so a reset
+// in between loses only that record. Everything is mirrored in RAM; NVS is
+// only written, except in begin(). A full log drops its oldest record.
+//
+// Not thread safe: one task owns the log.
+template <typename T, size_t Capacity>
+class DurableLog {
+  static_assert(Capacity > 0 && Capacity <= 100, "slot keys are r0..r99");
+
+public:
+  struct Entry {
+    uint32_t seq;
+    T record;
+  };
+
+  // Loads what an earlier boot left. False when NVS could not be opened;
+  // the log then still works, in RAM only.
+  bool begin(const char *nvsNamespace) {
+    persistent_ = prefs_.begin(nvsNamespace, false);
+    if (!persistent_) {
+      logId_ = esp_random() | 1u;
+      return false;
+    }
+
+    logId_ = prefs_.getUInt("id", 0);
+    if (logId_ == 0) {
+      logId_ = esp_random() | 1u;
+      prefs_.clear();
+      prefs_.putUInt("id", logId_);
+    }
+    head_ = prefs_.getUInt("head", 1);
+    next_ = prefs_.getUInt("next", head_);
+    if (next_ - head_ > Capacity) {
+      head_ = next_ - Capacity;
+    }
+
+    // Stop at the first slot that does not hold the record expected there
+    // (interrupted append, or a record layout from older firmware).
+    count_ = 0;
+    while (head_ + count_ != next_) {
+      Entry &entry = entries_[slot(head_ + count_)];
+      char key[8];
+      slotKey(head_ + count_, key);
+      if (prefs_.getBytesLength(key) != sizeof(Entry) ||
+          prefs_.getBytes(key, &entry, sizeof(Entry)) != sizeof(Entry) ||
+          entry.seq != head_ + count_) {
+        next_ = head_ + count_;
+        prefs_.putUInt("next", next_);
+        break;
+      }
+      ++count_;
+    }
+    return true;
+  }
+
+  // Stores record under the next sequence number and returns it.
+  uint32_t append(const T &record) {
+    if (count_ == Capacity) {
+      ++dropped_;
+      ++head_;
+      --count_;
+      writeHead();
+    }
+
+    const uint32_t seq = next_++;
+    Entry &entry = entries_[slot(seq)];
+    entry.seq = seq;
+    entry.record = record;
+    ++count_;
+    if (persistent_) {
+      char key[8];
+      slotKey(seq, key);
+      prefs_.putBytes(key, &entry, sizeof(Entry));
+      prefs_.putUInt("next", next_);
+    }
+    return seq;
+  }
+
+  // Forgets every record up to and including seq.
+  void trimThrough(uint32_t seq) {
+    if (static_cast<int32_t>(seq - head_) < 0) {
+      return;
+    }
+    const size_t drop = seq - head_ + 1 < count_ ? seq - head_ + 1 : count_;
+    head_ += drop;
+    count_ -= drop;
+    writeHead();
+  }
+
+  size_t size() const { return count_; }
+  bool empty() const { return count_ == 0; }
+  // Oldest first.
+  const Entry &at(size_t index) const { return entries_[slot(head_ + index)]; }
+
+  uint32_t logId() const { return logId_; }
+  // Records dropped to make room since boot.
+  uint32_t dropped() const { return dropped_; }
+  bool persistent() const { return persistent_; }
+
+private:
+  static size_t slot(uint32_t seq) { return seq % Capacity; }
+  static void slotKey(uint32_t seq, char *key) { snprintf(key, 8, "r%u", (unsigned)slot(seq)); }
+
+  void writeHead() {
+    if (persistent_) {
+      prefs_.putUInt("head", head_);
+    }
+  }
+
+  Preferences prefs_;
+  bool persistent_ = false;
+  uint32_t logId_ = 0;
+  uint32_t head_ = 1;
+  uint32_t next_ = 1;
+  size_t count_ = 0;
+  uint32_t dropped_ = 0;
+  Entry entries_[Capacity] = {};
+};
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+// Text built in a char array of Capacity bytes, terminator included, for
+// strings put together on every pass where String would go to the heap.
+// An append that does not fit is cut short and sets overflowed(), so a
+// caller can refuse to use a truncated URL instead of sending it.
+template <size_t Capacity>
+class FixedString {
+  static_assert(Capacity > 1, "FixedString needs room for text");
+
+public:
+  FixedString() { clear(); }
+  explicit FixedString(const char *text) {
+    clear();
+    append(text);
+  }
+
+  void clear() {
+    length_ = 0;
+    overflowed_ = false;
+    text_[0] = '\0';
+  }
+
+  FixedString &append(const char *text) { return append(text, text ? strlen(text) : 0); }
+
+  FixedString &append(const char *text, size_t length) {
+    const size_t room = Capacity - 1 - length_;
+    if (length > room) {
+      length = room;
+      overflowed_ = true;
+    }
+    memcpy(text_ + length_, text, length);
+    length_ += length;
+    text_[length_] = '\0';
+    return *this;
+  }
+
+  FixedString &appendf(const char *format, ...) __attribute__((format(printf, 2, 3))) {
+    va_list args;
+    va_start(args, format);
+    const int written = vsnprintf(text_ + length_, Capacity - length_, format, args);
+    va_end(args);
+    if (written < 0) {
+      text_[length_] = '\0';
+      overflowed_ = true;
+    } else if (static_cast<size_t>(written) >= Capacity - length_) {
+      length_ = Capacity - 1;
+      overflowed_ = true;
+    } else {
+      length_ += written;
+    }
+    return *this;
+  }
+
+  const char *c_str() const { return text_; }
+  size_t length() const { return length_; }
+  bool empty() const { return length_ == 0; }
+  bool overflowed() const { return overflowed_; }
+  static constexpr size_t capacity() { return Capacity - 1; }
+
+private:
+  char text_[Capacity];
+  size_t length_;
+  bool overflowed_;
+};
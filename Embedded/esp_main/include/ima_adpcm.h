@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stdint.h>
+
+// Decoder for 4-bit IMA ADPCM, the format tools/make_chime_clips.py
+// writes: mono, no block headers, the stream starting from a predictor of
+// 0 at a step index given with the clip, two samples per byte, low nibble
+// first. Each sample is a table lookup, a few shifts and adds, and a clamp.
+class ImaAdpcmDecoder {
+public:
+  void reset(uint8_t stepIndex = 0) {
+    predictor_ = 0;
+    index_ = stepIndex > 88 ? 88 : stepIndex;
+  }
+
+  int16_t decode(uint8_t nibble) {
+    static constexpr int8_t INDEX_STEP[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+    static constexpr int16_t STEP_SIZE[89] = {
+        7,     8,     9,     10,    11,    12,    13,    14,    16,    17,    19,    21,    23,
+        25,    28,    31,    34,    37,    41,    45,    50,    55,    60,    66,    73,    80,
+        88,    97,    107,   118,   130,   143,   157,   173,   190,   209,   230,   253,   279,
+        307,   337,   371,   408,   449,   494,   544,   598,   658,   724,   796,   876,   963,
+        1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,  2272,  2499,  2749,  3024,  3327,
+        3660,  4026,  4428,  4871,  5358,  5894,  6484,  7132,  7845,  8630,  9493,  10442, 11487,
+        12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+    };
+
+    const int32_t step = STEP_SIZE[index_];
+    int32_t delta = step >> 3;
+    if (nibble & 4) {
+      delta += step;
+    }
+    if (nibble & 2) {
+      delta += step >> 1;
+    }
+    if (nibble & 1) {
+      delta += step >> 2;
+    }
+
+    int32_t predictor = predictor_ + ((nibble & 8) ? -delta : delta);
+    predictor_ = predictor > 32767 ? 32767 : (predictor < -32768 ? -32768 : predictor);
+
+    const int index = index_ + INDEX_STEP[nibble & 7];
+    index_ = static_cast<uint8_t>(index < 0 ? 0 : (index > 88 ? 88 : index));
+    return static_cast<int16_t>(predictor_);
+  }
+
+private:
+  int32_t predictor_ = 0;
+  uint8_t index_ = 0;
+};
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <ArduinoJson.h>
+
+// ArduinoJson allocator that hands out memory from one fixed buffer, for
+// documents that live no longer than a request. Allocation bumps a
+// pointer; a Scope put on the stack before the documents gives everything
+// back when it goes out of scope, so the heap never sees a request's
+// documents and is never fragmented by them. Freeing or resizing the most
+// recent block happens in place (ArduinoJson shrinks its last pool and
+// string after parsing); anything else freed waits for its scope.
+//
+// When the buffer is full allocate() returns nullptr, which ArduinoJson
+// reports as NoMemory or overflowed(); failures() counts them.
+//
+// Not thread safe: one task owns the arena.
+template <size_t Capacity>
+class JsonArena : public ArduinoJson::Allocator {
+public:
+  // Marks the arena on construction and rolls it back on destruction.
+  // Scopes nest; documents must be declared after their scope.
+  class Scope {
+  public:
+    explicit Scope(JsonArena &arena) : arena_(arena), top_(arena.top_), last_(arena.last_) {}
+    ~Scope() {
+      arena_.top_ = top_;
+      arena_.last_ = last_;
+    }
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+  private:
+    JsonArena &arena_;
+    size_t top_;
+    size_t last_;
+  };
+
+  void *allocate(size_t size) override {
+    const size_t needed = HEADER + roundUp(size);
+    if (needed > Capacity - top_) {
+      ++failures_;
+      return nullptr;
+    }
+    last_ = top_;
+    top_ += needed;
+    if (top_ > highWater_) {
+      highWater_ = top_;
+    }
+    setSize(last_, size);
+    return buffer_ + last_ + HEADER;
+  }
+
+  void deallocate(void *ptr) override {
+    if (ptr != nullptr && offsetOf(ptr) == last_) {
+      top_ = last_;
+      last_ = NONE;
+    }
+  }
+
+  void *reallocate(void *ptr, size_t newSize) override {
+    if (ptr == nullptr) {
+      return allocate(newSize);
+    }
+    const size_t block = offsetOf(ptr);
+    const size_t oldSize = sizeOf(block);
+    if (block == last_) {
+      const size_t needed = HEADER + roundUp(newSize);
+      if (needed > Capacity - block) {
+        ++failures_;
+        return nullptr;
+      }
+      top_ = block + needed;
+      if (top_ > highWater_) {
+        highWater_ = top_;
+      }
+      setSize(block, newSize);
+      return ptr;
+    }
+    if (newSize <= oldSize) {
+      setSize(block, newSize);
+      return ptr;
+    }
+    void *moved = allocate(newSize);
+    if (moved != nullptr) {
+      memcpy(moved, ptr, oldSize);
+    }
+    return moved;
+  }
+
+  // Bytes in use right now, and the most ever in use at once.
+  size_t used() const { return top_; }
+  size_t highWater() const { return highWater_; }
+  uint32_t failures() const { return failures_; }
+  static constexpr size_t capacity() { return Capacity; }
+
+private:
+  static constexpr size_t ALIGN = alignof(max_align_t);
+  // Each block starts with its size, padded so the block stays aligned.
+  static constexpr size_t HEADER = (sizeof(size_t) + ALIGN - 1) / ALIGN * ALIGN;
+  static constexpr size_t NONE = ~static_cast<size_t>(0);
+
+  static size_t roundUp(size_t size) { return (size + ALIGN - 1) / ALIGN * ALIGN; }
+
+  size_t offsetOf(void *ptr) const { return static_cast<uint8_t *>(ptr) - buffer_ - HEADER; }
+  size_t sizeOf(size_t block) const {
+    size_t size;
+    memcpy(&size, buffer_ + block, sizeof(size));
+    return size;
+  }
+  void setSize(size_t block, size_t size) { memcpy(buffer_ + block, &size, sizeof(size)); }
+
+  alignas(max_align_t) uint8_t buffer_[Capacity];
+  size_t top_ = 0;
+  size_t last_ = NONE;
+  size_t highWater_ = 0;
+  uint32_t failures_ = 0;
+};
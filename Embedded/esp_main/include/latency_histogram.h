@@ -0,0 +1,81 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Counts of durations in fixed millisecond buckets. The bounds are the
+// same on every device and in the backend, so histograms from a whole
+// fleet add up bucket by bucket and percentiles come from the sum, which
+// averages of averages cannot give. Bucket i counts durations below
+// BOUNDS_MS[i] and at least the bound before it; the last bucket counts
+// everything from the last bound up.
+//
+// Counts only grow; since() gives what was added after an earlier copy,
+// for uploading each sample once. Plain data, so a copy can go through a
+// Seqlock to another task. Not thread safe by itself.
+class LatencyHistogram {
+public:
+  static constexpr size_t BUCKETS = 14;
+  static constexpr uint32_t BOUNDS_MS[BUCKETS - 1] = {1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000};
+
+  void recordMicros(uint32_t micros) {
+    size_t bucket = 0;
+    while (bucket < BUCKETS - 1 && micros >= BOUNDS_MS[bucket] * 1000) {
+      ++bucket;
+    }
+    ++counts_[bucket];
+  }
+
+  void recordMillis(uint32_t millis) {
+    recordMicros(millis < UINT32_MAX / 1000 ? millis * 1000 : UINT32_MAX);
+  }
+
+  uint32_t count(size_t bucket) const { return bucket < BUCKETS ? counts_[bucket] : 0; }
+
+  uint32_t total() const {
+    uint32_t sum = 0;
+    for (uint32_t count : counts_) {
+      sum += count;
+    }
+    return sum;
+  }
+
+  // Buckets up to the last non-empty one; the rest need not be sent.
+  size_t usedBuckets() const {
+    size_t used = BUCKETS;
+    while (used > 0 && counts_[used - 1] == 0) {
+      --used;
+    }
+    return used;
+  }
+
+  // Upper bound in ms of the bucket the percent-th percentile falls in,
+  // UINT32_MAX for the last bucket and 0 when nothing was recorded.
+  uint32_t percentileMs(uint8_t percent) const {
+    const uint32_t samples = total();
+    if (samples == 0) {
+      return 0;
+    }
+    // The rank of the percentile, rounded up so p100 is the slowest.
+    const uint32_t rank = static_cast<uint32_t>((static_cast<uint64_t>(samples) * percent + 99) / 100);
+    uint32_t seen = 0;
+    for (size_t bucket = 0; bucket < BUCKETS - 1; ++bucket) {
+      seen += counts_[bucket];
+      if (seen >= rank && seen > 0) {
+        return BOUNDS_MS[bucket];
+      }
+    }
+    return UINT32_MAX;
+  }
+
+  LatencyHistogram since(const LatencyHistogram &earlier) const {
+    LatencyHistogram added;
+    for (size_t bucket = 0; bucket < BUCKETS; ++bucket) {
+      added.counts_[bucket] = counts_[bucket] - earlier.counts_[bucket];
+    }
+    return added;
+  }
+
+private:
+  uint32_t counts_[BUCKETS] = {};
+};
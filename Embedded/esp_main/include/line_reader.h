@@ -0,0 +1,56 @@
+#pragma once
+
+#include <ctype.h>
+#include <stddef.h>
+
+// Assembles text lines from bytes as they arrive, without blocking or
+// allocating. feed() returns true when a line is complete; line() then
+// holds it with surrounding whitespace trimmed, until the next feed().
+// "\n" ends a line and "\r" is ignored, so CRLF monitors work too. A line
+// longer than Capacity - 1 is still reported, cut short, with
+// overflowed() set.
+template <size_t Capacity>
+class LineReader {
+  static_assert(Capacity > 1, "LineReader needs room for a line");
+
+public:
+  bool feed(char c) {
+    if (complete_) {
+      length_ = 0;
+      overflowed_ = false;
+      complete_ = false;
+    }
+    if (c == '\r') {
+      return false;
+    }
+    if (c != '\n') {
+      if (length_ + 1 < Capacity) {
+        line_[length_++] = c;
+      } else {
+        overflowed_ = true;
+      }
+      return false;
+    }
+
+    while (length_ > 0 && isspace(static_cast<unsigned char>(line_[length_ - 1]))) {
+      --length_;
+    }
+    line_[length_] = '\0';
+    start_ = 0;
+    while (isspace(static_cast<unsigned char>(line_[start_]))) {
+      ++start_;
+    }
+    complete_ = true;
+    return true;
+  }
+
+  const char *line() const { return complete_ ? line_ + start_ : ""; }
+  bool overflowed() const { return overflowed_; }
+
+private:
+  char line_[Capacity] = {};
+  size_t length_ = 0;
+  size_t start_ = 0;
+  bool overflowed_ = false;
+  bool complete_ = false;
+};
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Deadline scheduler for one task's work items. Each item is registered
+// once under a small id and has at most one pending deadline; a periodic
+// item schedules itself again when it runs. runDue() runs every item whose
+// deadline has passed, earliest first, and returns how long the caller may
+// sleep before the next one is due, so the caller can block on its
+// notifications instead of polling.
+//
+// How late each item ran past its deadline goes into a log2 histogram:
+// bucket 0 counts runs less than 1 ms late, bucket n (n >= 1) runs
+// 2^(n-1) to 2^n - 1 ms late, and the last bucket everything beyond.
+//
+// Times are millis() values; deadlines more than ~24 days out wrap.
+// Not thread safe: only the owning task may call it.
+template <size_t MaxItems>
+class LoopScheduler {
+  static_assert(MaxItems > 0 && MaxItems < 255, "ids are uint8_t");
+
+public:
+  using Callback = void (*)();
+  // Told how late each run was, for statistics kept outside the scheduler.
+  using LatenessHook = void (*)(uint8_t id, unsigned long lateMs);
+  static constexpr size_t LATENESS_BUCKETS = 8;
+
+  struct Stats {
+    uint32_t runs;
+    uint32_t worstLateMs;
+    uint32_t lateness[LATENESS_BUCKETS];
+  };
+
+  void add(uint8_t id, const char *name, Callback callback) {
+    if (id < MaxItems) {
+      items_[id].name = name;
+      items_[id].callback = callback;
+    }
+  }
+
+  // Replaces any pending deadline.
+  void runAt(uint8_t id, unsigned long at) {
+    if (id < MaxItems) {
+      items_[id].dueAt = at;
+      items_[id].pending = true;
+    }
+  }
+
+  // Like runAt(), but never pushes a pending deadline later.
+  void runBy(uint8_t id, unsigned long at) {
+    if (id < MaxItems && (!items_[id].pending || before(at, items_[id].dueAt))) {
+      runAt(id, at);
+    }
+  }
+
+  void cancel(uint8_t id) {
+    if (id < MaxItems) {
+      items_[id].pending = false;
+    }
+  }
+
+  bool pending(uint8_t id) const { return id < MaxItems && items_[id].pending; }
+
+  void setLatenessHook(LatenessHook hook) { latenessHook_ = hook; }
+
+  // Runs what is due by clock(), re-reading it after each item so one that
+  // becomes due meanwhile runs in the same call. Returns the ms until the
+  // next deadline, at most maxIdleMs.
+  unsigned long runDue(unsigned long (*clock)(), unsigned long maxIdleMs) {
+    for (;;) {
+      const unsigned long now = clock();
+      Item *next = earliest();
+      if (next == nullptr) {
+        return maxIdleMs;
+      }
+      if (before(now, next->dueAt)) {
+        const unsigned long idleMs = next->dueAt - now;
+        return idleMs < maxIdleMs ? idleMs : maxIdleMs;
+      }
+
+      next->pending = false;
+      record(next->stats, now - next->dueAt);
+      if (latenessHook_ != nullptr) {
+        latenessHook_(static_cast<uint8_t>(next - items_), now - next->dueAt);
+      }
+      next->callback();
+    }
+  }
+
+  const char *name(uint8_t id) const { return id < MaxItems ? items_[id].name : nullptr; }
+  const Stats &stats(uint8_t id) const { return items_[id < MaxItems ? id : 0].stats; }
+  void resetStats() {
+    for (Item &item : items_) {
+      item.stats = {};
+    }
+  }
+
+private:
+  struct Item {
+    const char *name = nullptr;
+    Callback callback = nullptr;
+    unsigned long dueAt = 0;
+    bool pending = false;
+    Stats stats = {};
+  };
+
+  static bool before(unsigned long a, unsigned long b) { return static_cast<long>(a - b) < 0; }
+
+  Item *earliest() {
+    Item *best = nullptr;
+    for (Item &item : items_) {
+      if (item.pending && item.callback != nullptr && (best == nullptr || before(item.dueAt, best->dueAt))) {
+        best = &item;
+      }
+    }
+    return best;
+  }
+
+  static void record(Stats &stats, unsigned long lateMs) {
+    size_t bucket = 0;
+    while (bucket + 1 < LATENESS_BUCKETS && lateMs >= (1ul << bucket)) {
+      ++bucket;
+    }
+    ++stats.lateness[bucket];
+    ++stats.runs;
+    if (lateMs > stats.worstLateMs) {
+      stats.worstLateMs = static_cast<uint32_t>(lateMs);
+    }
+  }
+
+  Item items_[MaxItems];
+  LatenessHook latenessHook_ = nullptr;
+};
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+#include <type_traits>
+
+// Latest-value slot for handing a struct from exactly one writer task to
+// any number of readers on either core. write() never waits. read() waits
+// only while a write() is copying, and then just retries; it never sees
+// half of one write and half of another. Each write() bumps version(), so
+// a reader can tell cheaply whether there is anything new.
+//
+// The value is stored as relaxed atomic words between the sequence
+// updates, so concurrent access is well defined rather than a data race
+// that merely happens to work.
+template <typename T>
+class Seqlock {
+  static_assert(std::is_trivially_copyable<T>::value, "Seqlock copies T bytewise");
+
+public:
+  // Writer side.
+  void write(const T &value) {
+    uint32_t buffer[WORDS] = {};
+    memcpy(buffer, &value, sizeof(T));
+
+    const uint32_t sequence = sequence_.load(std::memory_order_relaxed);
+    sequence_.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < WORDS; ++i) {
+      words_[i].store(buffer[i], std::memory_order_relaxed);
+    }
+    sequence_.store(sequence + 2, std::memory_order_release);
+  }
+
+  // Reader side. Returns the version that was read; 0 is the
+  // value-initialised T from before the first write().
+  uint32_t read(T &value) const {
+    uint32_t buffer[WORDS];
+    for (;;) {
+      const uint32_t before = sequence_.load(std::memory_order_acquire);
+      if (before & 1) {
+        continue;
+      }
+      for (size_t i = 0; i < WORDS; ++i) {
+        buffer[i] = words_[i].load(std::memory_order_relaxed);
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (sequence_.load(std::memory_order_relaxed) == before) {
+        memcpy(&value, buffer, sizeof(T));
+        return before / 2;
+      }
+    }
+  }
+
+  // Either side. The version of the latest completed write().
+  uint32_t version() const { return sequence_.load(std::memory_order_acquire) / 2; }
+
+private:
+  static constexpr size_t WORDS = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+  std::atomic<uint32_t> words_[WORDS] = {};
+  std::atomic<uint32_t> sequence_{0};
+};
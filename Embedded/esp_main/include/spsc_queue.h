@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stddef.h>
+
+#include <atomic>
+
+// Fixed-size ring for handing items from exactly one producer task to
+// exactly one consumer task. push() and pop() never block, lock or
+// allocate; each side only writes its own index. Capacity must be a power
+// of two.
+template <typename T, size_t Capacity>
+class SpscQueue {
+  static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                "SpscQueue capacity must be a power of two");
+
+public:
+  // Producer side. False (and nothing copied) when the ring is full.
+  bool push(const T &item) {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    if (head - tail_.load(std::memory_order_acquire) == Capacity) {
+      return false;
+    }
+    slots_[head & (Capacity - 1)] = item;
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side. False when there is nothing to take.
+  bool pop(T &item) {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    if (head_.load(std::memory_order_acquire) == tail) {
+      return false;
+    }
+    item = slots_[tail & (Capacity - 1)];
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Either side; only a snapshot while the other side is active.
+  size_t size() const {
+    return head_.load(std::memory_order_acquire) -
+           tail_.load(std::memory_order_acquire);
+  }
+  bool empty() const { return size() == 0; }
+
+private:
+  T slots_[Capacity];
+  std::atomic<size_t> head_{0};
+  std::atomic<size_t> tail_{0};
+};
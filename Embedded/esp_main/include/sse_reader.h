@@ -0,0 +1,215 @@
+#pragma once
+
+#include <stddef.h>
+#include <string.h>
+
+// Incremental Server-Sent Events parser. Bytes go in one at a time as they
+// come off the socket; feed() returns true when a complete event is ready
+// in event() / data(). Nothing is allocated: an event's data lines are
+// joined into a fixed buffer, and one that does not fit is still reported
+// but with overflowed() set and its data cut short.
+//
+// With chunked set, the bytes are an HTTP/1.1 chunked body and the chunk
+// framing is stripped first; a zero-size chunk ends the stream.
+template <size_t DataCapacity>
+class SseReader {
+  static_assert(DataCapacity > 1, "SseReader needs room for data");
+
+public:
+  void reset(bool chunked) {
+    chunked_ = chunked;
+    chunkState_ = ChunkState::Size;
+    chunkRemaining_ = 0;
+    finished_ = false;
+    pendingClear_ = false;
+    clearEvent();
+    clearLine();
+  }
+
+  bool feed(char c) {
+    if (finished_) {
+      return false;
+    }
+    if (!chunked_) {
+      return feedBody(c);
+    }
+
+    switch (chunkState_) {
+      case ChunkState::Size:
+        if (c == '\n') {
+          if (chunkRemaining_ == 0) {
+            finished_ = true;
+            return false;
+          }
+          chunkState_ = ChunkState::Data;
+        } else if (c == ';') {
+          chunkState_ = ChunkState::Extension;
+        } else if (c != '\r') {
+          chunkRemaining_ = chunkRemaining_ * 16 + hexValue(c);
+        }
+        return false;
+      case ChunkState::Extension:
+        if (c == '\n') {
+          chunkState_ = ChunkState::Size;
+          return feed(c);
+        }
+        return false;
+      case ChunkState::Data:
+        if (--chunkRemaining_ == 0) {
+          chunkState_ = ChunkState::DataEnd;
+        }
+        return feedBody(c);
+      case ChunkState::DataEnd:
+        // The CRLF after each chunk's data.
+        if (c == '\n') {
+          chunkState_ = ChunkState::Size;
+        }
+        return false;
+    }
+    return false;
+  }
+
+  // The server ended the stream (zero-size chunk).
+  bool finished() const { return finished_; }
+
+  // Valid after feed() returned true, until the next feed().
+  const char *event() const { return event_[0] ? event_ : "message"; }
+  const char *data() const { return data_; }
+  size_t dataLength() const { return dataLength_; }
+  bool overflowed() const { return overflowed_; }
+
+private:
+  enum class ChunkState : unsigned char { Size, Extension, Data, DataEnd };
+
+  static size_t hexValue(char c) {
+    if (c >= '0' && c <= '9') {
+      return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+      return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+      return c - 'A' + 10;
+    }
+    return 0;
+  }
+
+  void clearEvent() {
+    event_[0] = '\0';
+    eventLength_ = 0;
+    data_[0] = '\0';
+    dataLength_ = 0;
+    hasData_ = false;
+    overflowed_ = false;
+  }
+
+  void clearLine() {
+    field_[0] = '\0';
+    fieldLength_ = 0;
+    inValue_ = false;
+    skipSpace_ = false;
+    comment_ = false;
+    lineStart_ = true;
+  }
+
+  void appendData(char c) {
+    if (dataLength_ + 1 < DataCapacity) {
+      data_[dataLength_++] = c;
+      data_[dataLength_] = '\0';
+    } else {
+      overflowed_ = true;
+    }
+  }
+
+  // One byte of the event stream itself.
+  bool feedBody(char c) {
+    if (pendingClear_) {
+      clearEvent();
+      pendingClear_ = false;
+    }
+    if (c == '\r') {
+      return false;
+    }
+
+    if (c == '\n') {
+      const bool blank = lineStart_;
+      clearLine();
+      if (!blank) {
+        return false;
+      }
+      // A blank line dispatches whatever data lines came before it.
+      if (!hasData_) {
+        clearEvent();
+        return false;
+      }
+      // Events stay readable until the next feed() starts a new one.
+      pendingClear_ = true;
+      return true;
+    }
+
+    if (lineStart_) {
+      lineStart_ = false;
+      comment_ = c == ':';
+    }
+    if (comment_) {
+      return false;
+    }
+
+    if (!inValue_) {
+      if (c == ':') {
+        inValue_ = true;
+        skipSpace_ = true;
+        if (isField("data")) {
+          // Each data line after the first is joined with a newline.
+          if (hasData_) {
+            appendData('\n');
+          }
+          hasData_ = true;
+        } else if (isField("event")) {
+          eventLength_ = 0;
+          event_[0] = '\0';
+        }
+      } else if (fieldLength_ + 1 < sizeof(field_)) {
+        field_[fieldLength_++] = c;
+        field_[fieldLength_] = '\0';
+      }
+      return false;
+    }
+
+    if (skipSpace_) {
+      skipSpace_ = false;
+      if (c == ' ') {
+        return false;
+      }
+    }
+    if (isField("data")) {
+      appendData(c);
+    } else if (isField("event") && eventLength_ + 1 < sizeof(event_)) {
+      event_[eventLength_++] = c;
+      event_[eventLength_] = '\0';
+    }
+    return false;
+  }
+
+  bool isField(const char *name) const { return strcmp(field_, name) == 0; }
+
+  bool chunked_ = false;
+  ChunkState chunkState_ = ChunkState::Size;
+  size_t chunkRemaining_ = 0;
+  bool finished_ = false;
+
+  char field_[8] = {};
+  size_t fieldLength_ = 0;
+  bool inValue_ = false;
+  bool skipSpace_ = false;
+  bool comment_ = false;
+  bool lineStart_ = true;
+
+  char event_[24] = {};
+  size_t eventLength_ = 0;
+  char data_[DataCapacity] = {};
+  size_t dataLength_ = 0;
+  bool hasData_ = false;
+  bool overflowed_ = false;
+  bool pendingClear_ = false;
+};
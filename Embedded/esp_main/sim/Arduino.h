@@ -0,0 +1,90 @@
+// Host stand-in for the ESP32 Arduino core, just enough of it for the
+// display libraries (and later main.cc) to compile and run on Linux.
+// Time is virtual: it only advances through delay() and bus traffic, so
+// repeated runs report identical numbers. Build with -DARDUINO=... -DESP32
+// on the command line: some libraries test ARDUINO before including this.
+#pragma once
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "pgmspace.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#ifndef CONFIG_IDF_TARGET_ESP32
+#define CONFIG_IDF_TARGET_ESP32 1
+#endif
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+#define MSBFIRST 1
+#define LSBFIRST 0
+
+typedef bool boolean;
+typedef uint8_t byte;
+typedef unsigned int word;
+
+using std::max;
+using std::min;
+
+#define constrain(amt, low, high)                                              \
+  ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+// Port-register pin access as Adafruit BusIO expects it on ESP32. Nothing
+// here drives sim::spiBus(); only code that uses digitalWrite() is seen.
+extern volatile uint32_t simPortRegister;
+#define digitalPinToPort(pin) (0)
+#define digitalPinToBitMask(pin) (1UL << ((pin) & 31))
+#define portOutputRegister(port) (&simPortRegister)
+#define portInputRegister(port) (&simPortRegister)
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+// SNTP start (esp32-hal-time); see esp_sntp.h. Offsets are ignored.
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char *server1,
+                const char *server2 = nullptr, const char *server3 = nullptr);
+
+#include "WString.h"
+#include "Print.h"
+#include "Stream.h"
+#include "HardwareSerial.h"
+#include "Esp.h"
+
+namespace sim {
+
+// Virtual microsecond clock behind millis()/micros() and the bus models.
+// Each FreeRTOS task has its own (sim_tasks.cc); these read and advance
+// the calling task's.
+uint64_t nowMicros();
+void advanceMicros(uint64_t us);
+// Of the calling task's time, how much it spent blocked in
+// ulTaskNotifyTake(): asleep, but ready to run the moment it is woken.
+uint64_t idleMicros();
+
+// Observer for digitalWrite(), used by the SPI bus to follow CS/DC.
+typedef void (*PinWriteHook)(uint8_t pin, uint8_t level);
+void setPinWriteHook(PinWriteHook hook);
+
+} // namespace sim
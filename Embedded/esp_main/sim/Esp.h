@@ -0,0 +1,18 @@
+// The ESP object. Cycle counts follow the virtual clock at 240 MHz, so
+// on-target benchmarks print deterministic (bus-time only) numbers here.
+#pragma once
+
+#include <stdint.h>
+
+class EspClass {
+public:
+  uint32_t getCycleCount();
+  uint32_t getCpuFreqMHz() { return 240; }
+  uint32_t getHeapSize() { return 320 * 1024; }
+  uint32_t getFreeHeap() { return 200 * 1024; }
+  uint32_t getMinFreeHeap() { return 200 * 1024; }
+  uint32_t getMaxAllocHeap() { return 110 * 1024; }
+  void restart() {}
+};
+
+extern EspClass ESP;
@@ -0,0 +1,68 @@
+// HTTPClient answering from sim::network()'s replay table instead of a
+// socket. Each request costs its route's latency on the virtual clock, plus
+// a connect when the client has no open connection. As on the target, the
+// connection stays open after end() when setReuse() allows it and the
+// server did not close it.
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "WiFi.h"
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED (-2)
+#define HTTPC_ERROR_SEND_PAYLOAD_FAILED (-3)
+#define HTTPC_ERROR_NOT_CONNECTED (-4)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+#define HTTPC_ERROR_NO_STREAM (-6)
+#define HTTPC_ERROR_NO_HTTP_SERVER (-7)
+#define HTTPC_ERROR_TOO_LESS_RAM (-8)
+#define HTTPC_ERROR_ENCODING (-9)
+#define HTTPC_ERROR_STREAM_WRITE (-10)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+class HTTPClient {
+public:
+  ~HTTPClient();
+
+  bool begin(WiFiClient &client, const String &url);
+  bool begin(const String &url);
+  void end();
+
+  void setTimeout(uint16_t timeout) { timeout_ = timeout; }
+  void setReuse(bool reuse) { reuse_ = reuse; }
+  void addHeader(const String &name, const String &value);
+  void collectHeaders(const char *headerKeys[], size_t headerKeysCount);
+  String header(const char *name);
+  bool hasHeader(const char *name);
+
+  int GET();
+  int POST(uint8_t *payload, size_t size);
+  int POST(const String &payload);
+  int sendRequest(const char *type, uint8_t *payload = nullptr, size_t size = 0);
+
+  int getSize() { return size_; }
+  String getString();
+  WiFiClient &getStream() { return *client_; }
+  WiFiClient *getStreamPtr() { return client_; }
+
+  static String errorToString(int error);
+
+private:
+  typedef std::vector<std::pair<String, String>> Headers;
+
+  WiFiClient *client_ = nullptr;
+  WiFiClient ownClient_;
+  String url_;
+  String host_;
+  uint16_t port_ = 80;
+  bool canReuse_ = false;
+  uint16_t timeout_ = 5000;
+  bool reuse_ = true;
+  int size_ = -1;
+  Headers requestHeaders_;
+  Headers responseHeaders_;
+  std::vector<String> collect_;
+};
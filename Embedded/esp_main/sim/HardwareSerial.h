@@ -0,0 +1,57 @@
+// Serial on stdout. Input comes from sim::serialInput(), so a host driver
+// can type the same commands a user would send over the monitor.
+#pragma once
+
+#include <deque>
+#include <functional>
+
+#include "Stream.h"
+
+class HardwareSerial : public Stream {
+public:
+  using OnReceiveCb = std::function<void(void)>;
+
+  void begin(unsigned long baud) { (void)baud; }
+  void end() {}
+
+  int available() override { return static_cast<int>(input_.size()); }
+  int read() override {
+    if (input_.empty()) {
+      return -1;
+    }
+    int c = static_cast<unsigned char>(input_.front());
+    input_.pop_front();
+    return c;
+  }
+  int peek() override {
+    return input_.empty() ? -1 : static_cast<unsigned char>(input_.front());
+  }
+
+  // Called after each feed(), as the target calls it from the UART task.
+  void onReceive(OnReceiveCb callback, bool onlyOnTimeout = false) {
+    (void)onlyOnTimeout;
+    onReceive_ = callback;
+  }
+
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+  using Print::write;
+
+  // Host side: queue bytes for read(), or silence the output.
+  void feed(const char *text) {
+    while (*text) {
+      input_.push_back(*text++);
+    }
+    if (onReceive_) {
+      onReceive_();
+    }
+  }
+  void setEcho(bool enabled) { echo_ = enabled; }
+
+private:
+  std::deque<char> input_;
+  bool echo_ = true;
+  OnReceiveCb onReceive_;
+};
+
+extern HardwareSerial Serial;
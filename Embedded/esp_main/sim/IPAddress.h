@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdio.h>
+
+#include "Print.h"
+#include "WString.h"
+
+class IPAddress : public Printable {
+public:
+  IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0)
+      : octets_{a, b, c, d} {}
+
+  uint8_t operator[](int index) const { return octets_[index & 3]; }
+
+  String toString() const {
+    char buffer[16];
+    snprintf(buffer, sizeof(buffer), "%u.%u.%u.%u", octets_[0], octets_[1],
+             octets_[2], octets_[3]);
+    return String(buffer);
+  }
+  size_t printTo(Print &p) const override { return p.print(toString()); }
+
+private:
+  uint8_t octets_[4];
+};
@@ -0,0 +1,29 @@
+// Arduino Preferences (NVS key/value store) on top of sim::nvs().
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+class Preferences {
+public:
+  bool begin(const char *name, bool readOnly = false,
+             const char *partitionLabel = nullptr);
+  void end() { open_ = false; }
+
+  bool clear();
+  bool remove(const char *key);
+  bool isKey(const char *key);
+
+  size_t putUInt(const char *key, uint32_t value);
+  uint32_t getUInt(const char *key, uint32_t defaultValue = 0);
+  size_t putBytes(const char *key, const void *value, size_t len);
+  size_t getBytesLength(const char *key);
+  size_t getBytes(const char *key, void *buf, size_t maxLen);
+
+private:
+  std::string namespace_;
+  bool open_ = false;
+  bool readOnly_ = false;
+};
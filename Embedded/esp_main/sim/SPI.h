@@ -0,0 +1,55 @@
+// ESP32-flavoured SPIClass that forwards everything to sim::spiBus().
+#pragma once
+
+#include "Arduino.h"
+#include "sim_spi_bus.h"
+
+#define SPI_HAS_TRANSACTION 1
+
+#define SPI_MODE0 0
+#define SPI_MODE1 1
+#define SPI_MODE2 2
+#define SPI_MODE3 3
+
+#define SPI_LSBFIRST 0
+#define SPI_MSBFIRST 1
+
+class SPISettings {
+public:
+  SPISettings(uint32_t clock = 1000000, uint8_t bitOrder = MSBFIRST,
+              uint8_t dataMode = SPI_MODE0)
+      : _clock(clock), _bitOrder(bitOrder), _dataMode(dataMode) {}
+  uint32_t _clock;
+  uint8_t _bitOrder;
+  uint8_t _dataMode;
+};
+
+class SPIClass {
+public:
+  void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1,
+             int8_t ss = -1) {
+    (void)sck;
+    (void)miso;
+    (void)mosi;
+    (void)ss;
+  }
+  void end() {}
+
+  void beginTransaction(SPISettings settings);
+  void endTransaction();
+  void setFrequency(uint32_t freq) { sim::spiBus().setClockHz(freq); }
+  void setDataMode(uint8_t mode) { (void)mode; }
+  void setBitOrder(uint8_t order) { (void)order; }
+
+  uint8_t transfer(uint8_t data);
+  uint16_t transfer16(uint16_t data);
+  void transfer(void *data, uint32_t size);
+
+  void write(uint8_t data);
+  void write16(uint16_t data);
+  void write32(uint32_t data);
+  void writeBytes(const uint8_t *data, uint32_t size);
+  void writePixels(const void *data, uint32_t size); // Swaps 16-bit words
+};
+
+extern SPIClass SPI;
@@ -0,0 +1,51 @@
+// Arduino Stream: Print plus byte input. ArduinoJson reads through it, and
+// so do the Serial and HTTP stand-ins.
+#pragma once
+
+#include "Print.h"
+#include "WString.h"
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+
+  void setTimeout(unsigned long timeout) { timeout_ = timeout; }
+  unsigned long getTimeout() const { return timeout_; }
+
+  size_t readBytes(char *buffer, size_t length) {
+    size_t count = 0;
+    while (count < length) {
+      int c = read();
+      if (c < 0) {
+        break;
+      }
+      buffer[count++] = static_cast<char>(c);
+    }
+    return count;
+  }
+  size_t readBytes(uint8_t *buffer, size_t length) {
+    return readBytes(reinterpret_cast<char *>(buffer), length);
+  }
+
+  String readStringUntil(char terminator) {
+    String result;
+    int c;
+    while ((c = read()) >= 0 && c != terminator) {
+      result += static_cast<char>(c);
+    }
+    return result;
+  }
+  String readString() {
+    String result;
+    int c;
+    while ((c = read()) >= 0) {
+      result += static_cast<char>(c);
+    }
+    return result;
+  }
+
+protected:
+  unsigned long timeout_ = 1000;
+};
@@ -0,0 +1,120 @@
+// Arduino String on top of std::string. Allocation behaviour is close
+// enough to the real one (heap-backed, grows on concatenation).
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(string_literal))
+
+class String {
+public:
+  String(const char *cstr = "") : s_(cstr ? cstr : "") {}
+  String(const char *cstr, unsigned int length) : s_(cstr, length) {}
+  String(const __FlashStringHelper *str)
+      : s_(reinterpret_cast<const char *>(str)) {}
+  String(const std::string &str) : s_(str) {}
+  explicit String(char c) : s_(1, c) {}
+  explicit String(unsigned char value, unsigned char base = 10);
+  explicit String(int value, unsigned char base = 10);
+  explicit String(unsigned int value, unsigned char base = 10);
+  explicit String(long value, unsigned char base = 10);
+  explicit String(unsigned long value, unsigned char base = 10);
+  explicit String(float value, unsigned int decimalPlaces = 2);
+  explicit String(double value, unsigned int decimalPlaces = 2);
+
+  // As on the target, assigning text reuses the buffer when it fits.
+  String &operator=(const char *cstr) {
+    s_.assign(cstr ? cstr : "");
+    return *this;
+  }
+
+  unsigned int length() const { return s_.length(); }
+  bool isEmpty() const { return s_.empty(); }
+  const char *c_str() const { return s_.c_str(); }
+  bool reserve(unsigned int size) {
+    s_.reserve(size);
+    return true;
+  }
+
+  String &operator+=(const String &rhs) {
+    s_ += rhs.s_;
+    return *this;
+  }
+  String &operator+=(const char *rhs) {
+    s_ += rhs;
+    return *this;
+  }
+  String &operator+=(char c) {
+    s_ += c;
+    return *this;
+  }
+  String &operator+=(int value) { return *this += String(value); }
+  String &operator+=(unsigned int value) { return *this += String(value); }
+  String &operator+=(long value) { return *this += String(value); }
+  String &operator+=(unsigned long value) { return *this += String(value); }
+  bool concat(const String &rhs) {
+    s_ += rhs.s_;
+    return true;
+  }
+  bool concat(const char *rhs) {
+    s_ += rhs;
+    return true;
+  }
+  bool concat(const char *rhs, unsigned int length) {
+    s_.append(rhs, length);
+    return true;
+  }
+  bool concat(char c) {
+    s_ += c;
+    return true;
+  }
+
+  friend String operator+(const String &lhs, const String &rhs) {
+    return String(lhs.s_ + rhs.s_);
+  }
+  friend String operator+(const String &lhs, const char *rhs) {
+    return String(lhs.s_ + rhs);
+  }
+  friend String operator+(const char *lhs, const String &rhs) {
+    return String(lhs + rhs.s_);
+  }
+
+  bool operator==(const String &rhs) const { return s_ == rhs.s_; }
+  bool operator==(const char *rhs) const { return s_ == rhs; }
+  bool operator!=(const String &rhs) const { return s_ != rhs.s_; }
+  bool operator!=(const char *rhs) const { return s_ != rhs; }
+  char operator[](unsigned int index) const {
+    return index < s_.length() ? s_[index] : 0;
+  }
+  char charAt(unsigned int index) const { return (*this)[index]; }
+
+  bool equals(const String &rhs) const { return s_ == rhs.s_; }
+  bool equalsIgnoreCase(const String &rhs) const;
+  bool startsWith(const String &prefix) const {
+    return s_.compare(0, prefix.s_.length(), prefix.s_) == 0;
+  }
+  bool endsWith(const String &suffix) const {
+    return s_.length() >= suffix.s_.length() &&
+           s_.compare(s_.length() - suffix.s_.length(), suffix.s_.length(),
+                      suffix.s_) == 0;
+  }
+  int indexOf(char c, unsigned int from = 0) const;
+  int indexOf(const String &str, unsigned int from = 0) const;
+  String substring(unsigned int from) const {
+    return from < s_.length() ? String(s_.substr(from)) : String();
+  }
+  String substring(unsigned int from, unsigned int to) const;
+  void trim();
+  void toLowerCase();
+  void toUpperCase();
+  long toInt() const;
+  float toFloat() const;
+
+private:
+  std::string s_;
+};
+
+typedef String StringSumHelper;
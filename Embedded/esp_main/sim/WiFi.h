@@ -0,0 +1,131 @@
+// Station-mode WiFi and the plain TCP client. The link comes up a fixed
+// (virtual) time after begin(), sooner when begin() names the channel and
+// access point; sim::network() can drop it again. onEvent() handlers are
+// kept but never called, so firmware that also polls status() still works.
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "Arduino.h"
+#include "IPAddress.h"
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED = 6,
+} wl_status_t;
+
+typedef enum {
+  WIFI_OFF = 0,
+  WIFI_STA = 1,
+  WIFI_AP = 2,
+  WIFI_AP_STA = 3,
+} wifi_mode_t;
+
+typedef enum {
+  ARDUINO_EVENT_WIFI_STA_CONNECTED = 4,
+  ARDUINO_EVENT_WIFI_STA_DISCONNECTED = 5,
+  ARDUINO_EVENT_WIFI_STA_GOT_IP = 7,
+  ARDUINO_EVENT_WIFI_STA_LOST_IP = 9,
+  ARDUINO_EVENT_MAX = 47,
+} arduino_event_id_t;
+
+typedef void (*WiFiEventCb)(arduino_event_id_t event);
+typedef size_t wifi_event_id_t;
+
+class HTTPClient;
+
+// A connection as sim::network() models it, and the response body source
+// for HTTPClient::getStream(); writes are dropped. connected() goes false
+// once the server would have closed the socket, but stays true while
+// unread body remains, as on the target. A streamed body only becomes
+// readable piece by piece, as the virtual clock reaches each piece.
+class WiFiClient : public Stream {
+public:
+  virtual ~WiFiClient() {}
+
+  int connect(IPAddress ip, uint16_t port, int32_t timeoutMs = 0);
+  int connect(const char *host, uint16_t port, int32_t timeoutMs = 0);
+
+  int available() override {
+    return static_cast<int>(readableEnd() - position_);
+  }
+  int read() override {
+    return position_ < readableEnd()
+               ? static_cast<unsigned char>(body_[position_++])
+               : -1;
+  }
+  int peek() override {
+    return position_ < readableEnd()
+               ? static_cast<unsigned char>(body_[position_])
+               : -1;
+  }
+  size_t write(uint8_t) override { return 1; }
+  size_t write(const uint8_t *, size_t size) override { return size; }
+  using Print::write;
+
+  uint8_t connected();
+  void stop() {
+    body_.clear();
+    releases_.clear();
+    position_ = 0;
+    epoch_ = 0;
+  }
+
+protected:
+  bool tls_ = false;
+
+private:
+  friend class HTTPClient;
+  size_t readableEnd() const;
+
+  std::string body_;
+  // Streamed bodies: (virtual time, body_ offset it makes readable).
+  std::vector<std::pair<uint64_t, size_t>> releases_;
+  size_t position_ = 0;
+  uint32_t epoch_ = 0;
+  uint32_t requests_ = 0;
+  uint64_t lastUsedMicros_ = 0;
+};
+
+class WiFiClass {
+public:
+  wl_status_t begin(const char *ssid, const char *passphrase = nullptr,
+                    int32_t channel = 0, const uint8_t *bssid = nullptr,
+                    bool connect = true);
+  bool disconnect(bool wifioff = false);
+  bool mode(wifi_mode_t mode) {
+    mode_ = mode;
+    return true;
+  }
+  wl_status_t status();
+  IPAddress localIP() { return IPAddress(10, 0, 0, 42); }
+  // Every name resolves to the replay server, after the DNS cost.
+  int hostByName(const char *host, IPAddress &result);
+  int8_t RSSI() { return status() == WL_CONNECTED ? -58 : 0; }
+  uint8_t *BSSID() {
+    static uint8_t bssid[6] = {0x24, 0x0a, 0xc4, 0x5e, 0x10, 0x07};
+    return status() == WL_CONNECTED ? bssid : nullptr;
+  }
+  int32_t channel() { return status() == WL_CONNECTED ? 6 : 0; }
+  wifi_event_id_t onEvent(WiFiEventCb handler,
+                          arduino_event_id_t event = ARDUINO_EVENT_MAX) {
+    (void)handler;
+    (void)event;
+    return ++lastEventId_;
+  }
+  String SSID() { return ssid_; }
+  bool setAutoReconnect(bool) { return true; }
+  bool setSleep(bool) { return true; }
+
+private:
+  wifi_mode_t mode_ = WIFI_OFF;
+  String ssid_;
+  wifi_event_id_t lastEventId_ = 0;
+};
+
+extern WiFiClass WiFi;
@@ -0,0 +1,22 @@
+// Only here so Adafruit BusIO's headers compile; nothing talks I2C.
+#pragma once
+
+#include "Arduino.h"
+
+#define I2C_BUFFER_LENGTH 128
+
+class TwoWire {
+public:
+  bool begin() { return true; }
+  bool end() { return true; }
+  void setClock(uint32_t) {}
+  void beginTransmission(uint8_t) {}
+  uint8_t endTransmission(bool = true) { return 2; }
+  size_t requestFrom(uint8_t, size_t, bool = true) { return 0; }
+  size_t write(uint8_t) { return 1; }
+  size_t write(const uint8_t *, size_t length) { return length; }
+  int available() { return 0; }
+  int read() { return -1; }
+};
+
+extern TwoWire Wire;
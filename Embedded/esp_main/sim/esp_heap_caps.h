@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_DMA (1 << 3)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_DEFAULT (1 << 12)
+
+// sim_heap.cc calls the alloc hook for every allocation it counts.
+#define CONFIG_HEAP_USE_HOOKS 1
+
+static inline void *heap_caps_malloc(size_t size, uint32_t caps) {
+  (void)caps;
+  return malloc(size);
+}
+static inline void heap_caps_free(void *ptr) { free(ptr); }
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Defined by the application when it wants to see allocations; null
+// otherwise.
+__attribute__((weak)) void esp_heap_trace_alloc_hook(void *ptr, size_t size, uint32_t caps);
+
+#ifdef __cplusplus
+}
+#endif
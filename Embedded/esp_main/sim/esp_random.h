@@ -0,0 +1,7 @@
+// Hardware RNG (ESP-IDF esp_random.h). Seeded the same way every run, so
+// runs repeat exactly.
+#pragma once
+
+#include <stdint.h>
+
+uint32_t esp_random(void);
@@ -0,0 +1,9 @@
+// SNTP time-sync notification (ESP-IDF esp_sntp.h). configTime() in the sim
+// answers at once, calling the callback with sim::network().wallClockMs().
+#pragma once
+
+#include <sys/time.h>
+
+typedef void (*sntp_sync_time_cb_t)(struct timeval *tv);
+
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback);
@@ -0,0 +1,33 @@
+// FreeRTOS task API on top of sim_tasks.cc. Each task is a host thread,
+// but only one runs at a time and each keeps its own virtual clock, the
+// way two cores each keep their own time: a task that sleeps or waits on
+// the network only moves its own clock forward. The task with the
+// earliest clock always runs next (ties keep the current one), so runs
+// stay deterministic.
+#pragma once
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+
+typedef void (*TaskFunction_t)(void *);
+typedef struct SimTask *TaskHandle_t;
+
+#define tskNO_AFFINITY 0x7FFFFFFF
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t code, const char *name,
+                                   uint32_t stackDepth, void *parameters,
+                                   UBaseType_t priority,
+                                   TaskHandle_t *createdTask, BaseType_t coreId);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+TaskHandle_t xTaskGetCurrentTaskHandle();
+const char *pcTaskGetName(TaskHandle_t task);
+BaseType_t xPortGetCoreID();
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task);
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+// From a simulated interrupt, i.e. a task standing in for hardware.
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higherPriorityTaskWoken);
+#define portYIELD_FROM_ISR(...) ((void)0)
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait);
@@ -0,0 +1,9 @@
+// Placeholder credentials for the host build. The real secrets.h is
+// untracked; if one exists in include/ or src/ it is picked up first.
+#pragma once
+
+#define WIFI_SSID "sim-network"
+#define WIFI_USERNAME "sim-user"
+#define WIFI_PASSWORD "sim-password"
+#define API_BASE_URL "https://backend.sim"
+#define WATER_USER_ID "demo"
@@ -0,0 +1,226 @@
+#include "Arduino.h"
+
+#include <ctype.h>
+
+#include "Wire.h"
+
+namespace {
+
+uint8_t pinLevels[64];
+sim::PinWriteHook pinWriteHook = nullptr;
+
+String formatInteger(unsigned long value, unsigned char base, bool negative) {
+  char buffer[8 * sizeof(long) + 2];
+  char *cursor = &buffer[sizeof(buffer) - 1];
+  *cursor = '\0';
+  if (base < 2) {
+    base = 10;
+  }
+  do {
+    unsigned long digit = value % base;
+    *--cursor = static_cast<char>(digit < 10 ? '0' + digit : 'A' + digit - 10);
+    value /= base;
+  } while (value);
+  if (negative) {
+    *--cursor = '-';
+  }
+  return String(cursor);
+}
+
+String formatFloat(double value, unsigned int decimalPlaces) {
+  char buffer[48];
+  snprintf(buffer, sizeof(buffer), "%.*f", decimalPlaces, value);
+  return String(buffer);
+}
+
+} // namespace
+
+namespace sim {
+
+void setPinWriteHook(PinWriteHook hook) { pinWriteHook = hook; }
+
+} // namespace sim
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  (void)pin;
+  (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  if (pin < sizeof(pinLevels)) {
+    pinLevels[pin] = val ? HIGH : LOW;
+  }
+  if (pinWriteHook) {
+    pinWriteHook(pin, val ? HIGH : LOW);
+  }
+}
+
+int digitalRead(uint8_t pin) {
+  return pin < sizeof(pinLevels) ? pinLevels[pin] : LOW;
+}
+
+unsigned long millis() {
+  return static_cast<unsigned long>(sim::nowMicros() / 1000);
+}
+
+unsigned long micros() { return static_cast<unsigned long>(sim::nowMicros()); }
+
+void delay(uint32_t ms) { sim::advanceMicros(static_cast<uint64_t>(ms) * 1000); }
+
+void delayMicroseconds(uint32_t us) { sim::advanceMicros(us); }
+
+void yield() {}
+
+volatile uint32_t simPortRegister = 0;
+
+TwoWire Wire;
+HardwareSerial Serial;
+EspClass ESP;
+
+uint32_t EspClass::getCycleCount() {
+  return static_cast<uint32_t>(sim::nowMicros() * 240);
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  if (echo_) {
+    fputc(c, stdout);
+  }
+  return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) {
+  if (echo_) {
+    fwrite(buffer, 1, size, stdout);
+  }
+  return size;
+}
+
+// String -------------------------------------------------------------------
+
+String::String(unsigned char value, unsigned char base)
+    : String(formatInteger(value, base, false)) {}
+String::String(int value, unsigned char base)
+    : String(value < 0 && base == 10
+                 ? formatInteger(-static_cast<long>(value), base, true)
+                 : formatInteger(static_cast<unsigned int>(value), base, false)) {}
+String::String(unsigned int value, unsigned char base)
+    : String(formatInteger(value, base, false)) {}
+String::String(long value, unsigned char base)
+    : String(value < 0 && base == 10
+                 ? formatInteger(-static_cast<unsigned long>(value), base, true)
+                 : formatInteger(static_cast<unsigned long>(value), base, false)) {}
+String::String(unsigned long value, unsigned char base)
+    : String(formatInteger(value, base, false)) {}
+String::String(float value, unsigned int decimalPlaces)
+    : String(formatFloat(value, decimalPlaces)) {}
+String::String(double value, unsigned int decimalPlaces)
+    : String(formatFloat(value, decimalPlaces)) {}
+
+bool String::equalsIgnoreCase(const String &rhs) const {
+  if (s_.length() != rhs.s_.length()) {
+    return false;
+  }
+  for (size_t i = 0; i < s_.length(); ++i) {
+    if (tolower(static_cast<unsigned char>(s_[i])) !=
+        tolower(static_cast<unsigned char>(rhs.s_[i]))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int String::indexOf(char c, unsigned int from) const {
+  size_t found = s_.find(c, from);
+  return found == std::string::npos ? -1 : static_cast<int>(found);
+}
+
+int String::indexOf(const String &str, unsigned int from) const {
+  size_t found = s_.find(str.s_, from);
+  return found == std::string::npos ? -1 : static_cast<int>(found);
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+  if (from > to) {
+    std::swap(from, to);
+  }
+  if (from >= s_.length()) {
+    return String();
+  }
+  return String(s_.substr(from, to - from));
+}
+
+void String::trim() {
+  size_t begin = 0;
+  while (begin < s_.length() && isspace(static_cast<unsigned char>(s_[begin]))) {
+    ++begin;
+  }
+  size_t end = s_.length();
+  while (end > begin && isspace(static_cast<unsigned char>(s_[end - 1]))) {
+    --end;
+  }
+  s_ = s_.substr(begin, end - begin);
+}
+
+void String::toLowerCase() {
+  for (char &c : s_) {
+    c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+  }
+}
+
+void String::toUpperCase() {
+  for (char &c : s_) {
+    c = static_cast<char>(toupper(static_cast<unsigned char>(c)));
+  }
+}
+
+long String::toInt() const { return strtol(s_.c_str(), nullptr, 10); }
+
+float String::toFloat() const { return strtof(s_.c_str(), nullptr); }
+
+// Print --------------------------------------------------------------------
+
+size_t Print::write(const uint8_t *buffer, size_t size) {
+  size_t n = 0;
+  while (size--) {
+    n += write(*buffer++);
+  }
+  return n;
+}
+
+// Same buffer as the core's: a longer line goes through malloc(), which the
+// heap count sees.
+size_t Print::printf(const char *format, ...) {
+  char buffer[64];
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  if (length < 0) {
+    return 0;
+  }
+  if (static_cast<size_t>(length) >= sizeof(buffer)) {
+    char *big = static_cast<char *>(malloc(static_cast<size_t>(length) + 1));
+    if (big == nullptr) {
+      return 0;
+    }
+    va_start(args, format);
+    vsnprintf(big, static_cast<size_t>(length) + 1, format, args);
+    va_end(args);
+    const size_t written = write(big, static_cast<size_t>(length));
+    free(big);
+    return written;
+  }
+  return write(buffer, static_cast<size_t>(length));
+}
+
+size_t Print::print(long value, int base) {
+  return print(String(value, static_cast<unsigned char>(base)));
+}
+
+size_t Print::print(unsigned long value, int base) {
+  return print(String(value, static_cast<unsigned char>(base)));
+}
+
+size_t Print::print(double value, int digits) {
+  return print(String(value, static_cast<unsigned int>(digits)));
+}
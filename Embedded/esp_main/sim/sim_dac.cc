@@ -0,0 +1,231 @@
+// Continuous-mode DAC driver stand-in (driver/dac_continuous.h). The DMA
+// engine is a task of its own: while async writing is on it spends one
+// buffer period of virtual time per descriptor, records what that
+// descriptor held, and hands it back through on_convert_done, as the
+// interrupt on the real chip does. Descriptors play in a ring, so one the
+// firmware has not refilled plays its old contents again.
+#include "driver/dac_continuous.h"
+
+#include <stdio.h>
+
+#include <vector>
+
+#include "Arduino.h"
+#include "freertos/task.h"
+#include "sim_dac.h"
+#include "sim_heap.h"
+
+struct dac_continuous_s {
+  struct Buffer {
+    std::vector<uint8_t> bytes;
+    bool fresh = false;
+    bool playedSinceStart = false;
+  };
+
+  dac_continuous_config_t config = {};
+  dac_event_callbacks_t callbacks = {};
+  void *userData = nullptr;
+  bool enabled = false;
+  bool writing = false;
+  std::vector<Buffer> buffers;
+  size_t next = 0;
+  TaskHandle_t task = nullptr;
+};
+
+namespace {
+
+#if CONFIG_DAC_DMA_AUTO_16BIT_ALIGN
+constexpr size_t BYTES_PER_SAMPLE = 2;
+#else
+constexpr size_t BYTES_PER_SAMPLE = 1;
+#endif
+
+void dmaTaskMain(void *parameters) {
+  dac_continuous_s *dac = static_cast<dac_continuous_s *>(parameters);
+  std::vector<uint8_t> samples;
+  for (;;) {
+    if (!dac->writing) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      continue;
+    }
+
+    const size_t index = dac->next;
+    dac->next = (index + 1) % dac->buffers.size();
+    dac_continuous_s::Buffer &buffer = dac->buffers[index];
+    const size_t count = buffer.bytes.size() / BYTES_PER_SAMPLE;
+    const uint64_t micros = count * 1000000ULL / dac->config.freq_hz;
+    sim::advanceMicros(micros);
+    if (!dac->writing) {
+      continue; // stopped halfway through this buffer
+    }
+
+    samples.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+      samples[i] = buffer.bytes[i * BYTES_PER_SAMPLE + BYTES_PER_SAMPLE - 1];
+    }
+    sim::dac().played(samples.data(), count, !buffer.fresh && buffer.playedSinceStart, micros);
+    buffer.fresh = false;
+    buffer.playedSinceStart = true;
+
+    if (dac->callbacks.on_convert_done) {
+      dac_event_data_t event = {buffer.bytes.data(), buffer.bytes.size(), buffer.bytes.size()};
+      dac->callbacks.on_convert_done(dac, &event, dac->userData);
+    }
+  }
+}
+
+} // namespace
+
+namespace sim {
+
+void Dac::played(const uint8_t *samples, size_t count, bool stale, uint64_t micros) {
+  UntrackedHeap untracked;
+  samples_.insert(samples_.end(), samples, samples + count);
+  ++counters_.buffersPlayed;
+  counters_.staleBuffers += stale ? 1 : 0;
+  counters_.playedMicros += micros;
+}
+
+bool Dac::writeWav(const char *path) const {
+  FILE *file = fopen(path, "wb");
+  if (!file) {
+    return false;
+  }
+  auto put32 = [file](uint32_t value) {
+    const uint8_t bytes[4] = {uint8_t(value), uint8_t(value >> 8), uint8_t(value >> 16), uint8_t(value >> 24)};
+    fwrite(bytes, 1, 4, file);
+  };
+  auto put16 = [file](uint16_t value) {
+    const uint8_t bytes[2] = {uint8_t(value), uint8_t(value >> 8)};
+    fwrite(bytes, 1, 2, file);
+  };
+  const uint32_t dataBytes = static_cast<uint32_t>(samples_.size());
+  fwrite("RIFF", 1, 4, file);
+  put32(36 + dataBytes);
+  fwrite("WAVEfmt ", 1, 8, file);
+  put32(16);
+  put16(1); // PCM
+  put16(1); // mono
+  put32(sampleRate_);
+  put32(sampleRate_); // bytes per second
+  put16(1);           // block align
+  put16(8);           // bits per sample, unsigned
+  fwrite("data", 1, 4, file);
+  put32(dataBytes);
+  fwrite(samples_.data(), 1, samples_.size(), file);
+  return fclose(file) == 0;
+}
+
+Dac &dac() {
+  static Dac instance;
+  return instance;
+}
+
+} // namespace sim
+
+// The driver is SDK code on the device: what it allocates is not the
+// firmware's.
+esp_err_t dac_continuous_new_channels(const dac_continuous_config_t *cont_cfg, dac_continuous_handle_t *ret_handle) {
+  sim::UntrackedHeap untracked;
+  if (!cont_cfg || !ret_handle || cont_cfg->desc_num < 2 || cont_cfg->buf_size < BYTES_PER_SAMPLE ||
+      cont_cfg->freq_hz == 0) {
+    return ESP_ERR_INVALID_ARG;
+  }
+  dac_continuous_s *dac = new dac_continuous_s;
+  dac->config = *cont_cfg;
+  dac->buffers.resize(cont_cfg->desc_num);
+  for (dac_continuous_s::Buffer &buffer : dac->buffers) {
+    buffer.bytes.assign(cont_cfg->buf_size, 0);
+  }
+  sim::dac().setSampleRate(cont_cfg->freq_hz);
+  *ret_handle = dac;
+  return ESP_OK;
+}
+
+esp_err_t dac_continuous_del_channels(dac_continuous_handle_t handle) {
+  if (!handle || handle->enabled) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  // The DMA task may still be parked on it; keep the memory.
+  return ESP_OK;
+}
+
+esp_err_t dac_continuous_enable(dac_continuous_handle_t handle) {
+  if (!handle || handle->enabled) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  handle->enabled = true;
+  return ESP_OK;
+}
+
+esp_err_t dac_continuous_disable(dac_continuous_handle_t handle) {
+  if (!handle || !handle->enabled || handle->writing) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  handle->enabled = false;
+  return ESP_OK;
+}
+
+esp_err_t dac_continuous_register_event_callback(dac_continuous_handle_t handle,
+                                                 const dac_event_callbacks_t *callbacks, void *user_data) {
+  if (!handle || handle->enabled) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  handle->callbacks = callbacks ? *callbacks : dac_event_callbacks_t{};
+  handle->userData = user_data;
+  return ESP_OK;
+}
+
+esp_err_t dac_continuous_start_async_writing(dac_continuous_handle_t handle) {
+  if (!handle || !handle->enabled || handle->writing || !handle->callbacks.on_convert_done) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  for (dac_continuous_s::Buffer &buffer : handle->buffers) {
+    buffer.fresh = false;
+    buffer.playedSinceStart = false;
+  }
+  handle->next = 0;
+  handle->writing = true;
+  sim::dac().started();
+  sim::UntrackedHeap untracked;
+  if (!handle->task) {
+    xTaskCreatePinnedToCore(dmaTaskMain, "dac dma", 0, handle, 0, &handle->task, tskNO_AFFINITY);
+  } else {
+    xTaskNotifyGive(handle->task);
+  }
+  return ESP_OK;
+}
+
+esp_err_t dac_continuous_stop_async_writing(dac_continuous_handle_t handle) {
+  if (!handle || !handle->writing) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  handle->writing = false;
+  return ESP_OK;
+}
+
+esp_err_t dac_continuous_write_asynchronously(dac_continuous_handle_t handle, uint8_t *dma_buf, size_t dma_buf_len,
+                                              const uint8_t *data, size_t data_len, size_t *bytes_loaded) {
+  if (!handle || !handle->writing || !dma_buf || !data) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  dac_continuous_s::Buffer *buffer = nullptr;
+  for (dac_continuous_s::Buffer &candidate : handle->buffers) {
+    if (candidate.bytes.data() == dma_buf) {
+      buffer = &candidate;
+    }
+  }
+  if (!buffer || dma_buf_len > buffer->bytes.size()) {
+    return ESP_ERR_INVALID_ARG;
+  }
+
+  const size_t count = data_len < dma_buf_len / BYTES_PER_SAMPLE ? data_len : dma_buf_len / BYTES_PER_SAMPLE;
+  for (size_t i = 0; i < count; ++i) {
+    dma_buf[i * BYTES_PER_SAMPLE + BYTES_PER_SAMPLE - 1] = static_cast<uint8_t>(data[i] + handle->config.offset);
+  }
+  buffer->fresh = true;
+  if (bytes_loaded) {
+    *bytes_loaded = count;
+  }
+  return ESP_OK;
+}
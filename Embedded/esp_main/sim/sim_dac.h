@@ -0,0 +1,44 @@
+// Output side of the driver/dac_continuous.h stand-in: every sample the
+// DMA played while async writing was on, and how many buffers it played
+// without the firmware having refilled them since their last turn.
+#pragma once
+
+#include <stdint.h>
+
+#include <vector>
+
+namespace sim {
+
+struct DacCounters {
+  uint32_t starts = 0;         // dac_continuous_start_async_writing() calls
+  uint32_t buffersPlayed = 0;
+  // Buffers played again with stale data because the firmware had not
+  // refilled them in time. The start-up pass over buffers that were never
+  // written does not count.
+  uint32_t staleBuffers = 0;
+  uint64_t playedMicros = 0;
+};
+
+class Dac {
+public:
+  const DacCounters &counters() const { return counters_; }
+  const std::vector<uint8_t> &samples() const { return samples_; }
+  uint32_t sampleRate() const { return sampleRate_; }
+
+  // 8-bit mono WAV of samples(); playback gaps are left out.
+  bool writeWav(const char *path) const;
+
+  // Called by the driver stand-in.
+  void setSampleRate(uint32_t hz) { sampleRate_ = hz; }
+  void started() { ++counters_.starts; }
+  void played(const uint8_t *samples, size_t count, bool stale, uint64_t micros);
+
+private:
+  DacCounters counters_;
+  std::vector<uint8_t> samples_;
+  uint32_t sampleRate_ = 0;
+};
+
+Dac &dac();
+
+} // namespace sim
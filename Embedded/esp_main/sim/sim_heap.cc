@@ -0,0 +1,125 @@
+// malloc() and friends, counted on the way to glibc's own (__libc_*). See
+// sim_heap.h. free() is left alone: only allocations are counted.
+#include "sim_heap.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <atomic>
+
+#include "esp_heap_caps.h"
+
+#if defined(__GLIBC__)
+#include <execinfo.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+std::atomic<bool> counting{false};
+std::atomic<bool> tracing{false};
+std::atomic<uint64_t> allocationCount{0};
+std::atomic<uint64_t> allocatedBytes{0};
+// Initial-exec TLS needs no allocation of its own, so it is safe in here.
+__attribute__((tls_model("initial-exec"))) thread_local int untrackedDepth = 0;
+
+void noteAllocation(void *ptr, size_t size) {
+  if (ptr == nullptr || untrackedDepth > 0 || !counting.load(std::memory_order_relaxed)) {
+    return;
+  }
+  // Whatever the hook or the trace allocate is theirs, not the caller's.
+  ++untrackedDepth;
+  allocationCount.fetch_add(1, std::memory_order_relaxed);
+  allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+  if (esp_heap_trace_alloc_hook) {
+    esp_heap_trace_alloc_hook(ptr, size, MALLOC_CAP_DEFAULT);
+  }
+#if defined(__GLIBC__)
+  if (tracing.load(std::memory_order_relaxed)) {
+    void *frames[24];
+    const int depth = backtrace(frames, 24);
+    fprintf(stderr, "heap: %zu bytes at %p\n", size, ptr);
+    backtrace_symbols_fd(frames, depth, STDERR_FILENO);
+  }
+#endif
+  --untrackedDepth;
+}
+
+} // namespace
+
+namespace sim {
+
+UntrackedHeap::UntrackedHeap() { ++untrackedDepth; }
+UntrackedHeap::~UntrackedHeap() { --untrackedDepth; }
+
+#if defined(__GLIBC__)
+bool heapCountingAvailable() { return true; }
+#else
+bool heapCountingAvailable() { return false; }
+#endif
+
+void setHeapCounting(bool on) { counting.store(on); }
+void setHeapTrace(bool on) { tracing.store(on); }
+
+HeapCounters heapCounters() {
+  HeapCounters counters;
+  counters.allocations = allocationCount.load();
+  counters.bytes = allocatedBytes.load();
+  return counters;
+}
+
+} // namespace sim
+
+#if defined(__GLIBC__)
+
+extern "C" {
+
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+void *__libc_memalign(size_t alignment, size_t size);
+
+void *malloc(size_t size) {
+  void *ptr = __libc_malloc(size);
+  noteAllocation(ptr, size);
+  return ptr;
+}
+
+void *calloc(size_t count, size_t size) {
+  void *ptr = __libc_calloc(count, size);
+  noteAllocation(ptr, count * size);
+  return ptr;
+}
+
+// Every call counts, growing in place or not: on the device's heap a
+// realloc() is an allocation too.
+void *realloc(void *ptr, size_t size) {
+  void *moved = __libc_realloc(ptr, size);
+  noteAllocation(moved, size);
+  return moved;
+}
+
+void *memalign(size_t alignment, size_t size) {
+  void *ptr = __libc_memalign(alignment, size);
+  noteAllocation(ptr, size);
+  return ptr;
+}
+
+void *aligned_alloc(size_t alignment, size_t size) { return memalign(alignment, size); }
+
+int posix_memalign(void **out, size_t alignment, size_t size) {
+  if (alignment < sizeof(void *) || (alignment & (alignment - 1)) != 0) {
+    return EINVAL;
+  }
+  void *ptr = memalign(alignment, size);
+  if (ptr == nullptr) {
+    return ENOMEM;
+  }
+  *out = ptr;
+  return 0;
+}
+
+} // extern "C"
+
+#endif
@@ -0,0 +1,38 @@
+// Heap accounting. sim_heap.cc wraps malloc(), calloc(), realloc() and the
+// aligned variants (operator new lands in them too); once counting is on,
+// every allocation outside an UntrackedHeap scope counts as the firmware's
+// own and goes to esp_heap_trace_alloc_hook, as the heap calls it on the
+// device with CONFIG_HEAP_USE_HOOKS. Stand-ins for code that is the SDK's
+// on the device (HTTPClient, WiFi, Preferences, the DAC driver) and the
+// sim's own bookkeeping open an UntrackedHeap around their insides, so what
+// is left is what main.cc asked for. Needs glibc; elsewhere nothing counts.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace sim {
+
+struct HeapCounters {
+  uint64_t allocations = 0;
+  uint64_t bytes = 0;
+};
+
+// Allocations on this thread inside the scope are not counted. Scopes nest.
+class UntrackedHeap {
+public:
+  UntrackedHeap();
+  ~UntrackedHeap();
+  UntrackedHeap(const UntrackedHeap &) = delete;
+  UntrackedHeap &operator=(const UntrackedHeap &) = delete;
+};
+
+// False where the allocator cannot be wrapped.
+bool heapCountingAvailable();
+void setHeapCounting(bool on);
+// Prints a backtrace to stderr for every counted allocation, to find
+// where one came from (addr2line -e <program> resolves the addresses).
+void setHeapTrace(bool on);
+HeapCounters heapCounters();
+
+} // namespace sim
@@ -0,0 +1,439 @@
+// Host entry point for the `sim` environment. Runs setup(), then a fixed
+// scenario of main.cc's render and fetch calls against the replayed
+// backend, and prints per-call host time, virtual time, SPI and HTTP
+// traffic. The final frame is written as a PPM.
+//
+//   esp_main_sim [--replay FILE] [--ppm FILE] [--run-ms N] [--quiet]
+//                [--latency-ms N] [--max-loop-ms N] [--keepalive-ms N]
+//                [--nvs FILE] [--wifi-drop AT_MS:OUTAGE_MS] [--wav FILE]
+//                [--max-heap-allocs N] [--heap-trace] [--check-history]
+//   esp_main_sim --stress-seqlock N
+//
+// --run-ms keeps calling loop() for N ms of virtual time afterwards, and
+// any --serial CMD is typed into Serial before that. The longest time one
+// loop() pass kept the loop task busy is reported (time it slept waiting to
+// be woken does not count); with --max-loop-ms the run fails if it exceeds
+// N. --latency-ms makes every backend request take N ms (past
+// the firmware's HTTP timeout it fails instead). --keepalive-ms sets how long
+// the server keeps an idle connection open; 0 closes after every response.
+// --nvs loads the NVS store from FILE before setup() and saves it back at
+// the end, so consecutive runs see the same flash, as across a reset.
+// --wifi-drop takes the WiFi link down AT_MS into the --run-ms phase, with
+// the access point out of reach for OUTAGE_MS. --wav writes what the DAC
+// played as a WAV file.
+//
+// Heap allocations made by firmware code during the --run-ms phase are
+// counted (see sim_heap.h); by then every job has run once, so the count
+// should be 0. --max-heap-allocs fails the run above N, and --heap-trace
+// prints a backtrace for each one.
+//
+// --check-history, after the run, pushes more samples than the history
+// chart has rows, with a full repaint part way through, and compares the
+// chart's rows on the glass (scrolling applied) with the last samples in
+// order, oldest at the top. Any mismatch fails the run.
+//
+// --stress-seqlock runs no firmware: one host thread writes N values
+// through the Seqlock that carries main.cc's device state while another
+// reads as fast as it can, on real cores rather than the simulated tasks.
+// Every word of a value is the same counter, so a read that mixed two
+// writes shows up as differing words. Exits non-zero on any torn read.
+// Exits non-zero when a fetch
+// fails, so CI can run it as a smoke test.
+#include <Arduino.h>
+#include <SPI.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "seqlock.h"
+
+#include "sim_dac.h"
+#include "sim_heap.h"
+#include "sim_net.h"
+#include "sim_nvs.h"
+#include "sim_panel.h"
+#include "sim_spi_bus.h"
+
+// From src/main.cc.
+void setup();
+void loop();
+void renderForestUi();
+bool fetchWaterSchedule();
+bool fetchWaterSummary();
+bool pollWaterReminder();
+bool postWaterIntake(int amountMl);
+bool syncDevice();
+void drawStatus(const char *line1, const char *line2, uint16_t bg, uint16_t fg);
+void pushHistorySample(uint8_t water, uint8_t stress);
+void historyRowPixels(bool valid, uint8_t water, uint8_t stress, uint16_t *line);
+
+namespace {
+
+// Same wiring as main.cc's TFT_CS / TFT_A0.
+constexpr int8_t SIM_TFT_CS = 5;
+constexpr int8_t SIM_TFT_DC = 2;
+// Same as main.cc's HISTORY_CHART_Y / HISTORY_CHART_ROWS.
+constexpr int16_t SIM_HISTORY_Y = 128;
+constexpr uint8_t SIM_HISTORY_ROWS = 32;
+
+struct CallStats {
+  std::string name;
+  uint32_t calls = 0;
+  uint32_t failures = 0;
+  double hostMicros = 0;
+  uint64_t virtualMicros = 0;
+  uint64_t busMicros = 0;
+  uint32_t transactions = 0;
+  uint32_t commands = 0;
+  uint32_t dataBytes = 0;
+  uint32_t pixels = 0;
+  size_t httpRequests = 0;
+};
+
+sim::St7735Panel panel;
+std::vector<CallStats> stats;
+
+CallStats &statsFor(const char *name) {
+  for (CallStats &entry : stats) {
+    if (entry.name == name) {
+      return entry;
+    }
+  }
+  stats.push_back(CallStats());
+  stats.back().name = name;
+  return stats.back();
+}
+
+template <typename Fn> bool profile(const char *name, Fn fn) {
+  const sim::SpiCounters before = sim::spiBus().counters();
+  const uint64_t virtualStart = sim::nowMicros();
+  const size_t httpStart = sim::network().log().size();
+  const uint32_t pixelStart = panel.pixelsWritten();
+  const auto hostStart = std::chrono::steady_clock::now();
+
+  const bool ok = fn();
+
+  const auto hostEnd = std::chrono::steady_clock::now();
+  sim::UntrackedHeap untracked;
+  const sim::SpiCounters &after = sim::spiBus().counters();
+  CallStats &entry = statsFor(name);
+  ++entry.calls;
+  entry.failures += ok ? 0 : 1;
+  entry.hostMicros +=
+      std::chrono::duration<double, std::micro>(hostEnd - hostStart).count();
+  entry.virtualMicros += sim::nowMicros() - virtualStart;
+  entry.busMicros += after.busyMicros - before.busyMicros;
+  entry.transactions += after.transactions - before.transactions;
+  entry.commands += after.commands - before.commands;
+  entry.dataBytes += after.dataBytes - before.dataBytes;
+  entry.pixels += panel.pixelsWritten() - pixelStart;
+  entry.httpRequests += sim::network().log().size() - httpStart;
+  return ok;
+}
+
+void printReport() {
+  printf("\n%-20s %5s %4s %10s %10s %9s %6s %6s %8s %6s\n", "call", "calls",
+         "fail", "host us", "virt ms", "bus ms", "tx", "cmds", "bytes", "http");
+  for (const CallStats &entry : stats) {
+    const double calls = entry.calls ? entry.calls : 1;
+    printf("%-20s %5u %4u %10.1f %10.2f %9.2f %6.0f %6.0f %8.0f %6.1f\n",
+           entry.name.c_str(), entry.calls, entry.failures,
+           entry.hostMicros / calls, entry.virtualMicros / calls / 1000.0,
+           entry.busMicros / calls / 1000.0, entry.transactions / calls,
+           entry.commands / calls, entry.dataBytes / calls,
+           entry.httpRequests / calls);
+  }
+  printf("(per-call averages; virtual time includes replayed network latency)\n");
+}
+
+// About the size of main.cc's DeviceState.
+struct StressValue {
+  uint32_t words[32];
+};
+
+int stressSeqlock(uint32_t writes) {
+  static Seqlock<StressValue> slot;
+  std::atomic<bool> done{false};
+  uint64_t reads = 0;
+  uint64_t torn = 0;
+  uint64_t backwards = 0;
+
+  std::thread reader([&] {
+    uint32_t lastVersion = 0;
+    StressValue value;
+    while (!done.load(std::memory_order_acquire)) {
+      const uint32_t version = slot.read(value);
+      ++reads;
+      for (uint32_t word : value.words) {
+        if (word != value.words[0]) {
+          ++torn;
+          break;
+        }
+      }
+      // Version n holds counter n, and versions never go back.
+      if (version < lastVersion || value.words[0] != version) {
+        ++backwards;
+      }
+      lastVersion = version;
+    }
+  });
+
+  const auto start = std::chrono::steady_clock::now();
+  StressValue value;
+  for (uint32_t n = 1; n <= writes; ++n) {
+    for (uint32_t &word : value.words) {
+      word = n;
+    }
+    slot.write(value);
+  }
+  done.store(true, std::memory_order_release);
+  reader.join();
+  const double seconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  printf("seqlock: %u writes, %llu reads in %.2f s, %llu torn, %llu out of order\n",
+         writes, (unsigned long long)reads, seconds, (unsigned long long)torn,
+         (unsigned long long)backwards);
+  return torn || backwards ? 1 : 0;
+}
+
+struct HistoryValue {
+  uint8_t water;
+  uint8_t stress;
+};
+
+HistoryValue historyValue(uint32_t index) {
+  return {static_cast<uint8_t>(index * 37 % 101), static_cast<uint8_t>(index * 59 % 101)};
+}
+
+// See --check-history. Returns false, after saying where, on a mismatch.
+bool checkHistoryChart() {
+  const uint32_t before = SIM_HISTORY_ROWS - 7;
+  const uint32_t whileCleared = 10;
+  const uint32_t after = SIM_HISTORY_ROWS + 5;
+  uint32_t pushed = 0;
+  auto push = [&pushed](uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i, ++pushed) {
+      pushHistorySample(historyValue(pushed).water, historyValue(pushed).stress);
+    }
+  };
+
+  renderForestUi();
+  push(before);
+  // A status screen wipes the chart; samples keep coming in until the
+  // forest UI repaints it whole.
+  drawStatus("History check", "", 0xFFFF, 0x0000);
+  push(whileCleared);
+  renderForestUi();
+  push(after);
+
+  uint16_t expected[128];
+  for (uint8_t row = 0; row < SIM_HISTORY_ROWS; ++row) {
+    const HistoryValue value = historyValue(pushed - SIM_HISTORY_ROWS + row);
+    historyRowPixels(true, value.water, value.stress, expected);
+    for (int16_t x = 0; x < 128; ++x) {
+      const uint16_t shown = panel.pixel(x, SIM_HISTORY_Y + row);
+      if (shown != expected[x]) {
+        printf("history: row %u column %d shows %04x, expected %04x (sample %u of %u)\n",
+               row, x, shown, expected[x], pushed - SIM_HISTORY_ROWS + row, pushed);
+        return false;
+      }
+    }
+  }
+  printf("history: %u samples pushed, all %u chart rows match\n", pushed, SIM_HISTORY_ROWS);
+  return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  if (argc == 3 && std::string(argv[1]) == "--stress-seqlock") {
+    return stressSeqlock(strtoul(argv[2], nullptr, 10));
+  }
+
+  const char *replayPath = "sim/replay/backend.json";
+  const char *ppmPath = "sim_frame.ppm";
+  const char *nvsPath = nullptr;
+  const char *wavPath = nullptr;
+  unsigned long wifiDropAtMs = 0;
+  unsigned long wifiOutageMs = 0;
+  bool wifiDrop = false;
+  unsigned long runMs = 0;
+  unsigned long maxLoopMs = 0;
+  long maxHeapAllocs = -1;
+  bool heapTrace = false;
+  bool checkHistory = false;
+  std::vector<std::string> serialCommands;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "--replay" && i + 1 < argc) {
+      replayPath = argv[++i];
+    } else if (arg == "--ppm" && i + 1 < argc) {
+      ppmPath = argv[++i];
+    } else if (arg == "--run-ms" && i + 1 < argc) {
+      runMs = strtoul(argv[++i], nullptr, 10);
+    } else if (arg == "--latency-ms" && i + 1 < argc) {
+      sim::network().setForcedLatencyMs(strtoul(argv[++i], nullptr, 10));
+    } else if (arg == "--keepalive-ms" && i + 1 < argc) {
+      const unsigned long idleMs = strtoul(argv[++i], nullptr, 10);
+      sim::network().setKeepAlive(idleMs > 0, idleMs);
+    } else if (arg == "--max-loop-ms" && i + 1 < argc) {
+      maxLoopMs = strtoul(argv[++i], nullptr, 10);
+    } else if (arg == "--nvs" && i + 1 < argc) {
+      nvsPath = argv[++i];
+    } else if (arg == "--wav" && i + 1 < argc) {
+      wavPath = argv[++i];
+    } else if (arg == "--max-heap-allocs" && i + 1 < argc) {
+      maxHeapAllocs = strtol(argv[++i], nullptr, 10);
+    } else if (arg == "--heap-trace") {
+      heapTrace = true;
+    } else if (arg == "--check-history") {
+      checkHistory = true;
+    } else if (arg == "--wifi-drop" && i + 1 < argc &&
+               sscanf(argv[i + 1], "%lu:%lu", &wifiDropAtMs, &wifiOutageMs) == 2) {
+      wifiDrop = true;
+      ++i;
+    } else if (arg == "--serial" && i + 1 < argc) {
+      serialCommands.push_back(argv[++i]);
+    } else if (arg == "--quiet") {
+      Serial.setEcho(false);
+    } else {
+      fprintf(stderr, "usage: %s [--replay FILE] [--ppm FILE] [--run-ms N] "
+                      "[--serial CMD]... [--quiet] [--latency-ms N] "
+                      "[--max-loop-ms N] [--keepalive-ms N] [--nvs FILE] "
+                      "[--wifi-drop AT_MS:OUTAGE_MS] [--wav FILE] "
+                      "[--max-heap-allocs N] [--heap-trace] [--check-history]\n"
+                      "       %s --stress-seqlock N\n", argv[0], argv[0]);
+      return 2;
+    }
+  }
+
+  sim::spiBus().setControlPins(SIM_TFT_CS, SIM_TFT_DC);
+  sim::spiBus().setRecording(false);
+  sim::spiBus().setListener(&panel);
+  if (!sim::network().loadReplay(replayPath)) {
+    return 2;
+  }
+  sim::network().setWifiUp(true);
+  if (nvsPath && !sim::nvs().load(nvsPath)) {
+    return 2;
+  }
+
+  sim::setHeapCounting(true);
+  profile("setup", [] { setup(); return true; });
+  profile("fetchWaterSchedule", fetchWaterSchedule);
+  profile("fetchWaterSummary", fetchWaterSummary);
+  profile("pollWaterReminder", pollWaterReminder);
+  profile("renderForestUi", [] { renderForestUi(); return true; });
+  profile("postWaterIntake", [] { return postWaterIntake(250); });
+  profile("fetchWaterSummary", fetchWaterSummary);
+  profile("pollWaterReminder", pollWaterReminder);
+  profile("renderForestUi", [] { renderForestUi(); return true; });
+  profile("pollWaterReminder", pollWaterReminder);
+  profile("fetchWaterSummary", fetchWaterSummary);
+  profile("syncDevice", syncDevice);
+  profile("syncDevice", syncDevice);
+  // Unchanged since the last fetch: answered 304 from the stored ETags.
+  profile("fetchWaterSchedule", fetchWaterSchedule);
+  profile("fetchWaterSummary", fetchWaterSummary);
+
+  for (const std::string &command : serialCommands) {
+    sim::UntrackedHeap untracked;
+    Serial.feed((command + "\n").c_str());
+  }
+  sim::setHeapTrace(heapTrace);
+  const sim::HeapCounters heapAtRunStart = sim::heapCounters();
+  const unsigned long runStart = millis();
+  uint64_t worstLoopMicros = 0;
+  uint32_t loopPasses = 0;
+  while (millis() - runStart < runMs || Serial.available()) {
+    if (wifiDrop && millis() - runStart >= wifiDropAtMs) {
+      sim::network().dropWifi(wifiOutageMs);
+      wifiDrop = false;
+    }
+    const uint64_t passStart = sim::nowMicros();
+    const uint64_t idleAtStart = sim::idleMicros();
+    profile("loop", [] { loop(); return true; });
+    const uint64_t busyMicros =
+        sim::nowMicros() - passStart - (sim::idleMicros() - idleAtStart);
+    worstLoopMicros = std::max(worstLoopMicros, busyMicros);
+    ++loopPasses;
+  }
+  const sim::HeapCounters heapAtRunEnd = sim::heapCounters();
+  sim::setHeapCounting(false);
+  const bool historyWrong = checkHistory && !checkHistoryChart();
+
+  printReport();
+
+  bool loopTooSlow = false;
+  if (loopPasses) {
+    printf("loop: %u passes, worst %.2f ms busy in one pass\n", loopPasses,
+           worstLoopMicros / 1000.0);
+    if (maxLoopMs && worstLoopMicros > maxLoopMs * 1000ULL) {
+      printf("loop: worst pass exceeds --max-loop-ms %lu\n", maxLoopMs);
+      loopTooSlow = true;
+    }
+  }
+
+  bool heapTooBusy = false;
+  if (loopPasses && sim::heapCountingAvailable()) {
+    const uint64_t allocations = heapAtRunEnd.allocations - heapAtRunStart.allocations;
+    printf("heap: %llu allocations (%llu bytes) by firmware code in the run phase\n",
+           (unsigned long long)allocations,
+           (unsigned long long)(heapAtRunEnd.bytes - heapAtRunStart.bytes));
+    if (maxHeapAllocs >= 0 && allocations > static_cast<uint64_t>(maxHeapAllocs)) {
+      printf("heap: exceeds --max-heap-allocs %ld\n", maxHeapAllocs);
+      heapTooBusy = true;
+    }
+  }
+
+  // CPU writes or CS/DC changes under a DMA transfer still in flight; on
+  // the device those bytes would interleave with the transfer's.
+  const uint32_t hazards = sim::spiBus().counters().hazards;
+  printf("spi: %u bus hazards\n", hazards);
+
+  uint32_t failures = 0;
+  for (const CallStats &entry : stats) {
+    failures += entry.failures;
+  }
+  if (ppmPath[0] && !panel.writePpm(ppmPath)) {
+    fprintf(stderr, "sim: cannot write %s\n", ppmPath);
+    return 2;
+  }
+  const sim::NetCounters &net = sim::network().counters();
+  printf("network: %u DNS lookups, %u connects (%u TLS handshakes), "
+         "%u requests on a kept-alive connection, %u not modified\n",
+         net.dnsLookups, net.connects, net.tlsHandshakes, net.reusedRequests,
+         net.notModified);
+  printf("wifi: %u association attempts (%u to a known access point)\n",
+         net.wifiAttempts, net.wifiFastAttempts);
+  const sim::NvsCounters &flash = sim::nvs().counters();
+  printf("nvs: %u writes, %u bytes\n", flash.writes, flash.bytesWritten);
+  if (panel.firstDisplayOnMicros()) {
+    printf("panel: display on %.1f ms into setup()\n", panel.firstDisplayOnMicros() / 1000.0);
+  } else {
+    printf("panel: display never switched on\n");
+  }
+  const sim::DacCounters &dac = sim::dac().counters();
+  printf("dac: %u starts, %.2f s played, %u buffers, %u replayed stale\n",
+         dac.starts, dac.playedMicros / 1e6, dac.buffersPlayed, dac.staleBuffers);
+  if (wavPath && !sim::dac().writeWav(wavPath)) {
+    fprintf(stderr, "sim: cannot write %s\n", wavPath);
+    return 2;
+  }
+  if (nvsPath && !sim::nvs().save(nvsPath)) {
+    fprintf(stderr, "sim: cannot write %s\n", nvsPath);
+    return 2;
+  }
+  size_t responseBytes = 0;
+  for (const sim::HttpExchange &exchange : sim::network().log()) {
+    responseBytes += exchange.responseBytes;
+  }
+  printf("frame written to %s, %zu HTTP requests (%zu response bytes), "
+         "%u failed calls\n",
+         ppmPath, sim::network().log().size(), responseBytes, failures);
+  return failures || loopTooSlow || heapTooBusy || hazards || historyWrong ? 1 : 0;
+}
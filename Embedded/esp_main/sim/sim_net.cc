@@ -0,0 +1,637 @@
+#include "sim_net.h"
+
+#include <ArduinoJson.h>
+#include <ctype.h>
+#include <stdio.h>
+
+#include "HTTPClient.h"
+#include "WiFi.h"
+#include "esp_sntp.h"
+#include "sim_heap.h"
+
+namespace {
+
+bool sameHeaderName(const std::string &a, const char *b) {
+  size_t i = 0;
+  for (; i < a.size() && b[i]; ++i) {
+    if (tolower(static_cast<unsigned char>(a[i])) !=
+        tolower(static_cast<unsigned char>(b[i]))) {
+      return false;
+    }
+  }
+  return i == a.size() && b[i] == '\0';
+}
+
+const std::string *findHeader(
+    const std::vector<std::pair<std::string, std::string>> &headers,
+    const char *name) {
+  for (const auto &header : headers) {
+    if (sameHeaderName(header.first, name)) {
+      return &header.second;
+    }
+  }
+  return nullptr;
+}
+
+// The request's If-None-Match names the response's ETag.
+bool etagMatches(
+    const sim::HttpResponse &response,
+    const std::vector<std::pair<std::string, std::string>> &requestHeaders) {
+  const std::string *etag = findHeader(response.headers, "ETag");
+  const std::string *wanted = findHeader(requestHeaders, "If-None-Match");
+  return etag && wanted && *etag == *wanted;
+}
+
+// Re-encodes a JSON body as MessagePack when the request asked for it, the
+// way the backend's negotiate_encoding() does. The strong ETag changes with
+// the representation.
+void negotiateEncoding(
+    sim::HttpResponse &response,
+    const std::vector<std::pair<std::string, std::string>> &requestHeaders) {
+  const std::string *accept = findHeader(requestHeaders, "Accept");
+  if (!accept || accept->find("application/msgpack") == std::string::npos ||
+      response.body.empty() || !response.stream.empty()) {
+    return;
+  }
+  JsonDocument doc;
+  if (deserializeJson(doc, response.body)) {
+    return;
+  }
+  response.body.clear();
+  serializeMsgPack(doc, response.body);
+  response.headers.emplace_back("Content-Type", "application/msgpack");
+  for (auto &header : response.headers) {
+    if (sameHeaderName(header.first, "ETag") && header.second.size() > 1) {
+      header.second.insert(header.second.size() - 1, "-mp");
+    }
+  }
+}
+
+// One "stream" piece as the bytes the server writes for it.
+std::string streamPiece(JsonObjectConst piece) {
+  std::string text;
+  if (piece["comment"].is<const char *>()) {
+    text = std::string(": ") + piece["comment"].as<const char *>() + "\n\n";
+  } else if (!piece["data"].isNull()) {
+    std::string data;
+    JsonVariantConst value = piece["data"];
+    if (value.is<const char *>()) {
+      data = value.as<const char *>();
+    } else {
+      serializeJson(value, data);
+    }
+    if (piece["event"].is<const char *>()) {
+      text = std::string("event: ") + piece["event"].as<const char *>() + "\n";
+    }
+    text += "data: " + data + "\n\n";
+  } else {
+    text = piece["text"] | "";
+  }
+  return text;
+}
+
+std::string chunk(const std::string &data) {
+  char size[16];
+  snprintf(size, sizeof(size), "%zx\r\n", data.size());
+  return size + data + "\r\n";
+}
+
+sim::HttpResponse parseResponse(JsonObjectConst source) {
+  sim::HttpResponse response;
+  response.status = source["status"] | 200;
+  JsonVariantConst body = source["body"];
+  if (body.is<const char *>()) {
+    response.body = body.as<const char *>();
+  } else if (!body.isNull()) {
+    serializeJson(body, response.body);
+  }
+  bool chunked = false;
+  for (JsonPairConst header : source["headers"].as<JsonObjectConst>()) {
+    response.headers.emplace_back(header.key().c_str(),
+                                  header.value().as<const char *>());
+    chunked |= sameHeaderName(response.headers.back().first,
+                              "Transfer-Encoding") &&
+               response.headers.back().second == "chunked";
+  }
+  for (JsonObjectConst piece : source["stream"].as<JsonArrayConst>()) {
+    const std::string text = streamPiece(piece);
+    response.stream.emplace_back(piece["at_ms"] | 0u,
+                                 chunked ? chunk(text) : text);
+  }
+  if (chunked && !response.stream.empty()) {
+    response.stream.back().second += "0\r\n\r\n";
+  }
+  return response;
+}
+
+} // namespace
+
+namespace sim {
+
+Network &network() {
+  static Network instance;
+  return instance;
+}
+
+std::string urlPath(const std::string &url) {
+  size_t start = 0;
+  size_t scheme = url.find("://");
+  if (scheme != std::string::npos) {
+    start = url.find('/', scheme + 3);
+    if (start == std::string::npos) {
+      return "/";
+    }
+  }
+  size_t query = url.find('?', start);
+  return url.substr(start, query == std::string::npos ? std::string::npos
+                                                      : query - start);
+}
+
+bool Network::loadReplay(const char *path) {
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    fprintf(stderr, "sim: cannot open replay file %s\n", path);
+    return false;
+  }
+  std::string text;
+  char chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+    text.append(chunk, n);
+  }
+  fclose(file);
+
+  JsonDocument doc;
+  DeserializationError error = deserializeJson(doc, text);
+  if (error) {
+    fprintf(stderr, "sim: %s: %s\n", path, error.c_str());
+    return false;
+  }
+
+  for (JsonObjectConst route : doc.as<JsonArrayConst>()) {
+    std::vector<HttpResponse> responses;
+    JsonArrayConst list = route["responses"];
+    if (list.isNull()) {
+      responses.push_back(parseResponse(route));
+    } else {
+      for (JsonObjectConst item : list) {
+        responses.push_back(parseResponse(item));
+      }
+    }
+    addRoute(route["method"] | "GET", route["path"] | "/", responses,
+             route["latency_ms"] | 0);
+  }
+  return true;
+}
+
+void Network::addRoute(const char *method, const char *path,
+                       const std::vector<HttpResponse> &responses,
+                       uint32_t latencyMs) {
+  Route route;
+  route.method = method;
+  route.path = path;
+  route.responses = responses;
+  route.latencyMs = latencyMs;
+  routes_.push_back(route);
+}
+
+void Network::clearRoutes() { routes_.clear(); }
+
+void Network::setWifiUp(bool up) {
+  if (up) {
+    wifiStarted_ = true;
+    wifiAttemptDoneMicros_ = nowMicros();
+    wifiDropAtMicros_ = UINT64_MAX;
+  } else {
+    wifiDropAtMicros_ = nowMicros();
+    wifiApBackAtMicros_ = UINT64_MAX;
+  }
+}
+
+void Network::dropWifi(uint32_t outageMs) {
+  wifiDropAtMicros_ = nowMicros();
+  wifiApBackAtMicros_ = wifiDropAtMicros_ + static_cast<uint64_t>(outageMs) * 1000;
+}
+
+void Network::wifiBegin(bool fast) {
+  ++counters_.wifiAttempts;
+  if (fast) {
+    ++counters_.wifiFastAttempts;
+  }
+  wifiStarted_ = true;
+  wifiAttemptDoneMicros_ =
+      nowMicros() + static_cast<uint64_t>(fast ? wifiFastConnectMs_ : wifiConnectMs_) * 1000;
+}
+
+int Network::wifiStatus() {
+  if (!wifiStarted_ || nowMicros() < wifiAttemptDoneMicros_) {
+    return WL_DISCONNECTED;
+  }
+  if (wifiAttemptDoneMicros_ >= wifiDropAtMicros_ &&
+      wifiAttemptDoneMicros_ < wifiApBackAtMicros_) {
+    return WL_NO_SSID_AVAIL;
+  }
+  if (wifiAttemptDoneMicros_ < wifiDropAtMicros_ && nowMicros() >= wifiDropAtMicros_) {
+    return WL_CONNECTION_LOST;
+  }
+  return WL_CONNECTED;
+}
+
+bool Network::wifiConnected() { return wifiStatus() == WL_CONNECTED; }
+
+int64_t Network::wallClockMs() const {
+  return wallClockStartMs_ + static_cast<int64_t>(nowMicros() / 1000);
+}
+
+bool Network::sntpSync() {
+  if (!wifiConnected()) {
+    return false;
+  }
+  ++counters_.sntpSyncs;
+  return true;
+}
+
+bool Network::resolve(const char *host) {
+  (void)host;
+  ++counters_.dnsLookups;
+  advanceMicros(static_cast<uint64_t>(dnsMs_) * 1000);
+  return wifiConnected();
+}
+
+uint32_t Network::connect(bool tls) {
+  if (!wifiConnected()) {
+    advanceMicros(static_cast<uint64_t>(defaultLatencyMs_) * 1000);
+    return 0;
+  }
+  ++counters_.connects;
+  uint32_t costMs = tcpConnectMs_;
+  if (tls) {
+    ++counters_.tlsHandshakes;
+    costMs += tlsHandshakeMs_;
+  }
+  advanceMicros(static_cast<uint64_t>(costMs) * 1000);
+  return connectionEpoch_;
+}
+
+bool Network::connectionOpen(uint32_t epoch, uint64_t lastUsedMicros) {
+  // Without keep-alive the close after each response already happened.
+  return epoch != 0 && wifiConnected() &&
+         (!keepAlive_ || nowMicros() - lastUsedMicros <
+                             static_cast<uint64_t>(keepAliveIdleMs_) * 1000);
+}
+
+HttpResponse Network::exchange(
+    const std::string &method, const std::string &url, const std::string &body,
+    const std::vector<std::pair<std::string, std::string>> &requestHeaders,
+    uint32_t timeoutMs, bool reusedConnection) {
+  HttpExchange entry;
+  entry.method = method;
+  entry.url = url;
+  entry.requestBody = body;
+  entry.requestHeaders = requestHeaders;
+
+  HttpResponse response;
+  uint32_t latencyMs = defaultLatencyMs_;
+  if (!wifiConnected()) {
+    response.status = HTTPC_ERROR_CONNECTION_REFUSED;
+  } else {
+    const std::string path = urlPath(url);
+    Route *match = nullptr;
+    for (Route &route : routes_) {
+      if (route.method == method && route.path == path) {
+        match = &route;
+        break;
+      }
+    }
+    if (match && !match->responses.empty()) {
+      size_t index = std::min(match->served, match->responses.size() - 1);
+      response = match->responses[index];
+      ++match->served;
+      if (match->latencyMs) {
+        latencyMs = match->latencyMs;
+      }
+      negotiateEncoding(response, requestHeaders);
+      if (response.status == 200 && etagMatches(response, requestHeaders)) {
+        response.status = 304;
+        response.body.clear();
+        ++counters_.notModified;
+      }
+    } else {
+      response.status = 404;
+      response.body = "{\"error\":\"no replay route\"}";
+    }
+  }
+
+  if (forcedLatencyMs_) {
+    latencyMs = forcedLatencyMs_;
+  }
+  if (timeoutMs && latencyMs > timeoutMs) {
+    latencyMs = timeoutMs;
+    response = HttpResponse();
+    response.status = HTTPC_ERROR_READ_TIMEOUT;
+  }
+
+  advanceMicros(static_cast<uint64_t>(latencyMs) * 1000);
+  entry.status = response.status;
+  entry.responseBytes = response.body.size();
+  for (const auto &piece : response.stream) {
+    entry.responseBytes += piece.second.size();
+  }
+  entry.latencyMs = latencyMs;
+  entry.reusedConnection = reusedConnection;
+  counters_.reusedRequests += reusedConnection ? 1 : 0;
+  log_.push_back(entry);
+  return response;
+}
+
+} // namespace sim
+
+// SNTP ---------------------------------------------------------------------
+
+namespace {
+sntp_sync_time_cb_t sntpCallback = nullptr;
+} // namespace
+
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback) {
+  sntpCallback = callback;
+}
+
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char *server1,
+                const char *server2, const char *server3) {
+  (void)gmtOffset_sec;
+  (void)daylightOffset_sec;
+  (void)server1;
+  (void)server2;
+  (void)server3;
+  if (!sim::network().sntpSync() || !sntpCallback) {
+    return;
+  }
+  const int64_t nowMs = sim::network().wallClockMs();
+  timeval tv = {};
+  tv.tv_sec = static_cast<time_t>(nowMs / 1000);
+  tv.tv_usec = static_cast<suseconds_t>(nowMs % 1000 * 1000);
+  sntpCallback(&tv);
+}
+
+// WiFi ---------------------------------------------------------------------
+//
+// From here on the stand-ins are SDK code on the device, so what they
+// allocate is not counted as the firmware's (sim_heap.h).
+
+WiFiClass WiFi;
+
+wl_status_t WiFiClass::begin(const char *ssid, const char *passphrase,
+                              int32_t channel, const uint8_t *bssid,
+                              bool connect) {
+  sim::UntrackedHeap untracked;
+  (void)passphrase;
+  ssid_ = ssid ? ssid : "";
+  if (connect) {
+    sim::network().wifiBegin(channel != 0 && bssid != nullptr);
+  }
+  return status();
+}
+
+bool WiFiClass::disconnect(bool wifioff) {
+  if (wifioff) {
+    mode_ = WIFI_OFF;
+  }
+  return true;
+}
+
+wl_status_t WiFiClass::status() {
+  return static_cast<wl_status_t>(sim::network().wifiStatus());
+}
+
+int WiFiClass::hostByName(const char *host, IPAddress &result) {
+  sim::UntrackedHeap untracked;
+  if (!sim::network().resolve(host)) {
+    return 0;
+  }
+  result = IPAddress(10, 0, 0, 1);
+  return 1;
+}
+
+int WiFiClient::connect(IPAddress ip, uint16_t port, int32_t timeoutMs) {
+  sim::UntrackedHeap untracked;
+  (void)ip;
+  (void)port;
+  (void)timeoutMs;
+  stop();
+  epoch_ = sim::network().connect(tls_);
+  requests_ = 0;
+  lastUsedMicros_ = sim::nowMicros();
+  return epoch_ != 0;
+}
+
+int WiFiClient::connect(const char *host, uint16_t port, int32_t timeoutMs) {
+  IPAddress ip;
+  if (!WiFi.hostByName(host, ip)) {
+    return 0;
+  }
+  return connect(ip, port, timeoutMs);
+}
+
+size_t WiFiClient::readableEnd() const {
+  size_t end = releases_.empty() ? body_.size() : 0;
+  const uint64_t now = sim::nowMicros();
+  for (const auto &release : releases_) {
+    if (release.first > now) {
+      break;
+    }
+    end = release.second;
+  }
+  return end;
+}
+
+uint8_t WiFiClient::connected() {
+  if (position_ < body_.size()) {
+    return 1;
+  }
+  if (epoch_ && !sim::network().connectionOpen(epoch_, lastUsedMicros_)) {
+    epoch_ = 0;
+  }
+  return epoch_ != 0;
+}
+
+// HTTPClient ---------------------------------------------------------------
+
+HTTPClient::~HTTPClient() {
+  if (client_) {
+    client_->stop();
+  }
+}
+
+bool HTTPClient::begin(WiFiClient &client, const String &url) {
+  sim::UntrackedHeap untracked;
+  client_ = &client;
+  url_ = url;
+  requestHeaders_.clear();
+  responseHeaders_.clear();
+  size_ = -1;
+
+  const bool tls = url.startsWith("https://");
+  if (!tls && !url.startsWith("http://")) {
+    return false;
+  }
+  String rest = url.substring(tls ? 8 : 7);
+  int slash = rest.indexOf('/');
+  String authority = slash < 0 ? rest : rest.substring(0, slash);
+  int colon = authority.indexOf(':');
+  host_ = colon < 0 ? authority : authority.substring(0, colon);
+  port_ = colon < 0 ? (tls ? 443 : 80)
+                    : static_cast<uint16_t>(authority.substring(colon + 1).toInt());
+  return true;
+}
+
+bool HTTPClient::begin(const String &url) { return begin(ownClient_, url); }
+
+void HTTPClient::end() {
+  if (client_) {
+    // As on the target, a body nobody read is flushed, not left for the
+    // next response.
+    client_->position_ = client_->body_.size();
+  }
+  if (client_ && !(reuse_ && canReuse_ && client_->connected())) {
+    client_->stop();
+  }
+  client_ = nullptr;
+}
+
+void HTTPClient::addHeader(const String &name, const String &value) {
+  sim::UntrackedHeap untracked;
+  requestHeaders_.emplace_back(name, value);
+}
+
+void HTTPClient::collectHeaders(const char *headerKeys[],
+                                size_t headerKeysCount) {
+  sim::UntrackedHeap untracked;
+  collect_.assign(headerKeys, headerKeys + headerKeysCount);
+}
+
+String HTTPClient::header(const char *name) {
+  sim::UntrackedHeap untracked;
+  for (const auto &header : responseHeaders_) {
+    if (header.first.equalsIgnoreCase(name)) {
+      return header.second;
+    }
+  }
+  return String();
+}
+
+bool HTTPClient::hasHeader(const char *name) {
+  for (const auto &header : responseHeaders_) {
+    if (header.first.equalsIgnoreCase(name)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+int HTTPClient::GET() { return sendRequest("GET"); }
+
+int HTTPClient::POST(uint8_t *payload, size_t size) {
+  return sendRequest("POST", payload, size);
+}
+
+int HTTPClient::POST(const String &payload) {
+  return sendRequest("POST",
+                     reinterpret_cast<uint8_t *>(const_cast<char *>(payload.c_str())),
+                     payload.length());
+}
+
+int HTTPClient::sendRequest(const char *type, uint8_t *payload, size_t size) {
+  sim::UntrackedHeap untracked;
+  if (!client_) {
+    return HTTPC_ERROR_NOT_CONNECTED;
+  }
+  client_->body_.clear();
+  client_->releases_.clear();
+  client_->position_ = 0;
+  if (!client_->connected() && !client_->connect(host_.c_str(), port_)) {
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+  }
+  const bool reused = client_->requests_ > 0;
+  ++client_->requests_;
+  if (reused && !sim::network().connectionSurvived(client_->epoch_)) {
+    client_->stop();
+    return HTTPC_ERROR_CONNECTION_LOST;
+  }
+
+  std::vector<std::pair<std::string, std::string>> headers;
+  for (const auto &header : requestHeaders_) {
+    headers.emplace_back(header.first.c_str(), header.second.c_str());
+  }
+  std::string body;
+  if (payload && size) {
+    body.assign(reinterpret_cast<const char *>(payload), size);
+  }
+
+  sim::HttpResponse response =
+      sim::network().exchange(type, url_.c_str(), body, headers, timeout_,
+                              reused);
+  if (response.status <= 0) {
+    client_->stop();
+    return response.status;
+  }
+
+  // A streamed response ends with the server closing the connection.
+  canReuse_ = reuse_ && sim::network().keepAlive() && response.stream.empty();
+  for (const auto &header : response.headers) {
+    if (sameHeaderName(header.first, "Connection") &&
+        header.second.find("close") != std::string::npos) {
+      canReuse_ = false;
+    }
+  }
+  if (!canReuse_) {
+    // The server closes its end once the body is sent.
+    client_->epoch_ = 0;
+  }
+  client_->lastUsedMicros_ = sim::nowMicros();
+
+  responseHeaders_.clear();
+  for (const auto &header : response.headers) {
+    for (const String &key : collect_) {
+      if (sameHeaderName(header.first, key.c_str())) {
+        responseHeaders_.emplace_back(String(header.first), String(header.second));
+      }
+    }
+  }
+  client_->body_ = response.body;
+  client_->releases_.clear();
+  const uint64_t headersAt = sim::nowMicros();
+  for (const auto &piece : response.stream) {
+    client_->body_ += piece.second;
+    client_->releases_.emplace_back(
+        headersAt + static_cast<uint64_t>(piece.first) * 1000,
+        client_->body_.size());
+  }
+  client_->position_ = 0;
+  size_ = response.status > 0 ? static_cast<int>(response.body.size()) : -1;
+  return response.status;
+}
+
+String HTTPClient::getString() {
+  sim::UntrackedHeap untracked;
+  if (!client_) {
+    return String();
+  }
+  String result(client_->body_.c_str() + client_->position_);
+  client_->position_ = client_->body_.size();
+  return result;
+}
+
+String HTTPClient::errorToString(int error) {
+  switch (error) {
+  case HTTPC_ERROR_CONNECTION_REFUSED:
+    return F("connection refused");
+  case HTTPC_ERROR_NOT_CONNECTED:
+    return F("not connected");
+  case HTTPC_ERROR_CONNECTION_LOST:
+    return F("connection lost");
+  case HTTPC_ERROR_READ_TIMEOUT:
+    return F("read Timeout");
+  default:
+    return String();
+  }
+}
@@ -0,0 +1,180 @@
+// Network model behind the WiFi and HTTPClient stand-ins: a replay table of
+// backend responses keyed by method and URL path, plus a log of what the
+// firmware actually sent.
+//
+// Replay files are JSON arrays of routes:
+//   [{"method": "GET", "path": "/api/water/poll", "latency_ms": 90,
+//     "responses": [{"status": 200, "body": {...}}, ...]}]
+// A route serves its responses in order and keeps repeating the last one.
+// "status"/"body"/"headers" may sit on the route itself for a single
+// response. A response with "stream" instead of "body" is sent piece by
+// piece, each piece "at_ms" after the headers, and the server closes the
+// connection after the last one:
+//   "stream": [{"at_ms": 0, "comment": "connected"},
+//              {"at_ms": 5000, "event": "sync", "data": {...}},
+//              {"at_ms": 9000, "text": "raw bytes"}]
+// "comment" and "event"/"data" pieces are framed as Server-Sent Events, and
+// every piece becomes one chunk when the response's headers say
+// "Transfer-Encoding: chunked".
+//
+// A 200 response with an "ETag" header is answered 304 with no body when
+// the request's If-None-Match carries the same tag. JSON bodies go out as
+// MessagePack, with "-mp" on the ETag, when the request's Accept asks. Unknown routes answer 404 after the default latency. A
+// request whose latency exceeds the client's timeout fails with
+// HTTPC_ERROR_READ_TIMEOUT once the timeout has passed.
+//
+// Connections are modelled too: a DNS lookup, TCP connect and TLS handshake
+// each cost virtual time. The server keeps a connection open between
+// requests until it has been idle for the keep-alive time or a response
+// carries "Connection: close"; setKeepAlive(false) closes after every
+// response, like an HTTP/1.0 server.
+//
+// WiFi: an association started by begin() completes after the full
+// connect time (scan, then the EAP exchange), or the shorter fast one when
+// begin() named the channel and access point. dropWifi() takes the link
+// down and keeps the access point away for a while; an attempt that
+// completes in that window fails with WL_NO_SSID_AVAIL.
+//
+// The wall clock SNTP reports is wallClockStartMs() plus the calling task's
+// virtual time; by default it starts at 2026-10-16T14:58:00Z, two minutes
+// before the replayed status's next_reminder_at.
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "WString.h"
+
+namespace sim {
+
+struct HttpResponse {
+  int status = 200;
+  std::string body;
+  std::vector<std::pair<std::string, std::string>> headers;
+  // Streamed body: each piece and its delay in ms after the headers.
+  std::vector<std::pair<uint32_t, std::string>> stream;
+};
+
+struct NetCounters {
+  uint32_t dnsLookups = 0;
+  uint32_t connects = 0;
+  uint32_t tlsHandshakes = 0;
+  uint32_t reusedRequests = 0;
+  uint32_t notModified = 0;
+  uint32_t sntpSyncs = 0;
+  uint32_t wifiAttempts = 0;
+  uint32_t wifiFastAttempts = 0;
+};
+
+struct HttpExchange {
+  std::string method;
+  std::string url;
+  std::string requestBody;
+  std::vector<std::pair<std::string, std::string>> requestHeaders;
+  int status = 0;
+  size_t responseBytes = 0;
+  uint32_t latencyMs = 0;
+  bool reusedConnection = false;
+};
+
+class Network {
+public:
+  bool loadReplay(const char *path);
+  void addRoute(const char *method, const char *path,
+                const std::vector<HttpResponse> &responses,
+                uint32_t latencyMs = 0);
+  void clearRoutes();
+
+  void setDefaultLatencyMs(uint32_t ms) { defaultLatencyMs_ = ms; }
+  // Non-zero: every request takes this long, whatever its route says.
+  void setForcedLatencyMs(uint32_t ms) { forcedLatencyMs_ = ms; }
+  void setWifiConnectMs(uint32_t fullMs, uint32_t fastMs) {
+    wifiConnectMs_ = fullMs;
+    wifiFastConnectMs_ = fastMs;
+  }
+  // true: associated as of now. false: down with no access point in reach.
+  void setWifiUp(bool up);
+  // Drops the link now; the access point is back after outageMs.
+  void dropWifi(uint32_t outageMs);
+  void setConnectCostsMs(uint32_t dnsMs, uint32_t tcpMs, uint32_t tlsMs) {
+    dnsMs_ = dnsMs;
+    tcpConnectMs_ = tcpMs;
+    tlsHandshakeMs_ = tlsMs;
+  }
+  void setKeepAlive(bool keepAlive, uint32_t idleMs = 60000) {
+    keepAlive_ = keepAlive;
+    keepAliveIdleMs_ = idleMs;
+  }
+  void setWallClockStartMs(int64_t epochMs) { wallClockStartMs_ = epochMs; }
+  int64_t wallClockStartMs() const { return wallClockStartMs_; }
+  int64_t wallClockMs() const;
+  // Drops every open connection the way a server restart does: clients
+  // only find out when their next request on it fails.
+  void closeConnections() { ++connectionEpoch_; }
+
+  const NetCounters &counters() const { return counters_; }
+
+  const std::vector<HttpExchange> &log() const { return log_; }
+  void clearLog() { log_.clear(); }
+
+  // Called by the stand-ins.
+  HttpResponse exchange(const std::string &method, const std::string &url,
+                        const std::string &body,
+                        const std::vector<std::pair<std::string, std::string>>
+                            &requestHeaders,
+                        uint32_t timeoutMs, bool reusedConnection);
+  bool resolve(const char *host);
+  // Returns the connection's epoch, 0 when the link is down.
+  uint32_t connect(bool tls);
+  // What the client can see: the link is up and the server has not closed
+  // the connection for being idle.
+  bool connectionOpen(uint32_t epoch, uint64_t lastUsedMicros);
+  bool connectionSurvived(uint32_t epoch) const {
+    return epoch == connectionEpoch_;
+  }
+  bool keepAlive() const { return keepAlive_; }
+  void wifiBegin(bool fast);
+  // A wl_status_t.
+  int wifiStatus();
+  bool wifiConnected();
+  // configTime(): false when there is no link to reach a time server.
+  bool sntpSync();
+
+private:
+  struct Route {
+    std::string method;
+    std::string path;
+    std::vector<HttpResponse> responses;
+    uint32_t latencyMs = 0;
+    size_t served = 0;
+  };
+
+  std::vector<Route> routes_;
+  std::vector<HttpExchange> log_;
+  uint32_t defaultLatencyMs_ = 80;
+  uint32_t forcedLatencyMs_ = 0;
+  uint32_t dnsMs_ = 40;
+  uint32_t tcpConnectMs_ = 60;
+  uint32_t tlsHandshakeMs_ = 450;
+  bool keepAlive_ = true;
+  uint32_t keepAliveIdleMs_ = 60000;
+  uint32_t connectionEpoch_ = 1;
+  NetCounters counters_;
+  uint32_t wifiConnectMs_ = 1500;
+  uint32_t wifiFastConnectMs_ = 350;
+  bool wifiStarted_ = false;
+  uint64_t wifiAttemptDoneMicros_ = 0;
+  uint64_t wifiDropAtMicros_ = UINT64_MAX;
+  uint64_t wifiApBackAtMicros_ = 0;
+  int64_t wallClockStartMs_ = 1792162680000LL;
+};
+
+Network &network();
+
+// "/api/x?y=1" from "https://host:port/api/x?y=1", then without the query.
+std::string urlPath(const std::string &url);
+
+} // namespace sim
@@ -0,0 +1,170 @@
+#include "sim_nvs.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "Arduino.h"
+#include "Preferences.h"
+#include "esp_random.h"
+#include "sim_heap.h"
+
+namespace sim {
+
+Nvs &nvs() {
+  static Nvs instance;
+  return instance;
+}
+
+// One entry per line: "<namespace> <key> <hex bytes>".
+bool Nvs::load(const char *path) {
+  FILE *file = fopen(path, "r");
+  if (!file) {
+    return true;
+  }
+  char ns[32], key[32], hex[1024];
+  while (fscanf(file, "%31s %31s %1023s", ns, key, hex) == 3) {
+    Blob value;
+    for (size_t i = 0; hex[i] && hex[i + 1]; i += 2) {
+      unsigned byte = 0;
+      sscanf(&hex[i], "%2x", &byte);
+      value.push_back(static_cast<uint8_t>(byte));
+    }
+    namespaces_[ns][key] = value;
+  }
+  fclose(file);
+  return true;
+}
+
+bool Nvs::save(const char *path) const {
+  FILE *file = fopen(path, "w");
+  if (!file) {
+    return false;
+  }
+  for (const auto &ns : namespaces_) {
+    for (const auto &entry : ns.second) {
+      fprintf(file, "%s %s ", ns.first.c_str(), entry.first.c_str());
+      for (uint8_t byte : entry.second) {
+        fprintf(file, "%02x", byte);
+      }
+      // An empty blob still needs a token to read back.
+      fprintf(file, "%s\n", entry.second.empty() ? "-" : "");
+    }
+  }
+  return fclose(file) == 0;
+}
+
+const Nvs::Blob *Nvs::get(const std::string &ns, const std::string &key) const {
+  auto space = namespaces_.find(ns);
+  if (space == namespaces_.end()) {
+    return nullptr;
+  }
+  auto entry = space->second.find(key);
+  return entry == space->second.end() ? nullptr : &entry->second;
+}
+
+void Nvs::put(const std::string &ns, const std::string &key, const Blob &value) {
+  namespaces_[ns][key] = value;
+  ++counters_.writes;
+  counters_.bytesWritten += value.size();
+  advanceMicros(writeMicros_);
+}
+
+bool Nvs::remove(const std::string &ns, const std::string &key) {
+  auto space = namespaces_.find(ns);
+  if (space == namespaces_.end() || !space->second.erase(key)) {
+    return false;
+  }
+  ++counters_.writes;
+  advanceMicros(writeMicros_);
+  return true;
+}
+
+void Nvs::clear(const std::string &ns) {
+  namespaces_.erase(ns);
+  ++counters_.writes;
+  advanceMicros(writeMicros_);
+}
+
+} // namespace sim
+
+// Preferences ----------------------------------------------------------------
+//
+// SDK code on the device: what it allocates is not the firmware's.
+
+bool Preferences::begin(const char *name, bool readOnly,
+                        const char *partitionLabel) {
+  (void)partitionLabel;
+  // NVS namespace names are at most 15 characters.
+  if (!name || strlen(name) > 15) {
+    return false;
+  }
+  namespace_ = name;
+  readOnly_ = readOnly;
+  open_ = true;
+  return true;
+}
+
+bool Preferences::clear() {
+  sim::UntrackedHeap untracked;
+  if (!open_ || readOnly_) {
+    return false;
+  }
+  sim::nvs().clear(namespace_);
+  return true;
+}
+
+bool Preferences::remove(const char *key) {
+  sim::UntrackedHeap untracked;
+  return open_ && !readOnly_ && sim::nvs().remove(namespace_, key);
+}
+
+bool Preferences::isKey(const char *key) {
+  return open_ && sim::nvs().get(namespace_, key) != nullptr;
+}
+
+size_t Preferences::putUInt(const char *key, uint32_t value) {
+  return putBytes(key, &value, sizeof(value));
+}
+
+uint32_t Preferences::getUInt(const char *key, uint32_t defaultValue) {
+  uint32_t value = defaultValue;
+  if (getBytesLength(key) == sizeof(value)) {
+    getBytes(key, &value, sizeof(value));
+  }
+  return value;
+}
+
+size_t Preferences::putBytes(const char *key, const void *value, size_t len) {
+  sim::UntrackedHeap untracked;
+  if (!open_ || readOnly_ || !key || strlen(key) > 15) {
+    return 0;
+  }
+  const uint8_t *bytes = static_cast<const uint8_t *>(value);
+  sim::nvs().put(namespace_, key, sim::Nvs::Blob(bytes, bytes + len));
+  return len;
+}
+
+size_t Preferences::getBytesLength(const char *key) {
+  const sim::Nvs::Blob *blob = open_ ? sim::nvs().get(namespace_, key) : nullptr;
+  return blob ? blob->size() : 0;
+}
+
+size_t Preferences::getBytes(const char *key, void *buf, size_t maxLen) {
+  const sim::Nvs::Blob *blob = open_ ? sim::nvs().get(namespace_, key) : nullptr;
+  if (!blob || blob->size() > maxLen) {
+    return 0;
+  }
+  memcpy(buf, blob->data(), blob->size());
+  return blob->size();
+}
+
+// esp_random -----------------------------------------------------------------
+
+uint32_t esp_random(void) {
+  // xorshift32, fixed seed.
+  static uint32_t state = 0x2545f491u;
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
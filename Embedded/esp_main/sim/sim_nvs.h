@@ -0,0 +1,46 @@
+// NVS model behind the Preferences stand-in: namespaces of key/value blobs
+// in memory, each write costing virtual time like a flash write on the
+// calling task. load()/save() keep the store in a file between runs, so a
+// second run boots with what the first one left, as after a reset.
+#pragma once
+
+#include <stdint.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace sim {
+
+struct NvsCounters {
+  uint32_t writes = 0;
+  uint32_t bytesWritten = 0;
+};
+
+class Nvs {
+public:
+  using Blob = std::vector<uint8_t>;
+  using Namespace = std::map<std::string, Blob>;
+
+  // A missing file is an empty store.
+  bool load(const char *path);
+  bool save(const char *path) const;
+
+  void setWriteMicros(uint32_t us) { writeMicros_ = us; }
+
+  const Blob *get(const std::string &ns, const std::string &key) const;
+  void put(const std::string &ns, const std::string &key, const Blob &value);
+  bool remove(const std::string &ns, const std::string &key);
+  void clear(const std::string &ns);
+
+  const NvsCounters &counters() const { return counters_; }
+
+private:
+  std::map<std::string, Namespace> namespaces_;
+  uint32_t writeMicros_ = 1500;
+  NvsCounters counters_;
+};
+
+Nvs &nvs();
+
+} // namespace sim
@@ -0,0 +1,162 @@
+#include "sim_panel.h"
+
+#include <stdio.h>
+
+#include <Arduino.h>
+
+namespace {
+
+constexpr uint8_t CMD_SWRESET = 0x01;
+constexpr uint8_t CMD_DISPOFF = 0x28;
+constexpr uint8_t CMD_DISPON = 0x29;
+constexpr uint8_t CMD_CASET = 0x2A;
+constexpr uint8_t CMD_RASET = 0x2B;
+constexpr uint8_t CMD_RAMWR = 0x2C;
+constexpr uint8_t CMD_VSCRDEF = 0x33;
+constexpr uint8_t CMD_MADCTL = 0x36;
+constexpr uint8_t CMD_VSCRSADD = 0x37;
+
+constexpr uint8_t MADCTL_MY = 0x80;
+constexpr uint8_t MADCTL_MX = 0x40;
+constexpr uint8_t MADCTL_MV = 0x20;
+
+} // namespace
+
+namespace sim {
+
+St7735Panel::St7735Panel(const PanelGeometry &geometry)
+    : geometry_(geometry), memory_(MEMORY_COLS * MEMORY_ROWS, 0) {}
+
+void St7735Panel::onSpiCommand(uint8_t command) {
+  command_ = command;
+  argCount_ = 0;
+  highByte_ = -1;
+  if (command == CMD_RAMWR) {
+    col_ = colStart_;
+    row_ = rowStart_;
+  } else if (command == CMD_SWRESET) {
+    madctl_ = 0;
+    topFixed_ = 0;
+    scrollLines_ = MEMORY_ROWS;
+    scrollStart_ = 0;
+    displayOn_ = false;
+  } else if (command == CMD_DISPON) {
+    displayOn_ = true;
+    if (firstDisplayOnMicros_ == 0) {
+      firstDisplayOnMicros_ = sim::nowMicros();
+    }
+  } else if (command == CMD_DISPOFF) {
+    displayOn_ = false;
+  }
+}
+
+void St7735Panel::onSpiData(const uint8_t *bytes, size_t length) {
+  for (size_t i = 0; i < length; ++i) {
+    const uint8_t b = bytes[i];
+    if (command_ == CMD_RAMWR) {
+      if (highByte_ < 0) {
+        highByte_ = b;
+      } else {
+        writePixel(static_cast<uint16_t>((highByte_ << 8) | b));
+        highByte_ = -1;
+      }
+      continue;
+    }
+    if (argCount_ < sizeof(args_)) {
+      args_[argCount_++] = b;
+    }
+    const uint16_t first = (args_[0] << 8) | args_[1];
+    const uint16_t second = (args_[2] << 8) | args_[3];
+    if (command_ == CMD_CASET && argCount_ == 4) {
+      colStart_ = first;
+      colEnd_ = second;
+    } else if (command_ == CMD_RASET && argCount_ == 4) {
+      rowStart_ = first;
+      rowEnd_ = second;
+    } else if (command_ == CMD_MADCTL && argCount_ == 1) {
+      madctl_ = b;
+    } else if (command_ == CMD_VSCRDEF && argCount_ == 6) {
+      topFixed_ = first;
+      scrollLines_ = second;
+    } else if (command_ == CMD_VSCRSADD && argCount_ == 2) {
+      scrollStart_ = first;
+    }
+  }
+}
+
+void St7735Panel::writePixel(uint16_t color) {
+  // Address counters run in MCU space; MADCTL maps them onto memory.
+  uint16_t column = (madctl_ & MADCTL_MV) ? row_ : col_;
+  uint16_t line = (madctl_ & MADCTL_MV) ? col_ : row_;
+  if (madctl_ & MADCTL_MX) {
+    column = MEMORY_COLS - 1 - column;
+  }
+  if (madctl_ & MADCTL_MY) {
+    line = MEMORY_ROWS - 1 - line;
+  }
+  if (column < MEMORY_COLS && line < MEMORY_ROWS) {
+    memory_[line * MEMORY_COLS + column] = color;
+  }
+  ++pixelsWritten_;
+
+  if (++col_ > colEnd_) {
+    col_ = colStart_;
+    if (++row_ > rowEnd_) {
+      row_ = rowStart_;
+    }
+  }
+}
+
+uint16_t St7735Panel::scrolledLine(uint16_t line) const {
+  if (line < topFixed_ || line >= topFixed_ + scrollLines_ || scrollLines_ == 0) {
+    return line;
+  }
+  const uint16_t offset = (scrollStart_ >= topFixed_) ? scrollStart_ - topFixed_ : 0;
+  return topFixed_ + (line - topFixed_ + offset) % scrollLines_;
+}
+
+uint16_t St7735Panel::pixel(int16_t x, int16_t y) const {
+  if (x < 0 || y < 0 || x >= geometry_.width || y >= geometry_.height) {
+    return 0;
+  }
+  uint16_t column = x + geometry_.colOffset;
+  uint16_t line = y + geometry_.rowOffset;
+  if (geometry_.mountedMirrored) {
+    column = MEMORY_COLS - 1 - column;
+    line = MEMORY_ROWS - 1 - line;
+  }
+  return memory_[scrolledLine(line) * MEMORY_COLS + column];
+}
+
+std::vector<uint16_t> St7735Panel::frame() const {
+  std::vector<uint16_t> pixels;
+  pixels.reserve(geometry_.width * geometry_.height);
+  for (int16_t y = 0; y < geometry_.height; ++y) {
+    for (int16_t x = 0; x < geometry_.width; ++x) {
+      pixels.push_back(pixel(x, y));
+    }
+  }
+  return pixels;
+}
+
+bool St7735Panel::writePpm(const char *path) const {
+  FILE *file = fopen(path, "wb");
+  if (!file) {
+    return false;
+  }
+  fprintf(file, "P6\n%u %u\n255\n", geometry_.width, geometry_.height);
+  for (int16_t y = 0; y < geometry_.height; ++y) {
+    for (int16_t x = 0; x < geometry_.width; ++x) {
+      const uint16_t c = pixel(x, y);
+      const uint8_t rgb[3] = {
+          static_cast<uint8_t>(((c >> 11) & 0x1F) * 255 / 31),
+          static_cast<uint8_t>(((c >> 5) & 0x3F) * 255 / 63),
+          static_cast<uint8_t>((c & 0x1F) * 255 / 31),
+      };
+      fwrite(rgb, 1, sizeof(rgb), file);
+    }
+  }
+  return fclose(file) == 0;
+}
+
+} // namespace sim
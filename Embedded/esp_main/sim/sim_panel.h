@@ -0,0 +1,66 @@
+// ST7735 controller model on the recording SPI bus. It decodes CASET,
+// RASET, RAMWR, MADCTL (MX/MY/MV) and the vertical-scroll pair
+// VSCRDEF/VSCRSADD into 132x162 frame memory, and renders the visible
+// window the way the glass shows it. DISPON/DISPOFF are followed too, with
+// the virtual time the display first came on.
+#pragma once
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "sim_spi_bus.h"
+
+namespace sim {
+
+struct PanelGeometry {
+  uint16_t width = 128;       // Visible columns
+  uint16_t height = 160;      // Visible rows
+  uint16_t colOffset = 2;     // Address of the first visible column
+  uint16_t rowOffset = 1;     // Address of the first visible row
+  bool mountedMirrored = true; // Glass reads memory back to front (GREENTAB)
+};
+
+class St7735Panel : public SpiListener {
+public:
+  static constexpr uint16_t MEMORY_COLS = 132;
+  static constexpr uint16_t MEMORY_ROWS = 162;
+
+  explicit St7735Panel(const PanelGeometry &geometry = PanelGeometry());
+
+  void onSpiCommand(uint8_t command) override;
+  void onSpiData(const uint8_t *bytes, size_t length) override;
+
+  // Visible pixel in rotation-0 screen coordinates, with scrolling applied.
+  uint16_t pixel(int16_t x, int16_t y) const;
+  // Visible window as width*height RGB565 values, row-major.
+  std::vector<uint16_t> frame() const;
+  bool writePpm(const char *path) const;
+
+  uint32_t pixelsWritten() const { return pixelsWritten_; }
+  bool displayOn() const { return displayOn_; }
+  // sim::nowMicros() at the first DISPON, 0 before it.
+  uint64_t firstDisplayOnMicros() const { return firstDisplayOnMicros_; }
+  void resetPixelsWritten() { pixelsWritten_ = 0; }
+
+private:
+  void writePixel(uint16_t color);
+  uint16_t scrolledLine(uint16_t line) const;
+
+  PanelGeometry geometry_;
+  std::vector<uint16_t> memory_;
+  uint8_t command_ = 0;
+  uint8_t args_[6] = {};
+  uint8_t argCount_ = 0;
+  uint16_t colStart_ = 0, colEnd_ = MEMORY_COLS - 1;
+  uint16_t rowStart_ = 0, rowEnd_ = MEMORY_ROWS - 1;
+  uint16_t col_ = 0, row_ = 0;
+  int16_t highByte_ = -1;
+  uint8_t madctl_ = 0;
+  uint16_t topFixed_ = 0, scrollLines_ = MEMORY_ROWS, scrollStart_ = 0;
+  uint32_t pixelsWritten_ = 0;
+  bool displayOn_ = false;
+  uint64_t firstDisplayOnMicros_ = 0;
+};
+
+} // namespace sim
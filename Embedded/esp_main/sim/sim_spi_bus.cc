@@ -0,0 +1,246 @@
+#include "sim_spi_bus.h"
+
+#include <deque>
+
+#include "SPI.h"
+#include "driver/spi_master.h"
+#include "sim_heap.h"
+
+namespace sim {
+
+namespace {
+
+void forwardPinWrite(uint8_t pin, uint8_t level) {
+  spiBus().pinWritten(pin, level);
+}
+
+} // namespace
+
+SpiBus &spiBus() {
+  static SpiBus bus;
+  return bus;
+}
+
+void SpiBus::setControlPins(int8_t cs, int8_t dc) {
+  cs_ = cs;
+  dc_ = dc;
+  setPinWriteHook(forwardPinWrite);
+}
+
+void SpiBus::clear() {
+  records_.clear();
+  counters_ = SpiCounters();
+}
+
+void SpiBus::record(SpiOp op, uint8_t value) {
+  if (recording_) {
+    records_.push_back(SpiRecord{op, value, {}});
+  }
+}
+
+void SpiBus::beginTransaction() {
+  if (dmaInFlight_) {
+    ++counters_.hazards;
+    record(SpiOp::Hazard);
+  }
+  ++counters_.transactions;
+  record(SpiOp::Begin);
+}
+
+void SpiBus::endTransaction() { record(SpiOp::End); }
+
+void SpiBus::pinWritten(uint8_t pin, uint8_t level) {
+  if (pin != cs_ && pin != dc_) {
+    return;
+  }
+  if (dmaInFlight_) {
+    ++counters_.hazards;
+    record(SpiOp::Hazard);
+  }
+  if (pin == dc_) {
+    dcLevel_ = level;
+  } else {
+    record(level ? SpiOp::Deselect : SpiOp::Select);
+  }
+}
+
+void SpiBus::cpuWrite(const uint8_t *bytes, size_t length) {
+  if (dmaInFlight_) {
+    ++counters_.hazards;
+    record(SpiOp::Hazard);
+  }
+  transmit(bytes, length);
+}
+
+void SpiBus::dmaQueued(const uint8_t *bytes, size_t length) {
+  ++dmaInFlight_;
+  ++counters_.dmaTransfers;
+  record(SpiOp::DmaQueue, dmaInFlight_);
+  transmit(bytes, length);
+}
+
+void SpiBus::dmaRetired() {
+  if (dmaInFlight_) {
+    --dmaInFlight_;
+  }
+  record(SpiOp::DmaDone, dmaInFlight_);
+}
+
+void SpiBus::transmit(const uint8_t *bytes, size_t length) {
+  if (!length) {
+    return;
+  }
+  UntrackedHeap untracked;
+  uint64_t wireMicros = (static_cast<uint64_t>(length) * 8 * 1000000) / clockHz_;
+  counters_.busyMicros += wireMicros;
+  advanceMicros(wireMicros);
+
+  if (dcLevel_ == LOW) {
+    // Command mode: every byte is its own command.
+    for (size_t i = 0; i < length; ++i) {
+      ++counters_.commands;
+      record(SpiOp::Command, bytes[i]);
+      if (listener_) {
+        listener_->onSpiCommand(bytes[i]);
+      }
+    }
+    return;
+  }
+
+  counters_.dataBytes += length;
+  if (recording_) {
+    if (records_.empty() || records_.back().op != SpiOp::Data) {
+      records_.push_back(SpiRecord{SpiOp::Data, 0, {}});
+    }
+    records_.back().bytes.insert(records_.back().bytes.end(), bytes,
+                                 bytes + length);
+  }
+  if (listener_) {
+    listener_->onSpiData(bytes, length);
+  }
+}
+
+} // namespace sim
+
+// SPIClass -----------------------------------------------------------------
+
+SPIClass SPI;
+
+void SPIClass::beginTransaction(SPISettings settings) {
+  sim::spiBus().setClockHz(settings._clock);
+  sim::spiBus().beginTransaction();
+}
+
+void SPIClass::endTransaction() { sim::spiBus().endTransaction(); }
+
+uint8_t SPIClass::transfer(uint8_t data) {
+  sim::spiBus().cpuWrite(&data, 1);
+  return 0;
+}
+
+uint16_t SPIClass::transfer16(uint16_t data) {
+  write16(data);
+  return 0;
+}
+
+void SPIClass::transfer(void *data, uint32_t size) {
+  sim::spiBus().cpuWrite(static_cast<const uint8_t *>(data), size);
+  memset(data, 0, size);
+}
+
+void SPIClass::write(uint8_t data) { sim::spiBus().cpuWrite(&data, 1); }
+
+void SPIClass::write16(uint16_t data) {
+  uint8_t bytes[2] = {static_cast<uint8_t>(data >> 8),
+                      static_cast<uint8_t>(data)};
+  sim::spiBus().cpuWrite(bytes, sizeof(bytes));
+}
+
+void SPIClass::write32(uint32_t data) {
+  uint8_t bytes[4] = {static_cast<uint8_t>(data >> 24),
+                      static_cast<uint8_t>(data >> 16),
+                      static_cast<uint8_t>(data >> 8),
+                      static_cast<uint8_t>(data)};
+  sim::spiBus().cpuWrite(bytes, sizeof(bytes));
+}
+
+void SPIClass::writeBytes(const uint8_t *data, uint32_t size) {
+  sim::spiBus().cpuWrite(data, size);
+}
+
+void SPIClass::writePixels(const void *data, uint32_t size) {
+  sim::UntrackedHeap untracked; // the byte swap's scratch; the core has none
+  const uint8_t *bytes = static_cast<const uint8_t *>(data);
+  std::vector<uint8_t> swapped(size);
+  for (uint32_t i = 0; i + 1 < size; i += 2) {
+    swapped[i] = bytes[i + 1];
+    swapped[i + 1] = bytes[i];
+  }
+  sim::spiBus().cpuWrite(swapped.data(), size);
+}
+
+// IDF SPI master -----------------------------------------------------------
+
+struct spi_device_t {
+  spi_device_interface_config_t config;
+  std::deque<spi_transaction_t *> inFlight;
+};
+
+esp_err_t spi_bus_initialize(spi_host_device_t host,
+                             const spi_bus_config_t *config, int dma_chan) {
+  (void)host;
+  (void)config;
+  (void)dma_chan;
+  return ESP_OK;
+}
+
+esp_err_t spi_bus_add_device(spi_host_device_t host,
+                             const spi_device_interface_config_t *config,
+                             spi_device_handle_t *handle) {
+  (void)host;
+  sim::UntrackedHeap untracked; // the driver's own device record
+  spi_device_t *device = new spi_device_t();
+  device->config = *config;
+  *handle = device;
+  return ESP_OK;
+}
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle,
+                                 spi_transaction_t *trans,
+                                 TickType_t ticks_to_wait) {
+  (void)ticks_to_wait;
+  if (static_cast<int>(handle->inFlight.size()) >= handle->config.queue_size) {
+    return ESP_ERR_TIMEOUT; // The real driver would block forever here
+  }
+  const uint8_t *bytes = (trans->flags & SPI_TRANS_USE_TXDATA)
+                             ? trans->tx_data
+                             : static_cast<const uint8_t *>(trans->tx_buffer);
+  sim::UntrackedHeap untracked; // the driver's queue; the IDF's is preallocated
+  handle->inFlight.push_back(trans);
+  sim::spiBus().dmaQueued(bytes, trans->length / 8);
+  return ESP_OK;
+}
+
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle,
+                                      spi_transaction_t **trans,
+                                      TickType_t ticks_to_wait) {
+  (void)ticks_to_wait;
+  if (handle->inFlight.empty()) {
+    return ESP_ERR_TIMEOUT;
+  }
+  *trans = handle->inFlight.front();
+  handle->inFlight.pop_front();
+  if (handle->config.post_cb) {
+    handle->config.post_cb(*trans);
+  }
+  sim::spiBus().dmaRetired();
+  return ESP_OK;
+}
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle,
+                                      spi_transaction_t *trans) {
+  spi_transaction_t *done = nullptr;
+  esp_err_t err = spi_device_queue_trans(handle, trans, portMAX_DELAY);
+  return err == ESP_OK ? spi_device_get_trans_result(handle, &done, portMAX_DELAY)
+                       : err;
+}
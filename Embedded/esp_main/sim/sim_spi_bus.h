@@ -0,0 +1,87 @@
+// Recording model of the display's SPI bus. Every byte the firmware
+// clocks out -- through SPIClass or through queued IDF DMA transactions --
+// lands here tagged as command or data (from the DC pin level), so host
+// code can check the exact order of commands, payloads and transactions.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+namespace sim {
+
+enum class SpiOp : uint8_t {
+  Begin,    // SPIClass::beginTransaction()
+  End,      // SPIClass::endTransaction()
+  Select,   // CS driven low
+  Deselect, // CS driven high
+  Command,  // One byte sent with DC low; value = the byte
+  Data,     // Run of bytes sent with DC high; bytes = the payload
+  DmaQueue, // Transaction handed to the IDF driver; value = slot depth
+  DmaDone,  // Oldest queued transaction retired
+  Hazard,   // CPU touched the bus or CS/DC while DMA was still in flight
+};
+
+struct SpiRecord {
+  SpiOp op;
+  uint8_t value;
+  std::vector<uint8_t> bytes;
+};
+
+struct SpiCounters {
+  uint32_t transactions = 0; // beginTransaction() calls
+  uint32_t commands = 0;     // Command bytes
+  uint32_t dataBytes = 0;    // Data bytes, CPU and DMA
+  uint32_t dmaTransfers = 0; // Queued DMA transactions
+  uint32_t hazards = 0;      // See SpiOp::Hazard
+  uint64_t busyMicros = 0;   // Wire time at the configured clock
+};
+
+// Receives decoded traffic; the panel model hangs off this.
+class SpiListener {
+public:
+  virtual ~SpiListener() {}
+  virtual void onSpiCommand(uint8_t command) = 0;
+  virtual void onSpiData(const uint8_t *bytes, size_t length) = 0;
+};
+
+class SpiBus {
+public:
+  void setControlPins(int8_t cs, int8_t dc);
+  void setClockHz(uint32_t hz) { clockHz_ = hz ? hz : 1; }
+  void setListener(SpiListener *listener) { listener_ = listener; }
+
+  void setRecording(bool enabled) { recording_ = enabled; }
+  const std::vector<SpiRecord> &records() const { return records_; }
+  const SpiCounters &counters() const { return counters_; }
+  void clear();
+
+  // Called by the SPIClass and spi_master stand-ins.
+  void beginTransaction();
+  void endTransaction();
+  void cpuWrite(const uint8_t *bytes, size_t length);
+  void dmaQueued(const uint8_t *bytes, size_t length);
+  void dmaRetired();
+  void pinWritten(uint8_t pin, uint8_t level);
+
+  uint8_t dmaInFlight() const { return dmaInFlight_; }
+
+private:
+  void transmit(const uint8_t *bytes, size_t length);
+  void record(SpiOp op, uint8_t value = 0);
+
+  int8_t cs_ = -1;
+  int8_t dc_ = -1;
+  uint8_t dcLevel_ = 1;
+  uint8_t dmaInFlight_ = 0;
+  uint32_t clockHz_ = 40000000;
+  bool recording_ = true;
+  SpiListener *listener_ = nullptr;
+  std::vector<SpiRecord> records_;
+  SpiCounters counters_;
+};
+
+SpiBus &spiBus();
+
+} // namespace sim
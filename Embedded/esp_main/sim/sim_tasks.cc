@@ -0,0 +1,229 @@
+// FreeRTOS tasks for the host build (see freertos/task.h). The thread that
+// calls setup()/loop() is the "loopTask" on core 1, created on first use.
+// Exactly one task thread runs at any moment; the others park on their own
+// condition variable until the scheduler hands them the baton. A task runs
+// until its clock passes that of another runnable task, or it blocks.
+#include "Arduino.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct SimTask {
+  int id = 0;
+  const char *name = "";
+  BaseType_t core = 1;
+  uint64_t clock = 0;
+  bool waiting = false;
+  uint64_t wakeAt = 0;
+  uint32_t notifications = 0;
+  uint64_t idleMicros = 0;
+  bool finished = false;
+  TaskFunction_t code = nullptr;
+  void *parameters = nullptr;
+  std::condition_variable wake;
+};
+
+namespace {
+
+constexpr uint64_t NEVER = UINT64_MAX;
+
+// Heap-allocated and never freed: a parked task thread may still be
+// waiting on these when the process exits.
+std::mutex &schedulerLock() {
+  static std::mutex *lock = new std::mutex;
+  return *lock;
+}
+
+std::vector<SimTask *> &allTasks() {
+  static std::vector<SimTask *> *tasks = new std::vector<SimTask *>;
+  return *tasks;
+}
+
+SimTask *running = nullptr;
+thread_local SimTask *self = nullptr;
+
+SimTask *currentTask() {
+  if (!self) {
+    SimTask *task = new SimTask;
+    task->id = static_cast<int>(allTasks().size());
+    task->name = "loopTask";
+    allTasks().push_back(task);
+    self = task;
+    running = task;
+  }
+  return self;
+}
+
+uint64_t readyAt(const SimTask *task) {
+  if (task->finished) {
+    return NEVER;
+  }
+  return task->waiting ? task->wakeAt : task->clock;
+}
+
+// Earliest runnable task, the current one winning ties; null if every
+// task waits forever.
+SimTask *pickNext(SimTask *me) {
+  SimTask *best = readyAt(me) == NEVER ? nullptr : me;
+  for (SimTask *task : allTasks()) {
+    const uint64_t at = readyAt(task);
+    if (at != NEVER && (!best || at < readyAt(best))) {
+      best = task;
+    }
+  }
+  return best;
+}
+
+void handOff(SimTask *me, SimTask *next) {
+  std::unique_lock<std::mutex> guard(schedulerLock());
+  running = next;
+  next->wake.notify_one();
+  if (me->finished) {
+    return;
+  }
+  me->wake.wait(guard, [me] { return running == me; });
+}
+
+void reschedule() {
+  SimTask *me = currentTask();
+  if (allTasks().size() < 2) {
+    return;
+  }
+  SimTask *next = pickNext(me);
+  if (!next) {
+    fprintf(stderr, "sim: every task is blocked forever (in %s)\n", me->name);
+    abort();
+  }
+  if (next != me) {
+    handOff(me, next);
+  }
+}
+
+void runTask(SimTask *task) {
+  self = task;
+  {
+    std::unique_lock<std::mutex> guard(schedulerLock());
+    task->wake.wait(guard, [task] { return running == task; });
+  }
+  task->code(task->parameters);
+  // FreeRTOS tasks must not return; treat it like vTaskDelete(NULL).
+  vTaskDelete(nullptr);
+}
+
+} // namespace
+
+namespace sim {
+
+uint64_t nowMicros() { return currentTask()->clock; }
+
+uint64_t idleMicros() { return currentTask()->idleMicros; }
+
+void advanceMicros(uint64_t us) {
+  currentTask()->clock += us;
+  reschedule();
+}
+
+} // namespace sim
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t code, const char *name,
+                                   uint32_t stackDepth, void *parameters,
+                                   UBaseType_t priority,
+                                   TaskHandle_t *createdTask, BaseType_t coreId) {
+  (void)stackDepth;
+  (void)priority;
+  SimTask *creator = currentTask();
+  SimTask *task = new SimTask;
+  task->id = static_cast<int>(allTasks().size());
+  task->name = name ? name : "";
+  task->core = coreId;
+  task->clock = creator->clock;
+  task->code = code;
+  task->parameters = parameters;
+  allTasks().push_back(task);
+  std::thread(runTask, task).detach();
+  if (createdTask) {
+    *createdTask = task;
+  }
+  return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task) {
+  SimTask *me = currentTask();
+  if (task && task != me) {
+    // Only a task deleting itself is modelled.
+    fprintf(stderr, "sim: vTaskDelete() of another task is not supported\n");
+    abort();
+  }
+  me->finished = true;
+  SimTask *next = pickNext(me);
+  if (!next) {
+    fprintf(stderr, "sim: last runnable task %s exited\n", me->name);
+    abort();
+  }
+  handOff(me, next);
+  // Park this thread for good; it no longer takes part in scheduling.
+  std::unique_lock<std::mutex> guard(schedulerLock());
+  me->wake.wait(guard, [] { return false; });
+}
+
+void vTaskDelay(TickType_t ticks) {
+  sim::advanceMicros(static_cast<uint64_t>(ticks) * portTICK_PERIOD_MS * 1000);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() { return currentTask(); }
+
+const char *pcTaskGetName(TaskHandle_t task) {
+  return (task ? task : currentTask())->name;
+}
+
+BaseType_t xPortGetCoreID() { return currentTask()->core; }
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+  (void)task;
+  return 0;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+  SimTask *me = currentTask();
+  ++task->notifications;
+  if (task->waiting) {
+    task->waiting = false;
+    task->clock = std::max(task->clock, me->clock);
+  }
+  return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higherPriorityTaskWoken) {
+  xTaskNotifyGive(task);
+  if (higherPriorityTaskWoken) {
+    *higherPriorityTaskWoken = pdFALSE;
+  }
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait) {
+  SimTask *me = currentTask();
+  if (me->notifications == 0 && ticksToWait != 0) {
+    const uint64_t sleptAt = me->clock;
+    me->waiting = true;
+    me->wakeAt = ticksToWait == portMAX_DELAY
+                     ? NEVER
+                     : me->clock + static_cast<uint64_t>(ticksToWait) *
+                                       portTICK_PERIOD_MS * 1000;
+    reschedule();
+    if (me->waiting) {
+      // Nobody notified us before the timeout.
+      me->waiting = false;
+      me->clock = std::max(me->clock, me->wakeAt);
+    }
+    me->idleMicros += me->clock - sleptAt;
+  }
+  const uint32_t count = me->notifications;
+  if (clearCountOnExit) {
+    me->notifications = 0;
+  } else if (count) {
+    --me->notifications;
+  }
+  return count;
+}
@@ -1,14 +1,34 @@
 #include <Arduino.h>
 
 #include <WiFi.h>
+#include <Preferences.h>
 #include "esp_eap_client.h"
+#include "esp_sntp.h"
 #include <WiFiClientSecure.h>
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
 
+#include <atomic>
+
 #include <SPI.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_ST7735.h>
+#include <Adafruit_ST77xxRenderer.h>
+
+#include "driver/dac_continuous.h"
+#include "esp_heap_caps.h"
+
+#include "audio_mixer.h"
+#include "chime_clips.h"
+#include "durable_log.h"
+#include "fixed_string.h"
+#include "json_arena.h"
+#include "latency_histogram.h"
+#include "line_reader.h"
+#include "loop_scheduler.h"
+#include "seqlock.h"
+#include "spsc_queue.h"
+#include "sse_reader.h"
 
 #include "secrets.h"
 
@@ -23,38 +43,180 @@
 #define HAS_PET_SPRITE 0
 #endif
 
+// Headers from `convert_image_to_rgb565.py --bpp 4|8` define PET_SPRITE_INDEXED.
+#ifndef PET_SPRITE_INDEXED
+#define PET_SPRITE_INDEXED 0
+#endif
+
 #define TFT_CS  5
 #define TFT_RST 4
 #define TFT_A0  2
 #define TFT_SDA 23
 #define TFT_SDK 18
-Adafruit_ST7735 tft = Adafruit_ST7735(TFT_CS, TFT_A0, TFT_RST);
+// No reset pin for the library: resetPanel() pulses TFT_RST itself, so
+// setup() can use the reset time instead of sleeping through it.
+Adafruit_ST7735 tft = Adafruit_ST7735(TFT_CS, TFT_A0, -1);
+// Non-virtual front end for the hot text/circle/bitmap paths.
+Adafruit_ST77xxRenderer<Adafruit_ST7735, 0> fastTft(tft);
 
+// DAC channel 0; the audio engine drives it through DAC_CHANNEL_MASK_CH0.
 #define AUDIO_PIN 25
 
 constexpr bool USE_INSECURE_TLS_FOR_DEV = true;
 constexpr char ROOT_CA[] = "";
 
-constexpr unsigned long WIFI_RETRY_MS = 500;
-constexpr unsigned long REMINDER_POLL_MS = 30UL * 1000UL;
-constexpr unsigned long SUMMARY_REFRESH_MS = 5UL * 60UL * 1000UL;
-constexpr unsigned long SCHEDULE_REFRESH_MS = 15UL * 60UL * 1000UL;
-
-unsigned long lastReminderPollAt = 0;
-unsigned long lastSummaryRefreshAt = 0;
-unsigned long lastScheduleRefreshAt = 0;
+// Wire format for API request and response bodies: MessagePack (1) or
+// JSON (0). Build with -DAPI_USE_MSGPACK=0 to compare. Pushed /events data
+// is always JSON, since an event stream is text.
+#ifndef API_USE_MSGPACK
+#define API_USE_MSGPACK 1
+#endif
+constexpr const char *API_CONTENT_TYPE = API_USE_MSGPACK ? "application/msgpack" : "application/json";
+
+// A reconnect first goes straight to the last access point and channel; a
+// full scan and EAP exchange follows if that has not worked within
+// WIFI_FAST_TIMEOUT_MS. Rounds that fail back off up to WIFI_BACKOFF_MAX_MS.
+constexpr unsigned long WIFI_FAST_TIMEOUT_MS = 3000;
+constexpr unsigned long WIFI_FULL_TIMEOUT_MS = 20000;
+constexpr unsigned long WIFI_BACKOFF_MIN_MS = 1000;
+constexpr unsigned long WIFI_BACKOFF_MAX_MS = 60UL * 1000UL;
+constexpr const char *NTP_SERVER_PRIMARY = "pool.ntp.org";
+constexpr const char *NTP_SERVER_SECONDARY = "time.google.com";
+// One /device-sync round trip covers the status and the schedule, each only
+// when it changed. Only used while the /events push stream is down;
+// reminders are scheduled on the device either way.
+constexpr unsigned long SYNC_INTERVAL_MS = 30UL * 1000UL;
+// A local or pushed reminder has no poll after it to clear the banner, so it
+// clears itself after as long as a polled one used to stay up.
+constexpr unsigned long REMINDER_BANNER_MS = SYNC_INTERVAL_MS;
+constexpr unsigned long PET_FRAME_MS = 250;
+// The local reminder schedule is in whole minutes; checking it this often
+// shows a reminder within a second of its time.
+constexpr unsigned long REMINDER_CHECK_MS = 1000;
+// Longest loop() sleep. Everything the loop task does is on a deadline or
+// wakes it (see wakeLoopTask()); this only bounds a missed wake-up.
+constexpr unsigned long LOOP_MAX_IDLE_MS = 1000;
+
+// Water/stress history strip below the forest scene, one sample per row,
+// newest at the bottom. Rows scroll in hardware (VSCRDEF/VSCRSADD), so a
+// new sample costs one 128-pixel row plus one VSCRSADD regardless of depth.
+// A row is taken every HISTORY_SAMPLE_MS whether or not the status moved,
+// so the strip is a timeline: 32 rows cover the last 2 h 40 min.
+constexpr int16_t HISTORY_CHART_Y = 128;
+constexpr uint8_t HISTORY_CHART_ROWS = 32;
+constexpr unsigned long HISTORY_SAMPLE_MS = 5UL * 60UL * 1000UL;
+// INITR_GREENTAB, rotation 0: 162 frame-memory lines, RASET offset 1, and
+// MADCTL.MY set, so screen row y sits on memory line 161 - (y + 1).
+constexpr uint16_t PANEL_MEMORY_LINES = 162;
+constexpr uint16_t PANEL_ROW_OFFSET = 1;
+constexpr uint16_t HISTORY_TOP_FIXED = PANEL_MEMORY_LINES - (PANEL_ROW_OFFSET + HISTORY_CHART_Y + HISTORY_CHART_ROWS);
+constexpr uint16_t HISTORY_BOTTOM_FIXED = PANEL_MEMORY_LINES - HISTORY_TOP_FIXED - HISTORY_CHART_ROWS;
+
+uint8_t petFrame = 0;
 bool waterReminderActive = false;
+bool eventStreamOpen = false;
+
+// What the loop task does, each item run by loopScheduler when due. Timed
+// items schedule themselves; the others are scheduled by loop() when it
+// finds something waiting for them.
+enum class LoopItem : uint8_t {
+  NetResults,
+  SerialInput,
+  Reminders,
+  Sync,
+  BannerTimeout,
+  PetFrame,
+  HistorySample,
+  Count,
+};
+
+LoopScheduler<static_cast<size_t>(LoopItem::Count)> loopScheduler;
+
+void scheduleLoopItem(LoopItem item, unsigned long delayMs) {
+  loopScheduler.runAt(static_cast<uint8_t>(item), millis() + delayMs);
+}
+
+// Loop task timings for the telemetry upload: how long each full redraw
+// took and how late each loop item ran. The loop task records into
+// loopHealth and, after a pass that recorded something, publishes a copy
+// for the network task.
+struct LoopHealth {
+  LatencyHistogram redraw;
+  LatencyHistogram lateness;
+};
+
+LoopHealth loopHealth;
+bool loopHealthChanged = false;
+Seqlock<LoopHealth> publishedLoopHealth;
+
+void noteLoopLateness(uint8_t, unsigned long lateMs) {
+  loopHealth.lateness.recordMillis(lateMs);
+  loopHealthChanged = true;
+}
 
-String serverTimeUtc;
-int scheduleIntervalMinutes = 0;
+// millis() at each step of the boot, 0 until it is reached. Printed once
+// the first status from the server is on screen, and by the "boot"
+// command. Loop task only.
+struct BootTimes {
+  unsigned long panelReady;  // controller configured, frame memory writable
+  unsigned long firstFrame;  // display switched on, showing the first frame
+  bool restored;             // that frame showed the saved status
+  unsigned long wifiUp;
+  unsigned long freshData;   // first status from the server drawn
+};
+
+BootTimes bootTimes = {};
+// The forest UI, not a drawStatus() message, is what the screen shows.
+bool forestOnScreen = false;
+
+struct HistorySample {
+  bool valid;
+  uint8_t water;
+  uint8_t stress;
+};
+// Indexed by chart RAM row; screen row i shows slot (i + historyScroll) % rows.
+HistorySample historySlots[HISTORY_CHART_ROWS] = {};
+uint8_t historyScroll = 0;
+bool historyChartDirty = true;
+
+// The server's view of this device. The network task fills in its own copy
+// (netState) from each response and publishes it through publishedState;
+// the loop task takes what changed into deviceState, which is all the
+// screen reads. Each section carries a version that moves whenever a
+// response brought that section, so a snapshot says which parts are new.
+struct ScheduleState {
+  bool enabled;
+  int16_t intervalMinutes;
+  int16_t utcOffsetMinutes;
+  float dailyGoalLiters; // NAN when the schedule did not say
+  char startTime[8];
+  char endTime[8];
+};
+
+struct StatusState {
+  uint8_t waterPercent;
+  uint8_t stressPercent;
+  float totalIntakeLiters;
+  float dailyGoalLiters; // NAN when the status did not say
+  int64_t nextReminderMs; // 0 when absent
+  char nextReminderAt[32];
+};
+
+struct DeviceState {
+  uint32_t scheduleVersion; // 0 until the first schedule
+  ScheduleState schedule;
+  uint32_t statusVersion; // 0 until the first status
+  StatusState status;
+};
+
+// Loop task only. Intake logged here shows in status until the next one
+// arrives from the server.
+DeviceState deviceState = {};
+// From whichever section said last.
 float dailyGoalLiters = 0.0f;
-float totalIntakeLiters = 0.0f;
-uint8_t waterPercent = 0;
-uint8_t stressPercent = 0;
-String nextReminderAt;
-String reminderTitle;
-String reminderMessage;
-String reminderAnimation;
+char reminderTitle[32] = "";
+char reminderMessage[64] = "";
+char reminderAnimation[24] = "";
 
 constexpr uint16_t COLOR_SKY = ST77XX_CYAN;
 constexpr uint16_t COLOR_MIST = 0xBE18;
@@ -92,7 +254,7 @@ void drawTree(int16_t x, int16_t trunkY, int16_t canopySize, uint16_t canopyColo
 }
 
 void drawStressIcon(int16_t x, int16_t y, uint16_t color) {
-  tft.drawCircle(x + 4, y + 4, 3, color);
+  fastTft.drawCircle(x + 4, y + 4, 3, color);
   tft.drawFastHLine(x, y + 4, 9, color);
   tft.drawFastVLine(x + 4, y, 9, color);
 }
@@ -122,23 +284,18 @@ void drawHudPanel() {
   tft.fillRect(0, 0, 128, 24, COLOR_PANEL);
   tft.drawFastHLine(0, 24, 128, ST77XX_BLACK);
 
-  tft.setTextWrap(false);
-  tft.setTextSize(1);
-  tft.setTextColor(ST77XX_BLACK, COLOR_PANEL);
-
   drawStressIcon(3, 8, ST77XX_BLACK);
-  tft.setCursor(14, 2);
-  tft.print("STRESS");
-  drawHudBar(14, 12, 40, 8, stressPercent, COLOR_STRESS_BAR);
+  fastTft.drawText(14, 2, "STRESS", ST77XX_BLACK, COLOR_PANEL);
+  drawHudBar(14, 12, 40, 8, deviceState.status.stressPercent, COLOR_STRESS_BAR);
 
-  tft.setCursor(74, 2);
-  tft.print("WATER");
-  drawHudBar(72, 12, 40, 8, waterPercent, COLOR_WATER_BAR);
+  fastTft.drawText(74, 2, "WATER", ST77XX_BLACK, COLOR_PANEL);
+  drawHudBar(72, 12, 40, 8, deviceState.status.waterPercent, COLOR_WATER_BAR);
   drawWaterIcon(117, 8, ST77XX_BLUE);
 }
 
 void drawBackground() {
-  tft.fillScreen(COLOR_MIST);
+  // Leave the history chart alone; it only repaints when marked dirty.
+  tft.fillRect(0, 0, 128, HISTORY_CHART_Y, COLOR_MIST);
 
   for (int x = 0; x < 128; x += 18) {
     drawTree(x, 70, 18, COLOR_TREE_DARK);
@@ -218,403 +375,2821 @@ void drawPetArt() {
   const int16_t safeHeight = PET_SPRITE_HEIGHT > 80 ? 80 : PET_SPRITE_HEIGHT;
   const int16_t spriteX = (128 - safeWidth) / 2;
   const int16_t spriteY = 32;
-  tft.drawRGBBitmap(
+#if PET_SPRITE_INDEXED
+  tft.drawIndexedBitmap(
+      spriteX,
+      spriteY,
+      PET_SPRITE_INDICES[petFrame],
+      PET_SPRITE_PALETTE,
+      PET_SPRITE_BPP,
+      PET_SPRITE_WIDTH,  // Row stride; the blitter clips anything past the edge.
+      safeHeight);
+#else
+  fastTft.drawRGBBitmap(
       spriteX,
       spriteY,
-      const_cast<uint16_t *>(PET_SPRITE_DATA),
+      PET_SPRITE_DATA,
       safeWidth,
       safeHeight);
+#endif
 #else
   drawCatSprite(46, 56, 3);
 #endif
 }
 
 void drawFooterText() {
-  tft.setTextWrap(false);
-  tft.setTextSize(1);
-  tft.setTextColor(ST77XX_BLACK, COLOR_DIRT);
   tft.fillRect(0, 116, 128, 12, COLOR_DIRT);
-  tft.setCursor(4, 118);
   if (waterReminderActive) {
-    tft.print("Hydrate now");
+    fastTft.drawText(4, 118, "Hydrate now", ST77XX_BLACK, COLOR_DIRT);
   } else {
-    tft.print("Water ");
-    tft.print(waterPercent);
-    tft.print("%  Stress ");
-    tft.print(stressPercent);
-    tft.print("%");
+    char line[32];
+    snprintf(line, sizeof(line), "Water %u%%  Stress %u%%", deviceState.status.waterPercent, deviceState.status.stressPercent);
+    fastTft.drawText(4, 118, line, ST77XX_BLACK, COLOR_DIRT);
   }
 }
 
-void renderForestUi() {
+// One chart row's 128 pixels; an invalid sample is an empty row. The sim's
+// --check-history compares the glass against these.
+void historyRowPixels(bool valid, uint8_t water, uint8_t stress, uint16_t *line) {
+  const int16_t waterEnd = valid ? 1 + (62 * water) / 100 : 0;
+  const int16_t stressEnd = valid ? 65 + (62 * stress) / 100 : 0;
+  for (int16_t x = 0; x < 128; ++x) {
+    uint16_t color = ST77XX_BLACK;
+    if (x == 64) {
+      color = COLOR_PANEL;
+    } else if (x >= 1 && x < waterEnd) {
+      color = COLOR_WATER_BAR;
+    } else if (x >= 65 && x < stressEnd) {
+      color = COLOR_STRESS_BAR;
+    }
+    line[x] = color;
+  }
+}
+
+void drawHistoryRow(uint8_t slot) {
+  uint16_t line[128];
+  const HistorySample &sample = historySlots[slot];
+  historyRowPixels(sample.valid, sample.water, sample.stress, line);
+
+  tft.startWrite();
+  tft.setAddrWindow(0, HISTORY_CHART_Y + slot, 128, 1);
+  tft.writePixels(line, 128);
+  tft.endWrite();
+}
+
+void scrollHistoryChart() {
+  // MY reverses memory lines, so advancing the window means stepping back.
+  tft.scrollTo(HISTORY_TOP_FIXED + (HISTORY_CHART_ROWS - historyScroll) % HISTORY_CHART_ROWS);
+}
+
+void redrawHistoryChart() {
+  tft.setScrollArea(HISTORY_TOP_FIXED, HISTORY_CHART_ROWS, HISTORY_BOTTOM_FIXED);
+  for (uint8_t slot = 0; slot < HISTORY_CHART_ROWS; ++slot) {
+    drawHistoryRow(slot);
+  }
+  scrollHistoryChart();
+  historyChartDirty = false;
+}
+
+void pushHistorySample(uint8_t water, uint8_t stress) {
+  // The oldest row becomes the newest: rewrite it, then move it to the bottom.
+  const uint8_t slot = historyScroll;
+  historySlots[slot] = {true, water, stress};
+  historyScroll = (historyScroll + 1) % HISTORY_CHART_ROWS;
+  if (historyChartDirty) {
+    return;
+  }
+  drawHistoryRow(slot);
+  scrollHistoryChart();
+}
+
+// Charts the current status, then comes back HISTORY_SAMPLE_MS later.
+void sampleHistory() {
+  pushHistorySample(deviceState.status.waterPercent, deviceState.status.stressPercent);
+  scheduleLoopItem(LoopItem::HistorySample, HISTORY_SAMPLE_MS);
+}
+
+void drawForestUi() {
+  // Prints one bus-traffic line per frame with -DSPITFT_BUS_STATS, else empty.
+  Adafruit_SPITFT::FrameProfile frameProfile(tft, "frame", &Serial);
+
   drawBackground();
   drawHudPanel();
   drawPetArt();
   drawFooterText();
+  if (historyChartDirty) {
+    redrawHistoryChart();
+  }
 
   if (waterReminderActive) {
     tft.fillRect(12, 30, 104, 18, ST77XX_BLUE);
     tft.drawRect(12, 30, 104, 18, ST77XX_WHITE);
-    tft.setTextColor(ST77XX_WHITE, ST77XX_BLUE);
-    tft.setTextWrap(false);
-    tft.setCursor(18, 36);
-    tft.print("TIME TO HYDRATE!");
+    fastTft.drawText(18, 36, "TIME TO HYDRATE!", ST77XX_WHITE, ST77XX_BLUE);
   }
 }
 
-bool isHttpsUrl(const String &url) {
-  return url.startsWith("https://");
+// Timed up to the last pixel write handed to the SPI bus.
+void renderForestUi() {
+  const unsigned long startedAt = micros();
+  drawForestUi();
+  loopHealth.redraw.recordMicros(micros() - startedAt);
+  loopHealthChanged = true;
+  forestOnScreen = true;
+}
+
+bool isHttpsUrl(const char *url) {
+  return strncmp(url, "https://", 8) == 0;
 }
 
-void drawStatus(const String &line1, const String &line2 = "", uint16_t bg = ST77XX_WHITE, uint16_t fg = ST77XX_BLACK) {
+void drawStatus(const char *line1, const char *line2 = "", uint16_t bg = ST77XX_WHITE, uint16_t fg = ST77XX_BLACK) {
   tft.fillScreen(bg);
-  tft.setTextWrap(true);
-  tft.setTextColor(fg);
-  tft.setCursor(4, 8);
-  tft.setTextSize(1);
-  tft.println(line1);
-  if (line2.length() > 0) {
-    tft.println();
-    tft.println(line2);
+  historyChartDirty = true;
+  forestOnScreen = false;
+  FixedString<96> text(line1);
+  if (line2[0] != '\0') {
+    text.append("\n\n").append(line2);
   }
+  // Like print() from a cursor at (4, 8): later lines start at column 0.
+  fastTft.drawText(4, 8, text.c_str(), fg, bg, 1, true, 0);
 }
 
-void setReminderTone(bool enabled) {
-  if (enabled) {
-    ledcWriteTone(AUDIO_PIN, 1800);
-    ledcWrite(AUDIO_PIN, 128);
-  } else {
-    ledcWriteTone(AUDIO_PIN, 0);
-    ledcWrite(AUDIO_PIN, 0);
+// Sound runs on its own task: the loop task queues clips in audioCommands
+// and the audio task mixes them into the DAC's DMA buffers. The DMA engine
+// clocks samples out on its own and interrupts once per finished buffer;
+// the interrupt hands that buffer back in audioFreeBuffers, so the CPU only
+// decodes and mixes a buffer at a time and never touches single samples on
+// a timer. The DAC runs only while something plays.
+constexpr uint32_t AUDIO_SAMPLE_RATE = CHIME_SAMPLE_RATE;
+constexpr size_t AUDIO_DMA_BUFFERS = 4;
+// 16 ms per buffer at 16 kHz, so four buffers ride out 48 ms of the audio
+// task not getting the CPU.
+constexpr size_t AUDIO_BUFFER_SAMPLES = 256;
+#if CONFIG_DAC_DMA_AUTO_16BIT_ALIGN
+constexpr size_t AUDIO_DMA_BYTES_PER_SAMPLE = 2;
+#else
+constexpr size_t AUDIO_DMA_BYTES_PER_SAMPLE = 1;
+#endif
+constexpr size_t AUDIO_VOICES = 3;
+constexpr uint32_t AUDIO_TASK_STACK_BYTES = 3 * 1024;
+// Above the loop task on the same core: a refill is short and must not
+// wait behind a frame.
+constexpr UBaseType_t AUDIO_TASK_PRIORITY = 2;
+constexpr BaseType_t AUDIO_TASK_CORE = 1;
+constexpr uint16_t CLICK_GAIN = AudioMixer<AUDIO_VOICES>::UNITY_GAIN / 2;
+
+const AudioClip REMINDER_CHIME = {CHIME_REMINDER_ADPCM, CHIME_REMINDER_SAMPLES, CHIME_REMINDER_STEP_INDEX};
+const AudioClip UI_CLICK = {CHIME_CLICK_ADPCM, CHIME_CLICK_SAMPLES, CHIME_CLICK_STEP_INDEX};
+
+struct AudioCommand {
+  const AudioClip *clip;
+  uint16_t gain; // 0 stops clip
+};
+
+// Written by the audio task (underruns by the DMA interrupt), read by
+// whoever prints them.
+struct AudioStats {
+  std::atomic<uint32_t> clipsStarted{0};
+  std::atomic<uint32_t> buffersFilled{0};
+  std::atomic<uint32_t> worstFillMicros{0};
+  // Buffers the DMA played a second time because no fresh samples were
+  // ready. Each one is a 16 ms stutter.
+  std::atomic<uint32_t> underruns{0};
+  std::atomic<uint32_t> clippedSamples{0};
+};
+
+AudioStats audioStats;
+TaskHandle_t audioTaskHandle = nullptr;
+dac_continuous_handle_t audioDac = nullptr;
+SpscQueue<AudioCommand, 8> audioCommands;
+SpscQueue<uint8_t *, AUDIO_DMA_BUFFERS> audioFreeBuffers;
+
+// DMA interrupt. The ring is full only once every buffer has played since
+// its last refill, so the DMA is now replaying old samples; a buffer that
+// comes back while still queued is one more of those.
+bool onAudioBufferDone(dac_continuous_handle_t, const dac_event_data_t *event, void *) {
+  if (audioFreeBuffers.size() == AUDIO_DMA_BUFFERS) {
+    audioStats.underruns.fetch_add(1, std::memory_order_relaxed);
+    return false;
   }
+  audioFreeBuffers.push(static_cast<uint8_t *>(event->buf));
+  if (audioFreeBuffers.size() == AUDIO_DMA_BUFFERS) {
+    audioStats.underruns.fetch_add(1, std::memory_order_relaxed);
+  }
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR(audioTaskHandle, &woken);
+  return woken == pdTRUE;
 }
 
-void ensureWifiConnected() {
-    if (WiFi.status() == WL_CONNECTED) {
-        return;
-    }
-
-    WiFi.disconnect(true);
-    WiFi.mode(WIFI_STA);
-    delay(100);
-
-    drawStatus("Connecting WiFi", WIFI_SSID);
+// Audio task only from here to startAudio().
+AudioMixer<AUDIO_VOICES> audioMixer;
+uint8_t audioScratch[AUDIO_BUFFER_SAMPLES];
+
+// The DAC idles at 0 V, the mixer centres on 128, so output ramps up before
+// the first clip and back down after the last, rather than clicking.
+// Stopping waits until every DMA buffer holds 0, since a restart replays
+// them before any fresh one.
+enum class AudioOutput : uint8_t {
+  Off,
+  RampUp,
+  Mixing,
+  RampDown,
+};
+
+AudioOutput audioOutput = AudioOutput::Off;
+size_t audioQuietBuffers = 0;
+
+void fillAudioRamp(uint8_t from, uint8_t to) {
+  for (size_t i = 0; i < AUDIO_BUFFER_SAMPLES; ++i) {
+    audioScratch[i] = static_cast<uint8_t>(from + (static_cast<int>(to) - from) * static_cast<int>(i) /
+                                                      static_cast<int>(AUDIO_BUFFER_SAMPLES));
+  }
+}
 
-    esp_eap_client_set_identity((uint8_t*)WIFI_USERNAME, strlen(WIFI_USERNAME));
-    esp_eap_client_set_username((uint8_t*)WIFI_USERNAME, strlen(WIFI_USERNAME));
-    esp_eap_client_set_password((uint8_t*)WIFI_PASSWORD, strlen(WIFI_PASSWORD));
+void refillAudioBuffer(uint8_t *buffer) {
+  const uint32_t start = micros();
+  switch (audioOutput) {
+    case AudioOutput::Off:
+      return;
+    case AudioOutput::RampUp:
+      fillAudioRamp(0, 128);
+      audioOutput = AudioOutput::Mixing;
+      break;
+    case AudioOutput::Mixing:
+      audioMixer.render(audioScratch, AUDIO_BUFFER_SAMPLES);
+      audioStats.clippedSamples.store(audioMixer.clipped(), std::memory_order_relaxed);
+      if (!audioMixer.active()) {
+        audioOutput = AudioOutput::RampDown;
+        audioQuietBuffers = 0;
+      }
+      break;
+    case AudioOutput::RampDown:
+      if (audioQuietBuffers == 0) {
+        fillAudioRamp(128, 0);
+      } else {
+        memset(audioScratch, 0, sizeof(audioScratch));
+      }
+      ++audioQuietBuffers;
+      break;
+  }
 
-    esp_wifi_sta_enterprise_enable();
+  size_t loaded = 0;
+  dac_continuous_write_asynchronously(audioDac, buffer, AUDIO_BUFFER_SAMPLES * AUDIO_DMA_BYTES_PER_SAMPLE,
+                                      audioScratch, AUDIO_BUFFER_SAMPLES, &loaded);
+  audioStats.buffersFilled.fetch_add(1, std::memory_order_relaxed);
+  const uint32_t elapsed = micros() - start;
+  if (elapsed > audioStats.worstFillMicros.load(std::memory_order_relaxed)) {
+    audioStats.worstFillMicros.store(elapsed, std::memory_order_relaxed);
+  }
 
-    WiFi.begin(WIFI_SSID);
+  // The ramp and then a buffer of 0 for every other one.
+  if (audioOutput == AudioOutput::RampDown && audioQuietBuffers > AUDIO_DMA_BUFFERS) {
+    dac_continuous_stop_async_writing(audioDac);
+    dac_continuous_disable(audioDac);
+    audioOutput = AudioOutput::Off;
+    uint8_t *stale;
+    while (audioFreeBuffers.pop(stale)) {
+    }
+  }
+}
 
-    while (WiFi.status() != WL_CONNECTED) {
-        delay(WIFI_RETRY_MS);
-        Serial.print('.');
+void takeAudioCommands() {
+  AudioCommand command;
+  while (audioCommands.pop(command)) {
+    if (command.gain == 0) {
+      audioMixer.stop(command.clip);
+      continue;
     }
+    audioMixer.play(command.clip, command.gain);
+    audioStats.clipsStarted.fetch_add(1, std::memory_order_relaxed);
+    if (audioOutput == AudioOutput::Off) {
+      if (dac_continuous_enable(audioDac) != ESP_OK || dac_continuous_start_async_writing(audioDac) != ESP_OK) {
+        audioMixer.stop();
+        continue;
+      }
+      audioOutput = AudioOutput::RampUp;
+    } else if (audioOutput == AudioOutput::RampDown) {
+      // Straight back to mixing unless the ramp down is already queued.
+      audioOutput = audioQuietBuffers == 0 ? AudioOutput::Mixing : AudioOutput::RampUp;
+    }
+  }
+}
 
-    Serial.println();
-    Serial.print("WiFi connected. IP: ");
-    Serial.println(WiFi.localIP());
-    drawStatus("WiFi connected", WiFi.localIP().toString());
+void audioTaskMain(void *) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    takeAudioCommands();
+    uint8_t *buffer;
+    while (audioFreeBuffers.pop(buffer)) {
+      refillAudioBuffer(buffer);
+    }
+  }
 }
 
-void configureSecureClient(WiFiClientSecure &client, const String &url) {
-  if (!isHttpsUrl(url)) {
+void startAudio() {
+  dac_continuous_config_t config = {};
+  config.chan_mask = DAC_CHANNEL_MASK_CH0;
+  config.desc_num = AUDIO_DMA_BUFFERS;
+  config.buf_size = AUDIO_BUFFER_SAMPLES * AUDIO_DMA_BYTES_PER_SAMPLE;
+  config.freq_hz = AUDIO_SAMPLE_RATE;
+  config.offset = 0;
+  // The default PLL_D2 clock cannot divide down to 16 kHz.
+  config.clk_src = DAC_DIGI_CLK_SRC_APLL;
+  config.chan_mode = DAC_CHANNEL_MODE_SIMUL;
+
+  dac_event_callbacks_t callbacks = {};
+  callbacks.on_convert_done = onAudioBufferDone;
+  if (dac_continuous_new_channels(&config, &audioDac) != ESP_OK ||
+      dac_continuous_register_event_callback(audioDac, &callbacks, nullptr) != ESP_OK) {
+    audioDac = nullptr;
+    Serial.println("DAC init failed, no sound");
     return;
   }
+  if (xTaskCreatePinnedToCore(audioTaskMain, "audio", AUDIO_TASK_STACK_BYTES, nullptr, AUDIO_TASK_PRIORITY,
+                              &audioTaskHandle, AUDIO_TASK_CORE) != pdPASS) {
+    audioTaskHandle = nullptr;
+    Serial.println("Audio task start failed, no sound");
+  }
+}
 
-  if (!USE_INSECURE_TLS_FOR_DEV && strlen(ROOT_CA) > 0) {
-    client.setCACert(ROOT_CA);
+// Loop task only. gain 0 stops every voice playing clip.
+void playSound(const AudioClip *clip, uint16_t gain = AudioMixer<AUDIO_VOICES>::UNITY_GAIN) {
+  if (audioTaskHandle == nullptr) {
     return;
   }
-
-  client.setInsecure();
+  if (!audioCommands.push({clip, gain})) {
+    return;
+  }
+  xTaskNotifyGive(audioTaskHandle);
 }
 
-template <typename TClient>
-bool sendRequestWithClient(
-    TClient &client,
-    const String &method,
-    const String &url,
-    JsonDocument *responseDoc,
-    int &statusCode,
-    const char *jsonBody) {
-    HTTPClient http;
-    if (!http.begin(client, url)) {
-        Serial.println("HTTPClient begin failed");
-        return false;
-    }
+void setReminderChime(bool enabled) {
+  playSound(&REMINDER_CHIME, enabled ? AudioMixer<AUDIO_VOICES>::UNITY_GAIN : 0);
+}
 
-    http.setTimeout(10000);
-    http.addHeader("Accept", "application/json");
-    if (jsonBody != nullptr) {
-        http.addHeader("Content-Type", "application/json");
-    }
+void printAudioStats() {
+  Serial.printf("audio: %lu clips, %lu buffers filled (worst %lu us), %lu underruns, %lu clipped samples\n",
+                (unsigned long)audioStats.clipsStarted.load(), (unsigned long)audioStats.buffersFilled.load(),
+                (unsigned long)audioStats.worstFillMicros.load(), (unsigned long)audioStats.underruns.load(),
+                (unsigned long)audioStats.clippedSamples.load());
+}
 
-    if (method == "GET") {
-        statusCode = http.GET();
-    } else if (method == "POST") {
-        statusCode = http.POST(
-            reinterpret_cast<uint8_t *>(const_cast<char *>(jsonBody)),
-            strlen(jsonBody)
-        );
-    } else {
-        http.end();
-        Serial.println("Unsupported HTTP method");
-        return false;
-    }
+// HTTP runs on its own task pinned to core 0 (next to the WiFi stack), so a
+// slow or dead backend never stalls drawing, the reminder chime or Serial on
+// the loop task (core 1). Jobs go over in netRequests; parsed results come
+// back in netResults and are applied by loop(). Each ring has exactly one
+// producer and one consumer.
+enum class NetJob : uint8_t {
+  FetchSchedule,
+  FetchSummary,
+  PollReminder,
+  SyncDevice,
+  FlushEvents,
+  ReportStats,
+  // Reported by the network task, never queued.
+  WifiConnecting,
+  WifiConnected,
+  EventsOpened,
+  EventsClosed,
+  PushedSync,
+};
+
+struct NetRequest {
+  NetJob job;
+};
+
+// Plain data only, copied through the ring. Floats are NAN and percents -1
+// when the response left them out, so the current value is kept.
+struct NetResult {
+  NetJob job;
+  bool ok;
+  // Schedule and status go through publishedState; a result only says
+  // the job is done and carries what happened once.
+  bool hasReminder;
+  bool remindNow;
+  // The response's server_time_utc as epoch ms, 0 when absent, and the
+  // millis() it was read at (for a WiFi status, when the link changed).
+  int64_t serverTimeMs;
+  unsigned long receivedAt;
+  char reason[24];
+  char reminderTitle[32];
+  char reminderMessage[64];
+  char reminderAnimation[24];
+  char wifiAddress[16];
+};
+
+constexpr uint32_t NET_TASK_STACK_BYTES = 12 * 1024;
+constexpr UBaseType_t NET_TASK_PRIORITY = 1;
+constexpr BaseType_t NET_TASK_CORE = 0;
+constexpr unsigned long NET_WAIT_POLL_MS = 1;
+
+TaskHandle_t netTaskHandle = nullptr;
+TaskHandle_t loopTaskHandle = nullptr;
+// Loop task only: one bit per NetJob queued and not yet answered.
+uint16_t netJobsPending = 0;
+static_assert(static_cast<uint8_t>(NetJob::PushedSync) < 16, "a NetJob bit must fit netJobsPending");
+SpscQueue<NetRequest, 8> netRequests;
+SpscQueue<NetResult, 8> netResults;
+Seqlock<DeviceState> publishedState;
+// Network task only.
+DeviceState netState = {};
+bool netStateChanged = false;
+
+// Heap allocations made by the network and loop tasks, counted by the
+// heap's allocation hook. That needs an SDK built with
+// CONFIG_HEAP_USE_HOOKS (the sim's malloc wrapper calls it too); without
+// it the counts stay 0. On the device the hook also sees what HTTPClient,
+// TLS and lwIP allocate on the network task's behalf, so a steady count
+// there is the libraries' floor; the sim counts main.cc's own.
+std::atomic<uint32_t> netTaskAllocations{0};
+std::atomic<uint32_t> loopTaskAllocations{0};
+
+#if CONFIG_HEAP_USE_HOOKS
+IRAM_ATTR void esp_heap_trace_alloc_hook(void *, size_t, uint32_t) {
+  const TaskHandle_t task = xTaskGetCurrentTaskHandle();
+  if (task == netTaskHandle) {
+    netTaskAllocations.fetch_add(1, std::memory_order_relaxed);
+  } else if (task == loopTaskHandle) {
+    loopTaskAllocations.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+#endif
 
-    String payload;
-    if (statusCode > 0) {
-        payload = http.getString();
-    }
-    http.end();
+// Allocations per job, or per result applied on the loop task. A kind's
+// first run is warm-up and left out: it sizes the buffers later runs reuse.
+// After that a poll should allocate nothing. Written by one task each,
+// printed by the "net" command.
+struct HeapJobStats {
+  uint32_t warmedJobs; // bit per NetJob seen once; writer only
+  std::atomic<uint32_t> jobs;
+  std::atomic<uint32_t> allocations;
+  std::atomic<uint32_t> worst;
+};
+
+HeapJobStats netHeapStats;
+HeapJobStats loopHeapStats;
+
+void recordJobAllocations(HeapJobStats &stats, NetJob job, uint32_t allocations) {
+  const uint32_t jobBit = 1u << static_cast<uint8_t>(job);
+  if (!(stats.warmedJobs & jobBit)) {
+    stats.warmedJobs |= jobBit;
+    return;
+  }
+  stats.jobs.fetch_add(1, std::memory_order_relaxed);
+  stats.allocations.fetch_add(allocations, std::memory_order_relaxed);
+  if (allocations > stats.worst.load(std::memory_order_relaxed)) {
+    stats.worst.store(allocations, std::memory_order_relaxed);
+  }
+}
 
-    Serial.printf("%s %s -> %d\n", method.c_str(), url.c_str(), statusCode);
-    if (statusCode <= 0) {
-        Serial.println("HTTP request failed before response");
-        return false;
-    }
+void copyText(char *dest, size_t size, const char *text) {
+  snprintf(dest, size, "%s", text ? text : "");
+}
 
-    if (responseDoc == nullptr || payload.isEmpty()) {
-        return true;
-    }
+// Dotted quad, without the String that IPAddress::toString() returns.
+// 16 bytes hold any address.
+void formatAddress(char *dest, size_t size, const IPAddress &address) {
+  snprintf(dest, size, "%u.%u.%u.%u", address[0], address[1], address[2], address[3]);
+}
 
-    DeserializationError error = deserializeJson(*responseDoc, payload);
-    if (error) {
-        Serial.print("JSON parse failed: ");
-        Serial.println(error.c_str());
-        Serial.println(payload);
-        return false;
-    }
+// The last status the server sent, kept in NVS so a cold boot can draw it
+// before WiFi is up. Only what the screen shows; the rest would be stale
+// by then anyway.
+struct SavedStatus {
+  uint8_t waterPercent;
+  uint8_t stressPercent;
+  float totalIntakeLiters;
+  float dailyGoalLiters; // NAN when unknown
+};
+
+// What NVS holds. Set by restoreSavedStatus() before the network task
+// starts; network task only after that.
+SavedStatus savedStatus = {};
+uint32_t savedStatusVersion = 0;
+
+// setup() only. Puts the saved status in deviceState; false when there is
+// none (first boot, or NVS unavailable).
+bool restoreSavedStatus() {
+  Preferences prefs;
+  if (!prefs.begin("screen", true)) {
+    return false;
+  }
+  const bool found =
+      prefs.getBytesLength("status") == sizeof(SavedStatus) &&
+      prefs.getBytes("status", &savedStatus, sizeof(SavedStatus)) == sizeof(SavedStatus);
+  prefs.end();
+  if (!found) {
+    savedStatus = {};
+    return false;
+  }
 
-    return true;
+  StatusState &status = deviceState.status;
+  status.waterPercent = clampPercent(savedStatus.waterPercent);
+  status.stressPercent = clampPercent(savedStatus.stressPercent);
+  status.totalIntakeLiters = savedStatus.totalIntakeLiters;
+  status.dailyGoalLiters = savedStatus.dailyGoalLiters;
+  if (!isnan(savedStatus.dailyGoalLiters)) {
+    dailyGoalLiters = savedStatus.dailyGoalLiters;
+  }
+  return true;
 }
 
-bool sendRequest(
-    const String &method,
-    const String &url,
-    JsonDocument *responseDoc,
-    int &statusCode,
-    const char *jsonBody = nullptr) {
-    ensureWifiConnected();
+// Network task only. NVS is written only when what the screen shows
+// changed.
+void rememberStatus() {
+  if (netState.statusVersion == savedStatusVersion) {
+    return;
+  }
+  savedStatusVersion = netState.statusVersion;
+
+  const StatusState &status = netState.status;
+  SavedStatus saved = {};
+  saved.waterPercent = status.waterPercent;
+  saved.stressPercent = status.stressPercent;
+  saved.totalIntakeLiters = status.totalIntakeLiters;
+  saved.dailyGoalLiters = isnan(status.dailyGoalLiters) ? netState.schedule.dailyGoalLiters : status.dailyGoalLiters;
+  if (memcmp(&saved, &savedStatus, sizeof(saved)) == 0) {
+    return;
+  }
 
-    if (isHttpsUrl(url)) {
-        WiFiClientSecure secureClient;
-        configureSecureClient(secureClient, url);
-        return sendRequestWithClient(secureClient, method, url, responseDoc, statusCode, jsonBody);
-    }
+  savedStatus = saved;
+  Preferences prefs;
+  if (prefs.begin("screen", false)) {
+    prefs.putBytes("status", &saved, sizeof(saved));
+    prefs.end();
+  }
+}
 
-    WiFiClient client;
-    return sendRequestWithClient(client, method, url, responseDoc, statusCode, jsonBody);
+// loop() sleeps until its next deadline; anything another task hands it
+// calls this so it is seen at once.
+void wakeLoopTask() {
+  if (loopTaskHandle != nullptr) {
+    xTaskNotifyGive(loopTaskHandle);
+  }
 }
 
-String buildWaterUrl(const String &pathAndQuery) {
-  String url(API_BASE_URL);
-  url += pathAndQuery;
-  return url;
+// Network task only. Publishes whatever the job changed in netState first,
+// so the loop task sees it by the time it has the result. Waits for room
+// rather than dropping a result; loop() drains the ring whenever it wakes.
+void postNetResult(const NetResult &result) {
+  if (netStateChanged) {
+    publishedState.write(netState);
+    netStateChanged = false;
+  }
+  while (!netResults.push(result)) {
+    delay(NET_WAIT_POLL_MS);
+  }
+  wakeLoopTask();
+  // After the hand-over, so the flash write does not hold up the screen.
+  rememberStatus();
 }
 
-bool fetchWaterSchedule() {
-  StaticJsonDocument<512> doc;
-  int statusCode = 0;
-  String url = buildWaterUrl("/api/water/schedule?user_id=" + String(WATER_USER_ID));
+// UTC wall clock for the local reminder scheduler: an epoch reading and the
+// millis() it was taken at. SNTP sets it once WiFi is up and again on each
+// resync (hourly by default); until SNTP answers, the server_time_utc of
+// the last sync stands in, good to about a round trip.
+struct ClockSample {
+  int64_t epochMs;
+  unsigned long atMillis;
+};
+
+// Each SNTP result, from lwIP's task to the loop task.
+SpscQueue<ClockSample, 4> sntpSamples;
+
+void onSntpSync(struct timeval *tv) {
+  ClockSample sample = {static_cast<int64_t>(tv->tv_sec) * 1000 + tv->tv_usec / 1000, millis()};
+  sntpSamples.push(sample);
+  wakeLoopTask();
+}
+
+// Days since 1970-01-01 of a (proleptic Gregorian) calendar date.
+int64_t daysFromCivil(int year, int month, int day) {
+  year -= month <= 2;
+  const int era = (year >= 0 ? year : year - 399) / 400;
+  const int yearOfEra = year - era * 400;
+  const int dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  const int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  return static_cast<int64_t>(era) * 146097 + dayOfEra - 719468;
+}
 
-  if (!sendRequest("GET", url, &doc, statusCode)) {
+// "2026-10-16T14:05:00.123456+00:00" (or with "Z") as epoch milliseconds.
+// False, with epochMs untouched, for anything else, "" included.
+bool parseUtcMillis(const char *text, int64_t &epochMs) {
+  int year, month, day, hour, minute, second;
+  int consumed = 0;
+  if (sscanf(text, "%4d-%2d-%2dT%2d:%2d:%2d%n", &year, &month, &day, &hour, &minute, &second, &consumed) != 6) {
     return false;
   }
 
-  if (statusCode != 200) {
-    Serial.println("Schedule fetch returned non-200");
+  const char *rest = text + consumed;
+  int fraction = 0;
+  if (*rest == '.') {
+    // Milliseconds only; digits past the third count for nothing.
+    for (int scale = 100; isdigit(static_cast<unsigned char>(*++rest)); scale /= 10) {
+      fraction += (*rest - '0') * scale;
+    }
+  }
+
+  int offsetMinutes = 0;
+  if (*rest == '+' || *rest == '-') {
+    int offsetHours, offsetMins;
+    if (sscanf(rest + 1, "%2d:%2d", &offsetHours, &offsetMins) != 2) {
+      return false;
+    }
+    offsetMinutes = (offsetHours * 60 + offsetMins) * (*rest == '-' ? -1 : 1);
+  } else if (*rest != 'Z') {
     return false;
   }
 
-  scheduleIntervalMinutes = doc["interval_min"] | 0;
-  dailyGoalLiters = doc["daily_goal_liters"] | dailyGoalLiters;
+  const int64_t minutes = (daysFromCivil(year, month, day) * 24 + hour) * 60 + minute - offsetMinutes;
+  epochMs = (minutes * 60 + second) * 1000 + fraction;
+  return true;
+}
 
-  const char *startTime = doc["start_time"] | "";
-  const char *endTime = doc["end_time"] | "";
+void postWifiStatus(NetJob status) {
+  NetResult result = {};
+  result.job = status;
+  result.ok = true;
+  result.receivedAt = millis();
+  formatAddress(result.wifiAddress, sizeof(result.wifiAddress), WiFi.localIP());
+  postNetResult(result);
+}
 
-  Serial.printf(
-      "Water schedule: every %d min, window %s-%s, goal %.2f L\n",
-      scheduleIntervalMinutes,
-      startTime,
-      endTime,
-      dailyGoalLiters);
+// The WiFi link, owned by the network task. serviceWifi() runs once per
+// network task pass and never waits: it starts an association, checks on
+// it and gives up on it, so a dead access point costs the task nothing but
+// a status check. Jobs stay queued while the link is down. The access
+// point and channel of the last good link are kept in NVS, so even the
+// first connect after a reset can skip the scan. The IP lease is left to
+// DHCP, which asks for the last address again on its own.
+enum class WifiState : uint8_t {
+  Down,
+  FastConnecting,
+  Connecting,
+  Waiting,
+  Up,
+};
+
+struct WifiAccessPoint {
+  uint8_t bssid[6];
+  uint8_t channel;
+};
+
+struct WifiLink {
+  WifiState state = WifiState::Down;
+  unsigned long attemptAt = 0; // attempt start, or when Waiting ends
+  unsigned long downSince = 0;
+  unsigned long backoffMs = WIFI_BACKOFF_MIN_MS;
+  WifiAccessPoint lastAp = {};
+  bool lastApValid = false;
+};
+
+struct WifiStats {
+  uint32_t connects = 0;
+  uint32_t fastConnects = 0;
+  uint32_t failedAttempts = 0;
+  // From losing the link (or boot) to having it back.
+  uint32_t lastConnectMs = 0;
+  uint32_t worstConnectMs = 0;
+  uint64_t totalConnectMs = 0;
+};
+
+WifiLink wifiLink;
+WifiStats wifiStats;
+
+bool wifiLinkUp() {
+  return wifiLink.state == WifiState::Up;
+}
 
-  renderForestUi();
-  return true;
+// Runs on the WiFi event task; a dropped link or a fresh lease is handled
+// on the network task's next pass, which this brings forward.
+void onWifiEvent(arduino_event_id_t) {
+  if (netTaskHandle != nullptr) {
+    xTaskNotifyGive(netTaskHandle);
+  }
 }
 
-bool fetchWaterSummary() {
-  StaticJsonDocument<1536> doc;
-  int statusCode = 0;
-  String url = buildWaterUrl("/api/water/device-status?user_id=" + String(WATER_USER_ID));
+void beginWifi() {
+  WiFi.mode(WIFI_STA);
+  WiFi.setAutoReconnect(false);
+  WiFi.onEvent(onWifiEvent, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+  WiFi.onEvent(onWifiEvent, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+
+  // The EAP identity stays with the driver across reconnects.
+  esp_eap_client_set_identity((uint8_t*)WIFI_USERNAME, strlen(WIFI_USERNAME));
+  esp_eap_client_set_username((uint8_t*)WIFI_USERNAME, strlen(WIFI_USERNAME));
+  esp_eap_client_set_password((uint8_t*)WIFI_PASSWORD, strlen(WIFI_PASSWORD));
+  esp_wifi_sta_enterprise_enable();
+
+  Preferences prefs;
+  if (prefs.begin("wifi", true)) {
+    wifiLink.lastApValid =
+        prefs.getBytesLength("ap") == sizeof(WifiAccessPoint) &&
+        prefs.getBytes("ap", &wifiLink.lastAp, sizeof(WifiAccessPoint)) == sizeof(WifiAccessPoint);
+    prefs.end();
+  }
+  wifiLink.downSince = millis();
+}
 
-  if (!sendRequest("GET", url, &doc, statusCode)) {
-    return false;
+void startWifiAttempt(bool fast) {
+  postWifiStatus(NetJob::WifiConnecting);
+  WiFi.disconnect();
+  if (fast) {
+    WiFi.begin(WIFI_SSID, nullptr, wifiLink.lastAp.channel, wifiLink.lastAp.bssid);
+  } else {
+    WiFi.begin(WIFI_SSID);
   }
+  wifiLink.state = fast ? WifiState::FastConnecting : WifiState::Connecting;
+  wifiLink.attemptAt = millis();
+}
 
-  if (statusCode != 200) {
-    Serial.println("Summary fetch returned non-200");
-    return false;
+// NVS is written only when the access point changed.
+void rememberAccessPoint() {
+  const uint8_t *bssid = WiFi.BSSID();
+  if (bssid == nullptr) {
+    return;
+  }
+  WifiAccessPoint ap = {};
+  memcpy(ap.bssid, bssid, sizeof(ap.bssid));
+  ap.channel = static_cast<uint8_t>(WiFi.channel());
+  if (wifiLink.lastApValid && memcmp(&ap, &wifiLink.lastAp, sizeof(ap)) == 0) {
+    return;
   }
 
-  serverTimeUtc = String(doc["server_time_utc"] | "");
-  waterPercent = clampPercent(doc["water_percent"] | 0);
-  stressPercent = clampPercent(doc["stress_percent"] | 0);
+  wifiLink.lastAp = ap;
+  wifiLink.lastApValid = true;
+  Preferences prefs;
+  if (prefs.begin("wifi", false)) {
+    prefs.putBytes("ap", &ap, sizeof(ap));
+    prefs.end();
+  }
+}
 
-  JsonObject water = doc["water"];
-  totalIntakeLiters = water["total_intake_liters"] | 0.0f;
-  dailyGoalLiters = water["goal_liters"] | dailyGoalLiters;
-  nextReminderAt = String(water["next_reminder_at"] | "");
+void onWifiUp(bool fast) {
+  const unsigned long tookMs = millis() - wifiLink.downSince;
+  wifiLink.state = WifiState::Up;
+  wifiLink.backoffMs = WIFI_BACKOFF_MIN_MS;
 
-  Serial.printf(
-      "Device status: water=%u%% stress=%u%%, %.2f / %.2f L\n",
-      waterPercent,
-      stressPercent,
-      totalIntakeLiters,
-      dailyGoalLiters);
-  renderForestUi();
-  return true;
+  ++wifiStats.connects;
+  if (fast) {
+    ++wifiStats.fastConnects;
+  }
+  wifiStats.lastConnectMs = tookMs;
+  wifiStats.worstConnectMs = max(wifiStats.worstConnectMs, static_cast<uint32_t>(tookMs));
+  wifiStats.totalConnectMs += tookMs;
+
+  char address[16];
+  formatAddress(address, sizeof(address), WiFi.localIP());
+  Serial.printf("WiFi connected in %lu ms%s. IP: %s\n", tookMs, fast ? " (fast)" : "", address);
+  rememberAccessPoint();
+  postWifiStatus(NetJob::WifiConnected);
 }
 
-bool acknowledgeWaterReminder() {
-  StaticJsonDocument<256> requestDoc;
-  requestDoc["user_id"] = WATER_USER_ID;
+// Network task only. True on the pass the link came (back) up.
+bool serviceWifi() {
+  const wl_status_t status = WiFi.status();
+  const unsigned long now = millis();
 
-  char body[96];
-  size_t bodyLen = serializeJson(requestDoc, body, sizeof(body));
-  if (bodyLen == 0 || bodyLen >= sizeof(body)) {
-    Serial.println("Ack body serialization failed");
-    return false;
+  switch (wifiLink.state) {
+    case WifiState::Up:
+      if (status == WL_CONNECTED) {
+        return false;
+      }
+      Serial.println("WiFi link lost");
+      wifiLink.downSince = now;
+      startWifiAttempt(wifiLink.lastApValid);
+      return false;
+
+    case WifiState::Down:
+      if (status == WL_CONNECTED) {
+        onWifiUp(false);
+        return true;
+      }
+      startWifiAttempt(wifiLink.lastApValid);
+      return false;
+
+    case WifiState::FastConnecting:
+    case WifiState::Connecting: {
+      const bool fast = wifiLink.state == WifiState::FastConnecting;
+      if (status == WL_CONNECTED) {
+        onWifiUp(fast);
+        return true;
+      }
+      const bool failed = status == WL_CONNECT_FAILED || status == WL_NO_SSID_AVAIL;
+      if (!failed && now - wifiLink.attemptAt < (fast ? WIFI_FAST_TIMEOUT_MS : WIFI_FULL_TIMEOUT_MS)) {
+        return false;
+      }
+      ++wifiStats.failedAttempts;
+      if (fast) {
+        startWifiAttempt(false);
+        return false;
+      }
+      Serial.printf("WiFi connect failed, retrying in %lu ms\n", wifiLink.backoffMs);
+      WiFi.disconnect();
+      wifiLink.state = WifiState::Waiting;
+      wifiLink.attemptAt = now + wifiLink.backoffMs;
+      wifiLink.backoffMs = min(wifiLink.backoffMs * 2, WIFI_BACKOFF_MAX_MS);
+      return false;
+    }
+
+    case WifiState::Waiting:
+      if ((long)(now - wifiLink.attemptAt) >= 0) {
+        startWifiAttempt(wifiLink.lastApValid);
+      }
+      return false;
   }
+  return false;
+}
 
-  int statusCode = 0;
-  String url = buildWaterUrl("/api/water/ack");
-  if (!sendRequest("POST", url, nullptr, statusCode, body)) {
-    return false;
+void printWifiStats() {
+  Serial.printf(
+      "WiFi: %lu connects (%lu fast), %lu failed attempts\n",
+      (unsigned long)wifiStats.connects,
+      (unsigned long)wifiStats.fastConnects,
+      (unsigned long)wifiStats.failedAttempts);
+  Serial.printf(
+      "  time to connect: last %lu ms, avg %lu ms, worst %lu ms\n",
+      (unsigned long)wifiStats.lastConnectMs,
+      wifiStats.connects ? (unsigned long)(wifiStats.totalConnectMs / wifiStats.connects) : 0UL,
+      (unsigned long)wifiStats.worstConnectMs);
+}
+
+void configureSecureClient(WiFiClientSecure &client, const char *url) {
+  if (!isHttpsUrl(url)) {
+    return;
   }
 
-  if (statusCode != 200) {
-    Serial.println("Ack returned non-200");
-    return false;
+  if (!USE_INSECURE_TLS_FOR_DEV && strlen(ROOT_CA) > 0) {
+    client.setCACert(ROOT_CA);
+    return;
   }
 
-  Serial.println("Reminder acknowledged");
-  return true;
+  client.setInsecure();
 }
 
-bool postWaterIntake(int amountMl) {
-  StaticJsonDocument<256> requestDoc;
-  requestDoc["user_id"] = WATER_USER_ID;
-  requestDoc["amount_ml"] = amountMl;
-  requestDoc["source"] = "esp32";
+// One keep-alive connection to the API host, used only by the network task.
+// HTTPClient leaves the socket open after end() (setReuse) unless the server
+// answers HTTP/1.0 or "Connection: close", so a reminder poll normally skips
+// DNS, the TCP handshake and TLS. A dropped connection is reopened on the
+// next request from a cached address, and a request that fails on a reused
+// connection is retried once on a fresh one.
+//
+// arduino-esp32's WiFiClientSecure has no hook to save or restore an mbedTLS
+// session, so a reopened connection still pays a full TLS handshake; keeping
+// the connection open is what avoids it.
+constexpr unsigned long DNS_CACHE_MS = 10UL * 60UL * 1000UL;
+constexpr uint16_t HTTP_TIMEOUT_MS = 10000;
+
+// URLs are built in place (buildWaterUrl() and friends); this fits the
+// longest, /device-sync's with both versions, with room for a long host.
+constexpr size_t API_URL_BYTES = 192;
+using ApiUrl = FixedString<API_URL_BYTES>;
+
+// HTTPClient takes header names and values only as String. These are made
+// once, so adding a header costs no temporary.
+const String HEADER_ACCEPT("Accept");
+const String HEADER_CONTENT_TYPE("Content-Type");
+const String HEADER_IF_NONE_MATCH("If-None-Match");
+const String API_CONTENT_TYPE_VALUE(API_CONTENT_TYPE);
+const String EVENT_STREAM_TYPE("text/event-stream");
+
+struct ApiConnection {
+  ApiConnection() { url.reserve(API_URL_BYTES); }
+
+  WiFiClient plainClient;
+  WiFiClientSecure secureClient;
+  HTTPClient http;
+  char host[64] = "";
+  uint16_t port = 0;
+  bool secure = false;
+  IPAddress address;
+  bool addressValid = false;
+  unsigned long resolvedAt = 0;
+  // The request URL and If-None-Match value as HTTPClient wants them.
+  // Assigned per request, so their buffers are reused rather than
+  // reallocated.
+  String url;
+  String etag;
+};
+
+// Totals per stage of sendRequest(), printed by the "net" Serial command.
+struct HttpStageStats {
+  uint32_t requests;
+  uint32_t failures;
+  uint32_t retries;
+  uint32_t connects;
+  uint32_t reusedConnections;
+  uint32_t dnsLookups;
+  uint32_t dnsCacheHits;
+  uint32_t notModified;    // 304s: cached copy still current
+  uint32_t eventStreams;   // /events streams opened
+  uint32_t events;         // sync events received on them
+  uint32_t eventUploads;   // /device-events batches accepted
+  uint32_t eventsUploaded; // log records in them
+  uint64_t dnsMicros;
+  uint64_t connectMicros;  // TCP connect plus TLS handshake
+  uint64_t responseMicros; // request out through response headers
+  uint64_t bodyMicros;     // body read and JSON parse
+};
+
+ApiConnection apiConnection;
+HttpStageStats httpStats = {};
+
+// The same stages one request at a time, for percentiles rather than
+// averages. A secure connect is timed as Tls alone: WiFiClientSecure does
+// the TCP connect and the handshake in one call. Transfer is the time
+// spent waiting for body bytes and Parse the rest of reading the body.
+enum class HttpStage : uint8_t {
+  Dns,
+  Connect,
+  Tls,
+  FirstByte,
+  Transfer,
+  Parse,
+  Request,
+  Count,
+};
+
+constexpr size_t HTTP_STAGES = static_cast<size_t>(HttpStage::Count);
+const char *const HTTP_STAGE_NAMES[HTTP_STAGES] = {"dns", "connect", "tls", "ttfb", "transfer", "parse", "request"};
+LatencyHistogram httpStageTimes[HTTP_STAGES];
+// Weakest WiFi signal a request went out on since the last telemetry
+// upload, 0 for none.
+int8_t lowestRssi = 0;
+
+void recordStage(HttpStage stage, unsigned long micros) {
+  httpStageTimes[static_cast<size_t>(stage)].recordMicros(micros);
+}
 
-  char body[128];
-  size_t bodyLen = serializeJson(requestDoc, body, sizeof(body));
-  if (bodyLen == 0 || bodyLen >= sizeof(body)) {
-    Serial.println("Intake body serialization failed");
-    return false;
+WiFiClient &apiClient(ApiConnection &connection) {
+  if (connection.secure) {
+    return connection.secureClient;
   }
+  return connection.plainClient;
+}
 
-  StaticJsonDocument<768> responseDoc;
-  int statusCode = 0;
-  String url = buildWaterUrl("/api/water/intake");
+void closeApiConnection(ApiConnection &connection) {
+  connection.plainClient.stop();
+  connection.secureClient.stop();
+}
 
-  if (!sendRequest("POST", url, &responseDoc, statusCode, body)) {
+// Points the connection at the URL's host, dropping any connection and
+// cached address for a different one.
+bool selectApiHost(ApiConnection &connection, const char *url) {
+  const char *host = strstr(url, "://");
+  if (host == nullptr) {
     return false;
   }
-
-  if (statusCode != 201) {
-    Serial.println("Intake log returned unexpected status");
+  host += 3;
+  const size_t authorityLength = strcspn(host, "/");
+  const char *colon = static_cast<const char *>(memchr(host, ':', authorityLength));
+  const size_t hostLength = colon == nullptr ? authorityLength : colon - host;
+  if (hostLength >= sizeof(connection.host)) {
     return false;
   }
 
-  JsonObject today = responseDoc["summary"]["today"];
-  totalIntakeLiters = today["total_intake_liters"] | totalIntakeLiters;
-  dailyGoalLiters = today["goal_liters"] | dailyGoalLiters;
-  waterPercent = clampPercent(today["progress_percent"] | waterPercent);
+  const bool secure = isHttpsUrl(url);
+  uint16_t port = colon == nullptr ? (secure ? 443 : 80) : strtoul(colon + 1, nullptr, 10);
 
-  Serial.printf("Logged intake: %d mL, total now %.2f L\n", amountMl, totalIntakeLiters);
-  renderForestUi();
+  if (strncmp(host, connection.host, hostLength) == 0 && connection.host[hostLength] == '\0' &&
+      port == connection.port && secure == connection.secure) {
+    return true;
+  }
+
+  closeApiConnection(connection);
+  memcpy(connection.host, host, hostLength);
+  connection.host[hostLength] = '\0';
+  connection.port = port;
+  connection.secure = secure;
+  connection.addressValid = false;
+  if (secure) {
+    configureSecureClient(connection.secureClient, url);
+  }
   return true;
 }
 
-bool pollWaterReminder() {
-  StaticJsonDocument<1024> doc;
-  int statusCode = 0;
-  String url = buildWaterUrl("/api/water/poll?user_id=" + String(WATER_USER_ID));
+bool resolveApiHost(ApiConnection &connection) {
+  if (connection.addressValid && millis() - connection.resolvedAt < DNS_CACHE_MS) {
+    ++httpStats.dnsCacheHits;
+    return true;
+  }
 
-  if (!sendRequest("GET", url, &doc, statusCode)) {
+  unsigned long startedAt = micros();
+  connection.addressValid = WiFi.hostByName(connection.host, connection.address) == 1;
+  const unsigned long elapsed = micros() - startedAt;
+  httpStats.dnsMicros += elapsed;
+  recordStage(HttpStage::Dns, elapsed);
+  ++httpStats.dnsLookups;
+  if (!connection.addressValid) {
+    Serial.printf("DNS lookup for %s failed\n", connection.host);
     return false;
   }
+  connection.resolvedAt = millis();
+  return true;
+}
 
-  if (statusCode != 200) {
-    Serial.println("Reminder poll returned non-200");
-    return false;
+// Opens the connection unless it is still up. reused says which it was.
+bool openApiConnection(ApiConnection &connection, bool &reused) {
+  reused = apiClient(connection).connected();
+  if (reused) {
+    ++httpStats.reusedConnections;
+    return true;
   }
 
-  serverTimeUtc = String(doc["server_time_utc"] | "");
-  bool remindNow = doc["remind_now"] | false;
-  const char *reason = doc["reason"] | "unknown";
+  if (!resolveApiHost(connection)) {
+    return false;
+  }
 
-  Serial.printf("Reminder poll: remind_now=%s reason=%s\n", remindNow ? "true" : "false", reason);
+  unsigned long startedAt = micros();
+  bool connected;
+  if (connection.secure) {
+    const char *rootCa = !USE_INSECURE_TLS_FOR_DEV && strlen(ROOT_CA) > 0 ? ROOT_CA : nullptr;
+    connected = connection.secureClient.connect(
+        connection.address, connection.port, connection.host, rootCa, nullptr, nullptr);
+  } else {
+    connected = connection.plainClient.connect(connection.address, connection.port);
+  }
+  const unsigned long elapsed = micros() - startedAt;
+  httpStats.connectMicros += elapsed;
+  recordStage(connection.secure ? HttpStage::Tls : HttpStage::Connect, elapsed);
+  ++httpStats.connects;
+
+  if (!connected) {
+    // The host may have moved; look it up again next time.
+    connection.addressValid = false;
+    Serial.printf("Connect to %s:%u failed\n", connection.host, connection.port);
+  }
+  return connected;
+}
 
-  if (!remindNow) {
-    if (waterReminderActive) {
-      waterReminderActive = false;
-      setReminderTone(false);
-      renderForestUi();
-    }
+// Worth sending again on a fresh connection: the reused one was dead, and
+// either the request is a GET or it never reached the server.
+bool isRetryableFailure(const char *method, int statusCode) {
+  if (strcmp(method, "GET") == 0) {
     return true;
   }
+  return statusCode == HTTPC_ERROR_CONNECTION_REFUSED || statusCode == HTTPC_ERROR_SEND_HEADER_FAILED ||
+         statusCode == HTTPC_ERROR_SEND_PAYLOAD_FAILED;
+}
 
-  JsonObject payload = doc["payload"];
-  reminderTitle = String(payload["title"] | "Drink water");
-  reminderMessage = String(payload["message"] | "Time to hydrate!");
-  reminderAnimation = String(payload["animation"] | "");
+// Room for a quoted ETag such as "1a2b3c4d".
+constexpr size_t ETAG_BYTES = 24;
 
-  waterReminderActive = true;
-  setReminderTone(true);
-  renderForestUi();
+int issueApiRequest(const char *method, const char *url, const char *body, size_t bodyLen, const char *etag) {
+  HTTPClient &http = apiConnection.http;
+  apiConnection.url = url;
+  if (!http.begin(apiClient(apiConnection), apiConnection.url)) {
+    Serial.println("HTTPClient begin failed");
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+  }
 
-  Serial.printf("Reminder animation: %s\n", reminderAnimation.c_str());
+  static const char *headerKeys[] = {"ETag", "Content-Type"};
+  http.collectHeaders(headerKeys, 2);
+  http.setReuse(true);
+  http.setTimeout(HTTP_TIMEOUT_MS);
+  http.addHeader(HEADER_ACCEPT, API_CONTENT_TYPE_VALUE);
+  if (body != nullptr) {
+    http.addHeader(HEADER_CONTENT_TYPE, API_CONTENT_TYPE_VALUE);
+  }
+  if (etag != nullptr && etag[0] != '\0') {
+    apiConnection.etag = etag;
+    http.addHeader(HEADER_IF_NONE_MATCH, apiConnection.etag);
+  }
 
-  acknowledgeWaterReminder();
-  return true;
+  if (strcmp(method, "GET") == 0) {
+    return http.GET();
+  }
+  return http.POST(
+      reinterpret_cast<uint8_t *>(const_cast<char *>(body)),
+      bodyLen
+  );
 }
 
-void initializeScreenAndAudio() {
-    SPI.begin(TFT_SDK, 19, TFT_SDA, TFT_A0);
-
-    tft.initR(INITR_GREENTAB);
-    tft.setRotation(0);
-    tft.fillScreen(ST77XX_BLACK); 
-    delay(300);
-    drawStatus("Booting ESP32", "Preparing network");
-
-    ledcAttach(AUDIO_PIN, 2000, 8);
-    setReminderTone(false);
+// Request body in API_CONTENT_TYPE. Returns its length, or 0 when it did
+// not fit; MessagePack is binary, so the length is not strlen(out).
+size_t serializeApiBody(const JsonDocument &doc, char *out, size_t size) {
+  const size_t length = API_USE_MSGPACK ? serializeMsgPack(doc, out, size) : serializeJson(doc, out, size);
+  return length < size ? length : 0;
 }
 
- // namespace
+// Parses MessagePack or JSON with the fields in filter kept and everything
+// else skipped as it is read. No filter keeps the whole document.
+template <typename... Input>
+DeserializationError parseFiltered(JsonDocument &doc, const JsonDocument *filter, bool msgPack, Input &&...input) {
+  if (msgPack) {
+    if (filter != nullptr) {
+      return deserializeMsgPack(doc, input..., DeserializationOption::Filter(*filter));
+    }
+    return deserializeMsgPack(doc, input...);
+  }
+  if (filter != nullptr) {
+    return deserializeJson(doc, input..., DeserializationOption::Filter(*filter));
+  }
+  return deserializeJson(doc, input...);
+}
 
-void setup() {
-  Serial.begin(115200);
-  delay(250);
+// What the parser reads the body through: reads go on to the socket, and
+// the ones that have to wait for bytes to arrive are timed, so the wait
+// can be told apart from the parsing.
+class TimedBodyReader {
+public:
+  explicit TimedBodyReader(Stream &stream) : stream_(stream) {}
 
-  initializeScreenAndAudio();
-//   ensureWifiConnected();
+  int read() {
+    char c;
+    return readBytes(&c, 1) == 1 ? static_cast<uint8_t>(c) : -1;
+  }
 
-//   fetchWaterSchedule();
-//   fetchWaterSummary();
-//   pollWaterReminder();
+  size_t readBytes(char *buffer, size_t length) {
+    if (stream_.available() >= static_cast<int>(length)) {
+      return stream_.readBytes(buffer, length);
+    }
+    const unsigned long startedAt = micros();
+    const size_t count = stream_.readBytes(buffer, length);
+    waitMicros_ += micros() - startedAt;
+    return count;
+  }
 
-  lastReminderPollAt = millis();
-  lastSummaryRefreshAt = millis();
-  lastScheduleRefreshAt = millis();
+  unsigned long waitMicros() const { return waitMicros_; }
+
+private:
+  Stream &stream_;
+  unsigned long waitMicros_ = 0;
+};
+
+// Parses the response straight off the socket, so the body never sits in a
+// String next to the document. A body without a Content-Length (chunked)
+// still goes through getString(), the only HTTPClient call that undoes the
+// chunk framing. The format follows the response's Content-Type, so a
+// JSON error page still parses when MessagePack was asked for.
+// transferMicros gets the part of the time spent waiting for the body.
+bool readResponseBody(JsonDocument &doc, const JsonDocument *filter, unsigned long &transferMicros) {
+  HTTPClient &http = apiConnection.http;
+  const int size = http.getSize();
+  if (size == 0) {
+    return true;
+  }
+
+  static const char MSGPACK_TYPE[] = "application/msgpack";
+  const String contentType = http.header("Content-Type");
+  const bool msgPack = strncmp(contentType.c_str(), MSGPACK_TYPE, sizeof(MSGPACK_TYPE) - 1) == 0;
+  DeserializationError error;
+  if (size > 0) {
+    TimedBodyReader reader(http.getStream());
+    error = parseFiltered(doc, filter, msgPack, reader);
+    transferMicros = reader.waitMicros();
+  } else {
+    const unsigned long startedAt = micros();
+    String payload = http.getString();
+    transferMicros = micros() - startedAt;
+    if (payload.isEmpty()) {
+      return true;
+    }
+    error = parseFiltered(doc, filter, msgPack, payload.c_str(), payload.length());
+  }
+
+  if (error) {
+    Serial.print(msgPack ? "MessagePack parse failed: " : "JSON parse failed: ");
+    Serial.println(error.c_str());
+    return false;
+  }
+  return true;
+}
+
+// responseFilter, when given, names the response fields the caller reads;
+// the rest never reaches responseDoc.
+//
+// etag, when given, is an ETAG_BYTES buffer holding the ETag of the copy
+// the caller already has (empty for none). It goes out as If-None-Match,
+// and a 200 replaces it with the new one once the body has parsed: an ETag
+// for content the caller never got would turn every later refresh into a
+// 304 for data it does not have. A 304 comes back with
+// statusCode 304 and responseDoc left empty: nothing to parse or redraw.
+//
+// Network task only. Fails at once while the WiFi link is down.
+bool sendRequest(
+    const char *method,
+    const ApiUrl &url,
+    JsonDocument *responseDoc,
+    const JsonDocument *responseFilter,
+    int &statusCode,
+    const char *body = nullptr,
+    size_t bodyLen = 0,
+    char *etag = nullptr) {
+    if (WiFi.status() != WL_CONNECTED) {
+        return false;
+    }
+    const int8_t rssi = WiFi.RSSI();
+    if (rssi < lowestRssi || lowestRssi == 0) {
+        lowestRssi = rssi;
+    }
+
+    if (strcmp(method, "GET") != 0 && strcmp(method, "POST") != 0) {
+        Serial.println("Unsupported HTTP method");
+        return false;
+    }
+    if (url.overflowed()) {
+        Serial.println("API URL too long");
+        return false;
+    }
+    if (!selectApiHost(apiConnection, url.c_str())) {
+        Serial.println("Bad API URL");
+        return false;
+    }
+
+    ++httpStats.requests;
+    const unsigned long requestStartedAt = micros();
+    statusCode = HTTPC_ERROR_CONNECTION_REFUSED;
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        bool reused = false;
+        if (!openApiConnection(apiConnection, reused)) {
+            break;
+        }
+
+        unsigned long startedAt = micros();
+        statusCode = issueApiRequest(method, url.c_str(), body, bodyLen, etag);
+        const unsigned long elapsed = micros() - startedAt;
+        httpStats.responseMicros += elapsed;
+        if (statusCode > 0) {
+            recordStage(HttpStage::FirstByte, elapsed);
+            break;
+        }
+
+        apiConnection.http.end();
+        closeApiConnection(apiConnection);
+        if (!reused || !isRetryableFailure(method, statusCode)) {
+            break;
+        }
+        ++httpStats.retries;
+        Serial.println("Kept-alive connection was dropped, retrying");
+    }
+
+    // In pieces: Print::printf() goes to the heap for lines past 64 bytes.
+    Serial.print(method);
+    Serial.print(' ');
+    Serial.print(url.c_str());
+    Serial.printf(" -> %d\n", statusCode);
+    if (statusCode <= 0) {
+        ++httpStats.failures;
+        Serial.println("HTTP request failed before response");
+        return false;
+    }
+
+    if (statusCode == 304) {
+        ++httpStats.notModified;
+        apiConnection.http.end();
+        recordStage(HttpStage::Request, micros() - requestStartedAt);
+        return true;
+    }
+    // Read before end(), which drops the response headers.
+    char newEtag[ETAG_BYTES] = "";
+    if (etag != nullptr && statusCode == 200) {
+        copyText(newEtag, sizeof(newEtag), apiConnection.http.header("ETag").c_str());
+    }
+
+    unsigned long bodyStartedAt = micros();
+    bool parsed = true;
+    unsigned long parseMicros = 0;
+    if (responseDoc != nullptr) {
+        unsigned long transferMicros = 0;
+        parsed = readResponseBody(*responseDoc, responseFilter, transferMicros);
+        parseMicros = micros() - bodyStartedAt - transferMicros;
+        recordStage(HttpStage::Parse, parseMicros);
+    }
+    // Discards any unread body and leaves the connection open for the next
+    // request when the server allows.
+    apiConnection.http.end();
+    const unsigned long finishedAt = micros();
+    httpStats.bodyMicros += finishedAt - bodyStartedAt;
+    recordStage(HttpStage::Transfer, finishedAt - bodyStartedAt - parseMicros);
+    recordStage(HttpStage::Request, finishedAt - requestStartedAt);
+    if (parsed && etag != nullptr && statusCode == 200) {
+        copyText(etag, ETAG_BYTES, newEtag);
+    }
+    return parsed;
+}
+
+unsigned long averageMillis(uint64_t totalMicros, uint32_t count) {
+  return count ? static_cast<unsigned long>(totalMicros / count / 1000) : 0;
+}
+
+void printHttpStats() {
+  Serial.printf(
+      "HTTP: %lu requests, %lu failed, %lu retried, %lu not modified\n",
+      (unsigned long)httpStats.requests,
+      (unsigned long)httpStats.failures,
+      (unsigned long)httpStats.retries,
+      (unsigned long)httpStats.notModified);
+  Serial.printf(
+      "  connections: %lu opened (avg %lu ms), %lu reused\n",
+      (unsigned long)httpStats.connects,
+      averageMillis(httpStats.connectMicros, httpStats.connects),
+      (unsigned long)httpStats.reusedConnections);
+  Serial.printf(
+      "  dns: %lu lookups (avg %lu ms), %lu cached\n",
+      (unsigned long)httpStats.dnsLookups,
+      averageMillis(httpStats.dnsMicros, httpStats.dnsLookups),
+      (unsigned long)httpStats.dnsCacheHits);
+  Serial.printf(
+      "  response avg %lu ms, body avg %lu ms\n",
+      averageMillis(httpStats.responseMicros, httpStats.requests),
+      averageMillis(httpStats.bodyMicros, httpStats.requests));
+  Serial.printf(
+      "  events: %lu streams opened, %lu pushed syncs\n",
+      (unsigned long)httpStats.eventStreams,
+      (unsigned long)httpStats.events);
+}
+
+ApiUrl buildWaterUrl(const char *path) {
+  ApiUrl url(API_BASE_URL);
+  url.append(path);
+  return url;
+}
+
+// "/api/water/<path>?user_id=..."
+ApiUrl buildUserUrl(const char *path) {
+  ApiUrl url = buildWaterUrl(path);
+  url.append("?user_id=").append(WATER_USER_ID);
+  return url;
+}
+
+// The schedule, status and reminder objects have the same shape in their
+// own endpoints and inside /device-sync. Schedule and status go into
+// netState, to be published with the job's result.
+void readSchedule(JsonObjectConst schedule) {
+  ScheduleState &state = netState.schedule;
+  state.enabled = schedule["enabled"] | true;
+  state.intervalMinutes = schedule["interval_min"] | 0;
+  state.utcOffsetMinutes = schedule["utc_offset_min"] | 0;
+  state.dailyGoalLiters = schedule["daily_goal_liters"] | NAN;
+  copyText(state.startTime, sizeof(state.startTime), schedule["start_time"] | "");
+  copyText(state.endTime, sizeof(state.endTime), schedule["end_time"] | "");
+  ++netState.scheduleVersion;
+  netStateChanged = true;
+}
+
+void readStatus(JsonObjectConst status) {
+  StatusState &state = netState.status;
+  state.waterPercent = clampPercent(status["water_percent"] | 0);
+  state.stressPercent = clampPercent(status["stress_percent"] | 0);
+
+  JsonObjectConst water = status["water"];
+  state.totalIntakeLiters = water["total_intake_liters"] | 0.0f;
+  state.dailyGoalLiters = water["goal_liters"] | NAN;
+  copyText(state.nextReminderAt, sizeof(state.nextReminderAt), water["next_reminder_at"] | "");
+  state.nextReminderMs = 0;
+  parseUtcMillis(state.nextReminderAt, state.nextReminderMs);
+  ++netState.statusVersion;
+  netStateChanged = true;
+}
+
+// A clock reading for the reminder scheduler until SNTP answers.
+void readServerTime(const char *serverTimeUtc, NetResult &result) {
+  if (parseUtcMillis(serverTimeUtc, result.serverTimeMs)) {
+    result.receivedAt = millis();
+  }
+}
+
+void readReminder(JsonObjectConst reminder, NetResult &result) {
+  result.hasReminder = true;
+  result.remindNow = reminder["remind_now"] | false;
+  copyText(result.reason, sizeof(result.reason), reminder["reason"] | "unknown");
+
+  JsonObjectConst payload = reminder["payload"];
+  copyText(result.reminderTitle, sizeof(result.reminderTitle), payload["title"] | "Drink water");
+  copyText(result.reminderMessage, sizeof(result.reminderMessage), payload["message"] | "Time to hydrate!");
+  copyText(result.reminderAnimation, sizeof(result.reminderAnimation), payload["animation"] | "");
+}
+
+// Filters matching the readers above: each keeps only the fields its reader
+// looks at, so responses are parsed into small documents however much else
+// the backend sends (weekly history, timezone, user id, ...).
+void filterSchedule(JsonObject filter) {
+  filter["enabled"] = true;
+  filter["interval_min"] = true;
+  filter["utc_offset_min"] = true;
+  filter["daily_goal_liters"] = true;
+  filter["start_time"] = true;
+  filter["end_time"] = true;
+}
+
+void filterStatus(JsonObject filter) {
+  filter["water_percent"] = true;
+  filter["stress_percent"] = true;
+  JsonObject water = filter["water"].to<JsonObject>();
+  water["total_intake_liters"] = true;
+  water["goal_liters"] = true;
+  water["next_reminder_at"] = true;
+}
+
+void filterReminder(JsonObject filter) {
+  filter["remind_now"] = true;
+  filter["reason"] = true;
+  filter["payload"] = true;
+}
+
+// ETags of the last schedule and device-status responses. Network task only.
+char scheduleEtag[ETAG_BYTES] = "";
+char statusEtag[ETAG_BYTES] = "";
+
+// Every document a network job builds or parses lives here, from a Scope
+// opened before the first of them until the job's function returns, so
+// requests never take JSON memory from the heap. ArduinoJson's slots and
+// pools grow with the pointer size; a filter is shrunk to fit before its
+// document is parsed. Network task only.
+constexpr size_t JSON_ARENA_BYTES = 1024 * sizeof(void *);
+using NetJsonArena = JsonArena<JSON_ARENA_BYTES>;
+NetJsonArena jsonArena;
+
+bool loadWaterSchedule() {
+  NetJsonArena::Scope scope(jsonArena);
+  JsonDocument filter(&jsonArena);
+  filterSchedule(filter.to<JsonObject>());
+  filter.shrinkToFit();
+
+  JsonDocument doc(&jsonArena);
+  int statusCode = 0;
+  ApiUrl url = buildUserUrl("/api/water/schedule");
+
+  if (!sendRequest("GET", url, &doc, &filter, statusCode, nullptr, 0, scheduleEtag)) {
+    return false;
+  }
+
+  if (statusCode == 304) {
+    return true;
+  }
+  if (statusCode != 200) {
+    Serial.println("Schedule fetch returned non-200");
+    return false;
+  }
+
+  readSchedule(doc.as<JsonObjectConst>());
+  return true;
+}
+
+bool loadWaterSummary(NetResult &result) {
+  NetJsonArena::Scope scope(jsonArena);
+  JsonDocument filter(&jsonArena);
+  filterStatus(filter.to<JsonObject>());
+  filter["server_time_utc"] = true;
+  filter.shrinkToFit();
+
+  JsonDocument doc(&jsonArena);
+  int statusCode = 0;
+  ApiUrl url = buildUserUrl("/api/water/device-status");
+
+  if (!sendRequest("GET", url, &doc, &filter, statusCode, nullptr, 0, statusEtag)) {
+    return false;
+  }
+
+  if (statusCode == 304) {
+    return true;
+  }
+  if (statusCode != 200) {
+    Serial.println("Summary fetch returned non-200");
+    return false;
+  }
+
+  readServerTime(doc["server_time_utc"] | "", result);
+  readStatus(doc.as<JsonObjectConst>());
+  return true;
+}
+
+bool acknowledgeWaterReminder() {
+  NetJsonArena::Scope scope(jsonArena);
+  JsonDocument requestDoc(&jsonArena);
+  requestDoc["user_id"] = WATER_USER_ID;
+
+  char body[96];
+  size_t bodyLen = serializeApiBody(requestDoc, body, sizeof(body));
+  if (bodyLen == 0) {
+    Serial.println("Ack body serialization failed");
+    return false;
+  }
+
+  int statusCode = 0;
+  ApiUrl url = buildWaterUrl("/api/water/ack");
+  if (!sendRequest("POST", url, nullptr, nullptr, statusCode, body, bodyLen)) {
+    return false;
+  }
+
+  if (statusCode != 200) {
+    Serial.println("Ack returned non-200");
+    return false;
+  }
+
+  Serial.println("Reminder acknowledged");
+  return true;
+}
+
+bool loadReminderPoll(NetResult &result) {
+  NetJsonArena::Scope scope(jsonArena);
+  JsonDocument filter(&jsonArena);
+  filterReminder(filter.to<JsonObject>());
+  filter["server_time_utc"] = true;
+  filter.shrinkToFit();
+
+  JsonDocument doc(&jsonArena);
+  int statusCode = 0;
+  ApiUrl url = buildUserUrl("/api/water/poll");
+
+  if (!sendRequest("GET", url, &doc, &filter, statusCode)) {
+    return false;
+  }
+
+  if (statusCode != 200) {
+    Serial.println("Reminder poll returned non-200");
+    return false;
+  }
+
+  readServerTime(doc["server_time_utc"] | "", result);
+  readReminder(doc.as<JsonObjectConst>(), result);
+  return true;
+}
+
+// Section versions from the last /device-sync, echoed back so the server
+// can leave out what has not changed. local_reminders=1: the reminder
+// scheduler below decides when to remind, so the server leaves that out
+// and marks nothing triggered. Network task only.
+uint32_t syncedStatusVersion = 0;
+uint32_t syncedScheduleVersion = 0;
+
+// "/api/water/<path>?user_id=...&status_v=...&schedule_v=...&local_reminders=1"
+ApiUrl buildSyncUrl(const char *path) {
+  ApiUrl url = buildUserUrl(path);
+  url.appendf(
+      "&status_v=%lu&schedule_v=%lu&local_reminders=1",
+      (unsigned long)syncedStatusVersion,
+      (unsigned long)syncedScheduleVersion);
+  return url;
+}
+
+void filterDeviceSync(JsonDocument &filter) {
+  filter["server_time_utc"] = true;
+  filterReminder(filter["reminder"].to<JsonObject>());
+
+  JsonObject status = filter["status"].to<JsonObject>();
+  filterStatus(status);
+  status["v"] = true;
+
+  JsonObject schedule = filter["schedule"].to<JsonObject>();
+  filterSchedule(schedule);
+  schedule["v"] = true;
+}
+
+// A /device-sync body, polled or pushed as an /events "sync" event.
+void readDeviceSync(JsonDocument &doc, NetResult &result) {
+  readServerTime(doc["server_time_utc"] | "", result);
+  JsonObjectConst reminder = doc["reminder"];
+  if (!reminder.isNull()) {
+    readReminder(reminder, result);
+  }
+
+  JsonObjectConst status = doc["status"];
+  if (!status.isNull()) {
+    readStatus(status);
+    syncedStatusVersion = status["v"] | 0u;
+  }
+
+  JsonObjectConst schedule = doc["schedule"];
+  if (!schedule.isNull()) {
+    readSchedule(schedule);
+    syncedScheduleVersion = schedule["v"] | 0u;
+  }
+}
+
+bool loadDeviceSync(NetResult &result) {
+  NetJsonArena::Scope scope(jsonArena);
+  JsonDocument filter(&jsonArena);
+  filterDeviceSync(filter);
+  filter.shrinkToFit();
+
+  JsonDocument doc(&jsonArena);
+  int statusCode = 0;
+  ApiUrl url = buildSyncUrl("/api/water/device-sync");
+
+  if (!sendRequest("GET", url, &doc, &filter, statusCode)) {
+    return false;
+  }
+
+  if (statusCode != 200) {
+    Serial.println("Device sync returned non-200");
+    return false;
+  }
+
+  readDeviceSync(doc, result);
+  return true;
+}
+
+// Intake and shown reminders on their way from the loop task to
+// /device-events. The loop task only pushes them into deviceEvents, so
+// logging a drink never waits on flash or the network. The network task
+// appends them to eventLog, which lives in NVS, and uploads what the log
+// holds in batches of up to UPLOAD_BATCH_MAX: intake on its next pass, so
+// the web app sees it at once, while reminders alone wait up to
+// REMINDER_BATCH_MS for company. Records leave the log only once the
+// server has answered, and the server skips any it has already stored, so
+// outages and resets neither lose nor double-count them. A failed upload
+// backs off up to UPLOAD_RETRY_MAX_MS; however long the outage, each
+// retry carries a full batch. An event is in RAM only until the network
+// task's next pass (at worst one request timeout).
+enum class DeviceEventType : uint8_t {
+  Intake = 1,
+  Reminder = 2,
+};
+
+struct DeviceEvent {
+  DeviceEventType type;
+  int16_t amountMl;
+  int64_t atMs; // wall clock epoch ms, 0 when it was not set yet
+};
+
+constexpr size_t EVENT_LOG_CAPACITY = 64;
+constexpr size_t UPLOAD_BATCH_MAX = 12;
+constexpr unsigned long REMINDER_BATCH_MS = 60UL * 1000UL;
+constexpr unsigned long UPLOAD_RETRY_MIN_MS = 5000;
+constexpr unsigned long UPLOAD_RETRY_MAX_MS = 5UL * 60UL * 1000UL;
+
+SpscQueue<DeviceEvent, 16> deviceEvents;
+// Network task only from here down.
+DurableLog<DeviceEvent, EVENT_LOG_CAPACITY> eventLog;
+
+struct EventUploader {
+  bool scheduled = false;
+  unsigned long dueAt = 0;
+  unsigned long retryDelayMs = UPLOAD_RETRY_MIN_MS;
+};
+
+EventUploader eventUploader;
+
+// Brings the next upload forward to at most delayMs from now.
+void scheduleUpload(unsigned long delayMs) {
+  const unsigned long at = millis() + delayMs;
+  if (!eventUploader.scheduled || (long)(at - eventUploader.dueAt) < 0) {
+    eventUploader.dueAt = at;
+    eventUploader.scheduled = true;
+  }
+}
+
+void takeDeviceEvents() {
+  DeviceEvent event;
+  while (deviceEvents.pop(event)) {
+    eventLog.append(event);
+    scheduleUpload(event.type == DeviceEventType::Intake ? 0 : REMINDER_BATCH_MS);
+  }
+}
+
+// Sends the oldest batch; the log keeps it unless the server took it.
+bool uploadEventBatch() {
+  const size_t count = min(eventLog.size(), UPLOAD_BATCH_MAX);
+
+  NetJsonArena::Scope scope(jsonArena);
+  JsonDocument requestDoc(&jsonArena);
+  requestDoc["user_id"] = WATER_USER_ID;
+  requestDoc["log_id"] = eventLog.logId();
+  JsonArray events = requestDoc["events"].to<JsonArray>();
+  for (size_t i = 0; i < count; ++i) {
+    const auto &entry = eventLog.at(i);
+    JsonObject event = events.add<JsonObject>();
+    event["seq"] = entry.seq;
+    if (entry.record.type == DeviceEventType::Intake) {
+      event["type"] = "intake";
+      event["amount_ml"] = entry.record.amountMl;
+    } else {
+      event["type"] = "reminder";
+    }
+    event["at_ms"] = entry.record.atMs;
+  }
+
+  char body[1024];
+  size_t bodyLen = serializeApiBody(requestDoc, body, sizeof(body));
+  if (bodyLen == 0) {
+    Serial.println("Event batch serialization failed");
+    return false;
+  }
+
+  int statusCode = 0;
+  ApiUrl url = buildWaterUrl("/api/water/device-events");
+  if (!sendRequest("POST", url, nullptr, nullptr, statusCode, body, bodyLen)) {
+    return false;
+  }
+
+  if (statusCode != 200) {
+    Serial.println("Event upload returned non-200");
+    return false;
+  }
+
+  eventLog.trimThrough(eventLog.at(count - 1).seq);
+  ++httpStats.eventUploads;
+  httpStats.eventsUploaded += count;
+  Serial.printf("Uploaded %u events, %u left\n", (unsigned)count, (unsigned)eventLog.size());
+  return true;
+}
+
+void serviceEventLog() {
+  takeDeviceEvents();
+  if (eventLog.empty()) {
+    eventUploader.scheduled = false;
+    return;
+  }
+  if (!eventUploader.scheduled || (long)(millis() - eventUploader.dueAt) < 0) {
+    return;
+  }
+
+  if (uploadEventBatch()) {
+    eventUploader.retryDelayMs = UPLOAD_RETRY_MIN_MS;
+    eventUploader.scheduled = false;
+    if (!eventLog.empty()) {
+      scheduleUpload(0);
+    }
+  } else {
+    eventUploader.dueAt = millis() + eventUploader.retryDelayMs;
+    eventUploader.retryDelayMs = min(eventUploader.retryDelayMs * 2, UPLOAD_RETRY_MAX_MS);
+  }
+}
+
+// The FlushEvents job: everything in the log, now. False at the first
+// batch that fails; serviceEventLog() retries the rest.
+bool flushEventLog() {
+  takeDeviceEvents();
+  while (!eventLog.empty()) {
+    if (!uploadEventBatch()) {
+      return false;
+    }
+  }
+  eventUploader.scheduled = false;
+  eventUploader.retryDelayMs = UPLOAD_RETRY_MIN_MS;
+  return true;
+}
+
+// Device health for the fleet: every TELEMETRY_INTERVAL_MS the network
+// task posts the request stage, redraw and loop lateness samples taken
+// since the last upload the server accepted, with the heap and the WiFi
+// signal, to /api/water/device-telemetry. The server adds the histograms
+// up across devices for percentiles. Each upload carries a per-boot
+// upload_id and a seq; one that fails is sent again unchanged at the next
+// interval, so if only its response was lost the server drops the copy
+// instead of counting its samples twice. sent only moves past samples the
+// server acknowledged.
+constexpr unsigned long TELEMETRY_FIRST_MS = 5UL * 60UL * 1000UL;
+constexpr unsigned long TELEMETRY_INTERVAL_MS = 15UL * 60UL * 1000UL;
+
+struct TelemetrySnapshot {
+  LatencyHistogram stages[HTTP_STAGES];
+  LoopHealth loop;
+};
+
+struct TelemetryUploader {
+  unsigned long dueAt = TELEMETRY_FIRST_MS;
+  uint32_t uploadId = 0;
+  uint32_t seq = 0;
+  bool pending = false;     // upload seq has not been acknowledged yet
+  TelemetrySnapshot upTo;   // what upload seq covers
+  TelemetrySnapshot sent;   // what the server has acknowledged
+  uint32_t uploads = 0;
+  uint32_t failures = 0;
+};
+
+TelemetryUploader telemetry;
+
+TelemetrySnapshot takeTelemetrySnapshot() {
+  TelemetrySnapshot snapshot;
+  memcpy(snapshot.stages, httpStageTimes, sizeof(snapshot.stages));
+  publishedLoopHealth.read(snapshot.loop);
+  return snapshot;
+}
+
+// Leaves out histograms with nothing new and trailing empty buckets.
+void addHistogram(JsonObject stages, const char *name, const LatencyHistogram &added) {
+  const size_t used = added.usedBuckets();
+  if (used == 0) {
+    return;
+  }
+  JsonArray counts = stages[name].to<JsonArray>();
+  for (size_t bucket = 0; bucket < used; ++bucket) {
+    counts.add(added.count(bucket));
+  }
+}
+
+bool postTelemetry() {
+  const TelemetrySnapshot &current = telemetry.upTo;
+  const TelemetrySnapshot &sent = telemetry.sent;
+
+  NetJsonArena::Scope scope(jsonArena);
+  JsonDocument requestDoc(&jsonArena);
+  requestDoc["user_id"] = WATER_USER_ID;
+  requestDoc["upload_id"] = telemetry.uploadId;
+  requestDoc["seq"] = telemetry.seq;
+  requestDoc["uptime_ms"] = millis();
+  JsonArray bounds = requestDoc["bounds_ms"].to<JsonArray>();
+  for (uint32_t bound : LatencyHistogram::BOUNDS_MS) {
+    bounds.add(bound);
+  }
+  JsonObject stages = requestDoc["stages"].to<JsonObject>();
+  for (size_t stage = 0; stage < HTTP_STAGES; ++stage) {
+    addHistogram(stages, HTTP_STAGE_NAMES[stage], current.stages[stage].since(sent.stages[stage]));
+  }
+  addHistogram(stages, "redraw", current.loop.redraw.since(sent.loop.redraw));
+  addHistogram(stages, "loop_late", current.loop.lateness.since(sent.loop.lateness));
+  JsonObject heap = requestDoc["heap"].to<JsonObject>();
+  heap["free"] = ESP.getFreeHeap();
+  heap["min_free"] = ESP.getMinFreeHeap();
+  heap["largest_block"] = ESP.getMaxAllocHeap();
+  JsonObject wifi = requestDoc["wifi"].to<JsonObject>();
+  wifi["rssi"] = WiFi.RSSI();
+  wifi["min_rssi"] = lowestRssi;
+
+  char body[1024];
+  size_t bodyLen = serializeApiBody(requestDoc, body, sizeof(body));
+  if (bodyLen == 0) {
+    Serial.println("Telemetry serialization failed");
+    return false;
+  }
+
+  int statusCode = 0;
+  ApiUrl url = buildWaterUrl("/api/water/device-telemetry");
+  if (!sendRequest("POST", url, nullptr, nullptr, statusCode, body, bodyLen)) {
+    return false;
+  }
+  if (statusCode != 200) {
+    Serial.println("Telemetry upload returned non-200");
+    return false;
+  }
+  return true;
+}
+
+bool uploadTelemetry() {
+  if (telemetry.uploadId == 0) {
+    telemetry.uploadId = esp_random() | 1u;
+  }
+  if (!telemetry.pending) {
+    telemetry.upTo = takeTelemetrySnapshot();
+    ++telemetry.seq;
+    telemetry.pending = true;
+  }
+  if (!postTelemetry()) {
+    return false;
+  }
+
+  // The upload's own request is timed after upTo was taken; it goes out
+  // with the next one.
+  telemetry.sent = telemetry.upTo;
+  telemetry.pending = false;
+  lowestRssi = 0;
+  return true;
+}
+
+void serviceTelemetry() {
+  if ((long)(millis() - telemetry.dueAt) < 0) {
+    return;
+  }
+  telemetry.dueAt = millis() + TELEMETRY_INTERVAL_MS;
+  if (uploadTelemetry()) {
+    ++telemetry.uploads;
+  } else {
+    ++telemetry.failures;
+  }
+}
+
+void printStageTime(const char *name, const LatencyHistogram &times) {
+  const uint32_t samples = times.total();
+  if (samples == 0) {
+    return;
+  }
+  Serial.printf("  %-9s %6lu", name, (unsigned long)samples);
+  for (uint8_t percent : {50, 90, 99}) {
+    const uint32_t boundMs = times.percentileMs(percent);
+    if (boundMs == UINT32_MAX) {
+      Serial.print("    >10s");
+    } else {
+      Serial.printf(" %7lu", (unsigned long)boundMs);
+    }
+  }
+  Serial.println();
+}
+
+void printStageTimes() {
+  Serial.println("  times: samples, p50 p90 p99 under ms");
+  for (size_t stage = 0; stage < HTTP_STAGES; ++stage) {
+    printStageTime(HTTP_STAGE_NAMES[stage], httpStageTimes[stage]);
+  }
+  LoopHealth loop;
+  publishedLoopHealth.read(loop);
+  printStageTime("redraw", loop.redraw);
+  printStageTime("loop late", loop.lateness);
+  Serial.printf(
+      "  telemetry: %lu uploaded, %lu failed\n",
+      (unsigned long)telemetry.uploads,
+      (unsigned long)telemetry.failures);
+}
+
+void printHeapStats() {
+#if CONFIG_HEAP_USE_HOOKS
+  Serial.printf(
+      "  heap: %lu allocs in %lu jobs (worst %lu)\n",
+      (unsigned long)netHeapStats.allocations.load(),
+      (unsigned long)netHeapStats.jobs.load(),
+      (unsigned long)netHeapStats.worst.load());
+  Serial.printf(
+      "  loop: %lu allocs in %lu results (worst %lu)\n",
+      (unsigned long)loopHeapStats.allocations.load(),
+      (unsigned long)loopHeapStats.jobs.load(),
+      (unsigned long)loopHeapStats.worst.load());
+#else
+  Serial.println("  heap: no allocation hook (CONFIG_HEAP_USE_HOOKS)");
+#endif
+  Serial.printf(
+      "  heap: %lu free, %lu lowest, %lu largest block\n",
+      (unsigned long)ESP.getFreeHeap(),
+      (unsigned long)ESP.getMinFreeHeap(),
+      (unsigned long)ESP.getMaxAllocHeap());
+  Serial.printf(
+      "  json arena: %u of %u bytes at most, %lu full\n",
+      (unsigned)jsonArena.highWater(),
+      (unsigned)jsonArena.capacity(),
+      (unsigned long)jsonArena.failures());
+}
+
+void printEventLogStats() {
+  Serial.printf(
+      "  event log: %u pending%s, %lu dropped, %lu uploaded in %lu batches\n",
+      (unsigned)eventLog.size(),
+      eventLog.persistent() ? "" : " (RAM only)",
+      (unsigned long)eventLog.dropped(),
+      (unsigned long)httpStats.eventsUploaded,
+      (unsigned long)httpStats.eventUploads);
+}
+
+bool runNetJob(const NetRequest &request, NetResult &result) {
+  switch (request.job) {
+    case NetJob::FetchSchedule:
+      return loadWaterSchedule();
+    case NetJob::FetchSummary:
+      return loadWaterSummary(result);
+    case NetJob::PollReminder:
+      return loadReminderPoll(result);
+    case NetJob::SyncDevice:
+      return loadDeviceSync(result);
+    case NetJob::FlushEvents:
+      return flushEventLog();
+    case NetJob::ReportStats:
+      printWifiStats();
+      printHttpStats();
+      printStageTimes();
+      printEventLogStats();
+      printHeapStats();
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Server-Sent Events from /api/water/events, held open by the network task
+// on a connection of its own: an HTTP/1.1 response that never ends cannot
+// share apiConnection with the requests that still go out. The server
+// pushes a /device-sync body within about a second of a reminder falling
+// due or the status or schedule changing, so loop() stops polling while the
+// stream is up. Bytes are read between jobs, at most EVENT_READ_POLL_MS
+// after they arrive. A stream the server ends is reopened at once with the
+// latest versions; one that fails or goes quiet past the server's 20 s
+// ping backs off up to EVENT_RETRY_MAX_MS while polling covers the gap.
+constexpr unsigned long EVENT_READ_POLL_MS = 50;
+constexpr unsigned long EVENT_STALL_MS = 45UL * 1000UL;
+constexpr unsigned long EVENT_RETRY_MIN_MS = 1000;
+constexpr unsigned long EVENT_RETRY_MAX_MS = 5UL * 60UL * 1000UL;
+constexpr size_t EVENT_DATA_BYTES = 1024;
+
+struct EventStream {
+  ApiConnection connection;
+  SseReader<EVENT_DATA_BYTES> reader;
+  bool open = false;
+  unsigned long lastByteAt = 0;
+  unsigned long retryAt = 0;
+  unsigned long retryDelayMs = EVENT_RETRY_MIN_MS;
+};
+
+EventStream eventStream;
+
+void postEventStreamStatus(NetJob status) {
+  NetResult result = {};
+  result.job = status;
+  result.ok = true;
+  postNetResult(result);
+}
+
+bool openEventStream() {
+  if (WiFi.status() != WL_CONNECTED) {
+    return false;
+  }
+
+  ApiConnection &connection = eventStream.connection;
+  ApiUrl url = buildSyncUrl("/api/water/events");
+  if (url.overflowed() || !selectApiHost(connection, url.c_str())) {
+    Serial.println("Bad API URL");
+    return false;
+  }
+  bool reused = false;
+  if (!openApiConnection(connection, reused)) {
+    return false;
+  }
+
+  HTTPClient &http = connection.http;
+  connection.url = url.c_str();
+  if (!http.begin(apiClient(connection), connection.url)) {
+    Serial.println("HTTPClient begin failed");
+    closeApiConnection(connection);
+    return false;
+  }
+  static const char *headerKeys[] = {"Transfer-Encoding"};
+  http.collectHeaders(headerKeys, 1);
+  http.setReuse(false);
+  http.setTimeout(HTTP_TIMEOUT_MS);
+  http.addHeader(HEADER_ACCEPT, EVENT_STREAM_TYPE);
+
+  int statusCode = http.GET();
+  Serial.print("GET ");
+  Serial.print(url.c_str());
+  Serial.printf(" -> %d\n", statusCode);
+  if (statusCode != 200) {
+    http.end();
+    closeApiConnection(connection);
+    return false;
+  }
+
+  ++httpStats.eventStreams;
+  eventStream.reader.reset(http.header("Transfer-Encoding").equalsIgnoreCase("chunked"));
+  eventStream.lastByteAt = millis();
+  return true;
+}
+
+// cleanly: the server ended the stream, so reopen without backing off.
+void closeEventStream(bool cleanly) {
+  eventStream.connection.http.end();
+  closeApiConnection(eventStream.connection);
+  eventStream.open = false;
+  if (cleanly) {
+    eventStream.retryAt = millis();
+  } else {
+    eventStream.retryAt = millis() + eventStream.retryDelayMs;
+    eventStream.retryDelayMs = min(eventStream.retryDelayMs * 2, EVENT_RETRY_MAX_MS);
+  }
+  postEventStreamStatus(NetJob::EventsClosed);
+}
+
+void handleStreamEvent() {
+  const SseReader<EVENT_DATA_BYTES> &reader = eventStream.reader;
+  if (strcmp(reader.event(), "sync") != 0) {
+    return;
+  }
+  ++httpStats.events;
+
+  NetResult result = {};
+  result.job = NetJob::PushedSync;
+  if (reader.overflowed()) {
+    // Too big to parse from the buffer; fetch the same thing instead.
+    Serial.println("Pushed sync too large, polling instead");
+    result.ok = loadDeviceSync(result);
+  } else {
+    NetJsonArena::Scope scope(jsonArena);
+    JsonDocument filter(&jsonArena);
+    filterDeviceSync(filter);
+    filter.shrinkToFit();
+
+    JsonDocument doc(&jsonArena);
+    DeserializationError error = parseFiltered(doc, &filter, false, reader.data(), reader.dataLength());
+    if (error) {
+      Serial.print("Pushed sync parse failed: ");
+      Serial.println(error.c_str());
+      return;
+    }
+    readDeviceSync(doc, result);
+    result.ok = true;
+  }
+  postNetResult(result);
+
+  if (result.ok && result.remindNow) {
+    acknowledgeWaterReminder();
+  }
+}
+
+// Network task only: opens the stream when it is due, or reads what has
+// arrived on it.
+void serviceEventStream() {
+  if (!eventStream.open) {
+    if ((long)(millis() - eventStream.retryAt) < 0) {
+      return;
+    }
+    eventStream.open = openEventStream();
+    if (eventStream.open) {
+      eventStream.retryDelayMs = EVENT_RETRY_MIN_MS;
+      postEventStreamStatus(NetJob::EventsOpened);
+    } else {
+      eventStream.retryAt = millis() + eventStream.retryDelayMs;
+      eventStream.retryDelayMs = min(eventStream.retryDelayMs * 2, EVENT_RETRY_MAX_MS);
+    }
+    return;
+  }
+
+  WiFiClient &client = apiClient(eventStream.connection);
+  while (client.available() > 0) {
+    eventStream.lastByteAt = millis();
+    if (eventStream.reader.feed(static_cast<char>(client.read()))) {
+      const uint32_t allocationsBefore = netTaskAllocations.load(std::memory_order_relaxed);
+      handleStreamEvent();
+      recordJobAllocations(
+          netHeapStats, NetJob::PushedSync, netTaskAllocations.load(std::memory_order_relaxed) - allocationsBefore);
+    }
+  }
+
+  if (eventStream.reader.finished()) {
+    Serial.println("Event stream ended by server");
+    closeEventStream(true);
+  } else if (!client.connected()) {
+    Serial.println("Event stream dropped");
+    closeEventStream(false);
+  } else if (millis() - eventStream.lastByteAt >= EVENT_STALL_MS) {
+    Serial.println("Event stream went quiet");
+    closeEventStream(false);
+  }
+}
+
+void netTaskMain(void *) {
+  if (!eventLog.begin("eventlog")) {
+    Serial.println("NVS unavailable, event log kept in RAM only");
+  }
+  if (!eventLog.empty()) {
+    Serial.printf("Event log: %u records from before the reset\n", (unsigned)eventLog.size());
+    scheduleUpload(0);
+  }
+  beginWifi();
+  // lwIP's SNTP client keeps resyncing on its own from here, across
+  // reconnects; onSntpSync hands each answer to the loop task.
+  sntp_set_time_sync_notification_cb(onSntpSync);
+  configTime(0, 0, NTP_SERVER_PRIMARY, NTP_SERVER_SECONDARY);
+
+  NetRequest request;
+  for (;;) {
+    if (serviceWifi() && !eventLog.empty()) {
+      scheduleUpload(0);
+    }
+    if (!wifiLinkUp()) {
+      // Requests wait in netRequests; the event log keeps taking events.
+      takeDeviceEvents();
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(EVENT_READ_POLL_MS));
+      continue;
+    }
+
+    while (netRequests.pop(request)) {
+      const uint32_t allocationsBefore = netTaskAllocations.load(std::memory_order_relaxed);
+      NetResult result = {};
+      result.job = request.job;
+      result.ok = runNetJob(request, result);
+      postNetResult(result);
+
+      // Ack after handing the reminder over, so the banner does not wait on it.
+      if (result.ok && result.hasReminder && result.remindNow) {
+        acknowledgeWaterReminder();
+      }
+      recordJobAllocations(
+          netHeapStats, request.job, netTaskAllocations.load(std::memory_order_relaxed) - allocationsBefore);
+    }
+    serviceEventStream();
+    serviceEventLog();
+    serviceTelemetry();
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(EVENT_READ_POLL_MS));
+  }
+}
+
+void startNetTask() {
+  if (xTaskCreatePinnedToCore(
+          netTaskMain, "net", NET_TASK_STACK_BYTES, nullptr, NET_TASK_PRIORITY, &netTaskHandle, NET_TASK_CORE) != pdPASS) {
+    netTaskHandle = nullptr;
+    Serial.println("Network task start failed");
+  }
+}
+
+// Loop task only. False when the job could not be queued.
+bool queueNetJob(NetJob job) {
+  if (netTaskHandle == nullptr) {
+    return false;
+  }
+
+  // A job still waiting for its answer covers this one too, so a slow
+  // backend cannot pile up polls.
+  const uint16_t jobBit = 1u << static_cast<uint8_t>(job);
+  if (netJobsPending & jobBit) {
+    return true;
+  }
+
+  NetRequest request = {job};
+  if (!netRequests.push(request)) {
+    Serial.println("Network queue full, request dropped");
+    return false;
+  }
+  netJobsPending |= jobBit;
+  xTaskNotifyGive(netTaskHandle);
+  return true;
+}
+
+// Local reminder scheduler (loop task). Due times are worked out from the
+// fetched schedule the way in_window() and is_due() in routes/water.py do:
+// interval_min after the last reminder, and only inside the start/end
+// window (which may cross midnight) in the schedule's local time. loop()
+// checks on every pass, so a reminder shows within a pass of falling due,
+// network or not; the server only hears about it afterwards, in a batch.
+struct LocalSchedule {
+  bool known;               // a schedule with a valid window has arrived
+  bool enabled;
+  int intervalMinutes;
+  int16_t startMinute;      // minutes after local midnight
+  int16_t endMinute;
+  int16_t utcOffsetMinutes;
+  int64_t serverNextMs;     // status next_reminder_at, 0 when never reminded
+  int64_t lastFiredMs;      // last reminder shown here, 0 when none yet
+};
+
+LocalSchedule localSchedule = {};
+ClockSample wallClock = {};
+bool wallClockSet = false;
+bool wallClockFromSntp = false;
+
+// "HH:MM" as minutes after midnight, -1 when malformed.
+int16_t parseClockMinutes(const char *hhmm) {
+  int hours, minutes;
+  if (sscanf(hhmm, "%d:%d", &hours, &minutes) != 2 || hours < 0 || hours > 23 || minutes < 0 || minutes > 59) {
+    return -1;
+  }
+  return hours * 60 + minutes;
+}
+
+// A server time only sets the clock until SNTP has answered once.
+void setWallClockFromServer(const NetResult &result) {
+  if (result.serverTimeMs == 0 || wallClockFromSntp) {
+    return;
+  }
+  wallClock = {result.serverTimeMs, result.receivedAt};
+  wallClockSet = true;
+}
+
+int64_t wallClockNowMs() {
+  // Signed: a server reading can be stamped a little after this task's millis().
+  return wallClock.epochMs + static_cast<long>(millis() - wallClock.atMillis);
+}
+
+// Inclusive at both ends, like in_window().
+bool inReminderWindow(int64_t epochMs) {
+  const int64_t localSeconds = epochMs / 1000 + localSchedule.utcOffsetMinutes * 60;
+  const int32_t secondOfDay = static_cast<int32_t>(((localSeconds % 86400) + 86400) % 86400);
+  const int32_t start = localSchedule.startMinute * 60;
+  const int32_t end = localSchedule.endMinute * 60;
+  if (start <= end) {
+    return start <= secondOfDay && secondOfDay <= end;
+  }
+  return secondOfDay >= start || secondOfDay <= end;
+}
+
+// 0 (due at once) when there has never been a reminder, like is_due(). A
+// reminder shown here counts before the server's next_reminder_at catches up.
+int64_t nextLocalReminderMs() {
+  int64_t due = localSchedule.serverNextMs;
+  if (localSchedule.lastFiredMs != 0) {
+    due = max(due, localSchedule.lastFiredMs + localSchedule.intervalMinutes * static_cast<int64_t>(60000));
+  }
+  return due;
+}
+
+void fireLocalReminder(int64_t nowMs) {
+  localSchedule.lastFiredMs = nowMs;
+
+  // Same wording as the server's reminder payload.
+  copyText(reminderTitle, sizeof(reminderTitle), "Drink water");
+  copyText(reminderMessage, sizeof(reminderMessage), "Time to hydrate!");
+  copyText(reminderAnimation, sizeof(reminderAnimation), "WATER_DROP");
+  waterReminderActive = true;
+  scheduleLoopItem(LoopItem::BannerTimeout, REMINDER_BANNER_MS);
+  setReminderChime(true);
+  Serial.printf("Local reminder, next in %d min\n", localSchedule.intervalMinutes);
+  renderForestUi();
+
+  DeviceEvent event = {DeviceEventType::Reminder, 0, nowMs};
+  if (!deviceEvents.push(event)) {
+    Serial.println("Event queue full, reminder not reported");
+  }
+}
+
+// Loop task only: takes SNTP answers, then shows a reminder that is due.
+void serviceLocalReminders() {
+  ClockSample sample;
+  while (sntpSamples.pop(sample)) {
+    wallClock = sample;
+    wallClockSet = wallClockFromSntp = true;
+  }
+
+  if (!wallClockSet || !localSchedule.known || !localSchedule.enabled || localSchedule.intervalMinutes <= 0) {
+    return;
+  }
+  const int64_t nowMs = wallClockNowMs();
+  if (nowMs >= nextLocalReminderMs() && inReminderWindow(nowMs)) {
+    fireLocalReminder(nowMs);
+  }
+}
+
+void applySchedule() {
+  const ScheduleState &schedule = deviceState.schedule;
+  localSchedule.enabled = schedule.enabled;
+  localSchedule.intervalMinutes = schedule.intervalMinutes;
+  localSchedule.startMinute = parseClockMinutes(schedule.startTime);
+  localSchedule.endMinute = parseClockMinutes(schedule.endTime);
+  localSchedule.utcOffsetMinutes = schedule.utcOffsetMinutes;
+  localSchedule.known = localSchedule.startMinute >= 0 && localSchedule.endMinute >= 0;
+  if (!isnan(schedule.dailyGoalLiters)) {
+    dailyGoalLiters = schedule.dailyGoalLiters;
+  }
+  Serial.printf(
+      "Water schedule: every %d min, window %s-%s (UTC%+d min), goal %.2f L%s\n",
+      localSchedule.intervalMinutes,
+      schedule.startTime,
+      schedule.endTime,
+      localSchedule.utcOffsetMinutes,
+      dailyGoalLiters,
+      localSchedule.enabled ? "" : ", disabled");
+}
+
+void applyStatus() {
+  const StatusState &status = deviceState.status;
+  if (!isnan(status.dailyGoalLiters)) {
+    dailyGoalLiters = status.dailyGoalLiters;
+  }
+  localSchedule.serverNextMs = status.nextReminderMs;
+  Serial.printf(
+      "Device status: water=%u%% stress=%u%%, %.2f / %.2f L\n",
+      status.waterPercent,
+      status.stressPercent,
+      status.totalIntakeLiters,
+      dailyGoalLiters);
+  // The first status from the server starts the chart's clock; later ones
+  // only change what the next sample reads.
+  if (!loopScheduler.pending(static_cast<uint8_t>(LoopItem::HistorySample))) {
+    scheduleLoopItem(LoopItem::HistorySample, 0);
+  }
+}
+
+// Loop task only. Takes each section of the published state that moved
+// since the last look; true when one did.
+bool refreshDeviceState() {
+  static uint32_t seenVersion = 0;
+  if (publishedState.version() == seenVersion) {
+    return false;
+  }
+  DeviceState latest;
+  seenVersion = publishedState.read(latest);
+
+  bool changed = false;
+  if (latest.scheduleVersion != deviceState.scheduleVersion) {
+    deviceState.scheduleVersion = latest.scheduleVersion;
+    deviceState.schedule = latest.schedule;
+    applySchedule();
+    changed = true;
+  }
+  if (latest.statusVersion != deviceState.statusVersion) {
+    deviceState.statusVersion = latest.statusVersion;
+    deviceState.status = latest.status;
+    applyStatus();
+    changed = true;
+  }
+  return changed;
+}
+
+// True when the banner changed and the screen needs a redraw.
+bool applyReminder(const NetResult &result) {
+  Serial.printf("Reminder poll: remind_now=%s reason=%s\n", result.remindNow ? "true" : "false", result.reason);
+
+  if (!result.remindNow) {
+    if (!waterReminderActive) {
+      return false;
+    }
+    waterReminderActive = false;
+    setReminderChime(false);
+    return true;
+  }
+
+  copyText(reminderTitle, sizeof(reminderTitle), result.reminderTitle);
+  copyText(reminderMessage, sizeof(reminderMessage), result.reminderMessage);
+  copyText(reminderAnimation, sizeof(reminderAnimation), result.reminderAnimation);
+
+  // A poll that finds the reminder still due chimes only the first time.
+  if (!waterReminderActive) {
+    setReminderChime(true);
+  }
+  waterReminderActive = true;
+  scheduleLoopItem(LoopItem::BannerTimeout, REMINDER_BANNER_MS);
+  Serial.printf("Reminder animation: %s\n", reminderAnimation);
+  return true;
+}
+
+void printBootStep(const char *step, unsigned long at) {
+  if (at == 0) {
+    Serial.printf("  %-12s  not yet\n", step);
+  } else {
+    Serial.printf("  %-12s %6lu\n", step, at);
+  }
+}
+
+void printBootTimes() {
+  Serial.println("boot, ms since reset:");
+  printBootStep("panel ready", bootTimes.panelReady);
+  printBootStep(bootTimes.restored ? "saved status" : "boot screen", bootTimes.firstFrame);
+  printBootStep("wifi up", bootTimes.wifiUp);
+  printBootStep("fresh data", bootTimes.freshData);
+}
+
+void applyNetResult(const NetResult &result) {
+  netJobsPending &= ~(1u << static_cast<uint8_t>(result.job));
+
+  switch (result.job) {
+    // Over the forest UI only the serial log hears of WiFi: the last known
+    // state stays up until fresher comes.
+    case NetJob::WifiConnecting:
+      if (!forestOnScreen) {
+        drawStatus("Connecting WiFi", WIFI_SSID);
+      }
+      return;
+    case NetJob::WifiConnected:
+      if (bootTimes.wifiUp == 0) {
+        // 0 reads as not yet; a link up within the first millisecond is 1.
+        bootTimes.wifiUp = result.receivedAt > 0 ? result.receivedAt : 1;
+      }
+      if (!forestOnScreen) {
+        drawStatus("WiFi connected", result.wifiAddress);
+      }
+      return;
+    case NetJob::EventsOpened:
+      eventStreamOpen = true;
+      loopScheduler.cancel(static_cast<uint8_t>(LoopItem::Sync));
+      Serial.println("Event stream open, polling paused");
+      return;
+    case NetJob::EventsClosed:
+      // The stream is usually back before the next poll would go out.
+      eventStreamOpen = false;
+      scheduleLoopItem(LoopItem::Sync, SYNC_INTERVAL_MS);
+      return;
+    default:
+      break;
+  }
+
+  if (!result.ok) {
+    return;
+  }
+
+  // One sync can carry any mix of sections; draw once for all of them.
+  setWallClockFromServer(result);
+  bool redraw = refreshDeviceState();
+  if (result.hasReminder && applyReminder(result)) {
+    redraw = true;
+  }
+  if (redraw) {
+    renderForestUi();
+  }
+  if (bootTimes.freshData == 0 && deviceState.statusVersion != 0) {
+    bootTimes.freshData = millis();
+    printBootTimes();
+  }
+}
+
+// Loop task only. Counts the drink on screen at once and leaves the upload
+// to the network task's event log; the server's next status corrects the
+// numbers if they differ. False when the event queue is full.
+bool recordIntake(int amountMl) {
+  DeviceEvent event = {DeviceEventType::Intake, static_cast<int16_t>(amountMl), wallClockSet ? wallClockNowMs() : 0};
+  if (!deviceEvents.push(event)) {
+    Serial.println("Event queue full, intake dropped");
+    return false;
+  }
+  playSound(&UI_CLICK, CLICK_GAIN);
+  if (netTaskHandle != nullptr) {
+    xTaskNotifyGive(netTaskHandle);
+  }
+
+  StatusState &status = deviceState.status;
+  status.totalIntakeLiters += amountMl / 1000.0f;
+  if (dailyGoalLiters > 0) {
+    status.waterPercent = clampPercent(lroundf(status.totalIntakeLiters / dailyGoalLiters * 100));
+  }
+  Serial.printf("Logged intake: %d mL, total now %.2f L\n", amountMl, status.totalIntakeLiters);
+  renderForestUi();
+  return true;
+}
+
+// applyNetResult(), with what it allocates counted against the job.
+void applyCountedNetResult(const NetResult &result) {
+  const uint32_t allocationsBefore = loopTaskAllocations.load(std::memory_order_relaxed);
+  applyNetResult(result);
+  recordJobAllocations(
+      loopHeapStats, result.job, loopTaskAllocations.load(std::memory_order_relaxed) - allocationsBefore);
+}
+
+void drainNetResults() {
+  NetResult result;
+  while (netResults.pop(result)) {
+    applyCountedNetResult(result);
+  }
+}
+
+// Blocking round trip through the network task: queues the job, then
+// applies results until its own comes back. Only for callers that want the
+// answer before going on, such as the simulator scenario; loop() itself
+// only ever queues.
+bool awaitNetJob(NetJob job) {
+  if (!queueNetJob(job)) {
+    return false;
+  }
+
+  NetResult result;
+  for (;;) {
+    while (netResults.pop(result)) {
+      applyCountedNetResult(result);
+      if (result.job == job) {
+        return result.ok;
+      }
+    }
+    delay(NET_WAIT_POLL_MS);
+  }
+}
+
+bool fetchWaterSchedule() {
+  return awaitNetJob(NetJob::FetchSchedule);
+}
+
+bool fetchWaterSummary() {
+  return awaitNetJob(NetJob::FetchSummary);
+}
+
+// recordIntake(), then waits until the event log has reached the server.
+bool postWaterIntake(int amountMl) {
+  return recordIntake(amountMl) && awaitNetJob(NetJob::FlushEvents);
+}
+
+bool pollWaterReminder() {
+  return awaitNetJob(NetJob::PollReminder);
+}
+
+bool syncDevice() {
+  return awaitNetJob(NetJob::SyncDevice);
+}
+
+// Cycles per glyph / circle / sprite through the virtual Adafruit_GFX path
+// versus fastTft. Both draw the same pixels. Ends with a full UI redraw;
+// built with -DSPITFT_BUS_STATS it also reports that frame's bus traffic.
+void runRenderBenchmark() {
+  constexpr int BENCH_GLYPHS = 256;
+  constexpr int BENCH_CIRCLES = 64;
+#if HAS_PET_SPRITE
+  constexpr int BENCH_BITMAPS = 8;
+#endif
+  uint32_t start;
+
+  tft.fillScreen(ST77XX_BLACK);
+  historyChartDirty = true;
+
+  start = ESP.getCycleCount();
+  for (int i = 0; i < BENCH_GLYPHS; ++i) {
+    tft.drawChar((i % 21) * 6, (i / 21) * 8, 'A' + (i % 26), ST77XX_WHITE, ST77XX_BLUE, 1);
+  }
+  uint32_t glyphSlow = (ESP.getCycleCount() - start) / BENCH_GLYPHS;
+
+  start = ESP.getCycleCount();
+  for (int i = 0; i < BENCH_GLYPHS; ++i) {
+    fastTft.drawChar((i % 21) * 6, (i / 21) * 8, 'A' + (i % 26), ST77XX_WHITE, ST77XX_BLUE, 1);
+  }
+  uint32_t glyphFast = (ESP.getCycleCount() - start) / BENCH_GLYPHS;
+
+  start = ESP.getCycleCount();
+  for (int i = 0; i < BENCH_CIRCLES; ++i) {
+    tft.drawCircle(64, 120, 4 + (i % 32), ST77XX_YELLOW);
+  }
+  uint32_t circleSlow = (ESP.getCycleCount() - start) / BENCH_CIRCLES;
+
+  start = ESP.getCycleCount();
+  for (int i = 0; i < BENCH_CIRCLES; ++i) {
+    fastTft.drawCircle(64, 120, 4 + (i % 32), ST77XX_GREEN);
+  }
+  uint32_t circleFast = (ESP.getCycleCount() - start) / BENCH_CIRCLES;
+
+  Serial.printf("bench glyph:  gfx=%lu fast=%lu cycles\n", (unsigned long)glyphSlow, (unsigned long)glyphFast);
+  Serial.printf("bench circle: gfx=%lu fast=%lu cycles\n", (unsigned long)circleSlow, (unsigned long)circleFast);
+
+#if HAS_PET_SPRITE && PET_SPRITE_INDEXED
+  start = ESP.getCycleCount();
+  for (int i = 0; i < BENCH_BITMAPS; ++i) {
+    tft.drawIndexedBitmap(0, 32, PET_SPRITE_INDICES[0], PET_SPRITE_PALETTE, PET_SPRITE_BPP,
+                          PET_SPRITE_WIDTH, PET_SPRITE_HEIGHT);
+  }
+  uint32_t bitmapIndexed = (ESP.getCycleCount() - start) / BENCH_BITMAPS;
+
+  Serial.printf("bench sprite: indexed %ubpp=%lu cycles\n", (unsigned)PET_SPRITE_BPP, (unsigned long)bitmapIndexed);
+#elif HAS_PET_SPRITE
+  start = ESP.getCycleCount();
+  for (int i = 0; i < BENCH_BITMAPS; ++i) {
+    tft.Adafruit_GFX::drawRGBBitmap(0, 32, PET_SPRITE_DATA, PET_SPRITE_WIDTH, PET_SPRITE_HEIGHT);
+  }
+  uint32_t bitmapSlow = (ESP.getCycleCount() - start) / BENCH_BITMAPS;
+
+  start = ESP.getCycleCount();
+  for (int i = 0; i < BENCH_BITMAPS; ++i) {
+    fastTft.drawRGBBitmap(0, 32, PET_SPRITE_DATA, PET_SPRITE_WIDTH, PET_SPRITE_HEIGHT);
+  }
+  uint32_t bitmapFast = (ESP.getCycleCount() - start) / BENCH_BITMAPS;
+
+  Serial.printf("bench sprite: gfx=%lu fast=%lu cycles\n", (unsigned long)bitmapSlow, (unsigned long)bitmapFast);
+#endif
+
+#if defined(SPITFT_BUS_STATS)
+  tft.resetAddrWindowStats();
+#endif
+  start = ESP.getCycleCount();
+  renderForestUi();
+  uint32_t frameCycles = ESP.getCycleCount() - start;
+  Serial.printf("bench frame:  %lu cycles\n", (unsigned long)frameCycles);
+#if defined(SPITFT_BUS_STATS)
+  const Adafruit_ST77xx::AddrWindowStats &win = tft.addrWindowStats();
+  Serial.printf("bench windows: %lu coalesced, CASET %lu, RASET %lu, RAMWR %lu\n",
+                (unsigned long)win.coalesced, (unsigned long)win.caset, (unsigned long)win.raset, (unsigned long)win.ramwr);
+#endif
+}
+
+void printLoopStats() {
+  Serial.println("loop items: runs, worst ms late, runs <1 1 2-3 4-7 8-15 16-31 32-63 64+ ms late");
+  for (uint8_t id = 0; id < static_cast<uint8_t>(LoopItem::Count); ++id) {
+    const auto &stats = loopScheduler.stats(id);
+    Serial.printf("  %-12s %6lu %5lu ", loopScheduler.name(id), (unsigned long)stats.runs,
+                  (unsigned long)stats.worstLateMs);
+    for (uint32_t count : stats.lateness) {
+      Serial.printf(" %lu", (unsigned long)count);
+    }
+    Serial.println();
+  }
+}
+
+void runSerialCommand(const char *command) {
+  if (strcasecmp(command, "drink") == 0) {
+    recordIntake(250);
+  } else if (strcasecmp(command, "summary") == 0) {
+    queueNetJob(NetJob::FetchSummary);
+  } else if (strcasecmp(command, "schedule") == 0) {
+    queueNetJob(NetJob::FetchSchedule);
+  } else if (strcasecmp(command, "poll") == 0) {
+    queueNetJob(NetJob::PollReminder);
+  } else if (strcasecmp(command, "sync") == 0) {
+    queueNetJob(NetJob::SyncDevice);
+  } else if (strcasecmp(command, "net") == 0) {
+    queueNetJob(NetJob::ReportStats);
+  } else if (strcasecmp(command, "sched") == 0) {
+    printLoopStats();
+  } else if (strcasecmp(command, "boot") == 0) {
+    printBootTimes();
+  } else if (strcasecmp(command, "bench") == 0) {
+    runRenderBenchmark();
+  } else if (strcasecmp(command, "chime") == 0) {
+    setReminderChime(true);
+  } else if (strcasecmp(command, "audio") == 0) {
+    printAudioStats();
+  }
+}
+
+LineReader<32> serialLine;
+
+// Takes whatever the UART has; a half-typed command waits for the rest.
+void readSerialInput() {
+  while (Serial.available()) {
+    if (serialLine.feed(static_cast<char>(Serial.read())) && !serialLine.overflowed()) {
+      runSerialCommand(serialLine.line());
+    }
+  }
+}
+
+void checkLocalReminders() {
+  serviceLocalReminders();
+
+  // Straight to the next reminder when that is sooner than the next check.
+  unsigned long delayMs = REMINDER_CHECK_MS;
+  if (wallClockSet && localSchedule.known && localSchedule.enabled && localSchedule.intervalMinutes > 0) {
+    const int64_t untilNextMs = nextLocalReminderMs() - wallClockNowMs();
+    if (untilNextMs >= 0 && untilNextMs < static_cast<int64_t>(delayMs)) {
+      delayMs = static_cast<unsigned long>(untilNextMs);
+    }
+  }
+  scheduleLoopItem(LoopItem::Reminders, delayMs);
+}
+
+void syncWhileStreamDown() {
+  if (!eventStreamOpen) {
+    queueNetJob(NetJob::SyncDevice);
+    scheduleLoopItem(LoopItem::Sync, SYNC_INTERVAL_MS);
+  }
+}
+
+// A local or pushed reminder has nothing after it to take the banner down.
+void clearReminderBanner() {
+  if (waterReminderActive) {
+    waterReminderActive = false;
+    setReminderChime(false);
+    renderForestUi();
+  }
+}
+
+void advancePetFrame() {
+#if HAS_PET_SPRITE && PET_SPRITE_INDEXED
+  // The reminder banner overlaps the sprite, so hold the frame while it shows.
+  if (!waterReminderActive) {
+    petFrame = (petFrame + 1) % PET_SPRITE_FRAMES;
+    drawPetArt();
+  }
+  scheduleLoopItem(LoopItem::PetFrame, PET_FRAME_MS);
+#endif
+}
+
+void startLoopScheduler() {
+  loopTaskHandle = xTaskGetCurrentTaskHandle();
+  loopScheduler.add(static_cast<uint8_t>(LoopItem::NetResults), "net results", drainNetResults);
+  loopScheduler.add(static_cast<uint8_t>(LoopItem::SerialInput), "serial", readSerialInput);
+  loopScheduler.add(static_cast<uint8_t>(LoopItem::Reminders), "reminders", checkLocalReminders);
+  loopScheduler.add(static_cast<uint8_t>(LoopItem::Sync), "sync", syncWhileStreamDown);
+  loopScheduler.add(static_cast<uint8_t>(LoopItem::BannerTimeout), "banner", clearReminderBanner);
+  loopScheduler.add(static_cast<uint8_t>(LoopItem::PetFrame), "pet frame", advancePetFrame);
+  loopScheduler.add(static_cast<uint8_t>(LoopItem::HistorySample), "history", sampleHistory);
+  loopScheduler.setLatenessHook(noteLoopLateness);
+
+  // Sync and check reminders on the first pass rather than an interval
+  // after boot.
+  scheduleLoopItem(LoopItem::Sync, 0);
+  scheduleLoopItem(LoopItem::Reminders, 0);
+#if HAS_PET_SPRITE && PET_SPRITE_INDEXED
+  if (PET_SPRITE_FRAMES > 1) {
+    scheduleLoopItem(LoopItem::PetFrame, PET_FRAME_MS);
+  }
+#endif
+  // Runs on the UART driver's event task.
+  Serial.onReceive([] { wakeLoopTask(); });
+}
+
+// ST7735R datasheet: RST low for at least 10 us; then 120 ms before the
+// first command if the panel was awake (a reset of the ESP32 alone), 5 ms
+// after power-on.
+constexpr unsigned long TFT_RESET_PULSE_US = 20;
+constexpr unsigned long TFT_RESET_MS = 120;
+
+unsigned long panelResetAt = 0;
+
+void resetPanel() {
+  pinMode(TFT_RST, OUTPUT);
+  digitalWrite(TFT_RST, LOW);
+  delayMicroseconds(TFT_RESET_PULSE_US);
+  digitalWrite(TFT_RST, HIGH);
+  panelResetAt = millis();
+}
+
+// Waits out what is left of the reset time, then draws the first frame
+// into frame memory while the display is still off and switches it on
+// once the controller is ready, so the frame appears whole.
+void initializeScreen(bool restored) {
+    SPI.begin(TFT_SDK, 19, TFT_SDA, TFT_A0);
+
+    const unsigned long sinceReset = millis() - panelResetAt;
+    if (sinceReset < TFT_RESET_MS) {
+        delay(TFT_RESET_MS - sinceReset);
+    }
+    tft.startR(INITR_GREENTAB);
+    fastTft.begin();
+    bootTimes.panelReady = millis();
+
+    if (restored) {
+        renderForestUi();
+    } else {
+        drawStatus("Booting ESP32", "Preparing network");
+    }
+    tft.displayOn();
+    bootTimes.firstFrame = millis();
+    bootTimes.restored = restored;
+}
+
+ // namespace
+
+// The panel's reset time goes to reading the saved status and starting
+// the network and audio tasks; WiFi associates on core 0 from then on.
+// The first frame shows the saved status, and nothing after it waits for
+// the network: the first sync replaces it whenever it arrives.
+void setup() {
+  Serial.begin(115200);
+  resetPanel();
+  const bool restored = restoreSavedStatus();
+  startNetTask();
+  startAudio();
+  initializeScreen(restored);
+
+//   fetchWaterSchedule();
+//   fetchWaterSummary();
+//   pollWaterReminder();
+
+  startLoopScheduler();
 }
 
 // void loop() {
@@ -627,40 +3202,22 @@ void setup() {
 // }
 
 void loop() {
-  ensureWifiConnected();
-
-  unsigned long now = millis();
-
-  if (now - lastReminderPollAt >= REMINDER_POLL_MS) {
-    pollWaterReminder();
-    lastReminderPollAt = now;
-  }
-
-  if (now - lastSummaryRefreshAt >= SUMMARY_REFRESH_MS) {
-    fetchWaterSummary();
-    lastSummaryRefreshAt = now;
+  // Work other tasks or the UART handed over; each of these woke us.
+  const unsigned long now = millis();
+  if (!netResults.empty()) {
+    loopScheduler.runBy(static_cast<uint8_t>(LoopItem::NetResults), now);
   }
-
-  if (now - lastScheduleRefreshAt >= SCHEDULE_REFRESH_MS) {
-    fetchWaterSchedule();
-    lastScheduleRefreshAt = now;
+  if (!sntpSamples.empty()) {
+    loopScheduler.runBy(static_cast<uint8_t>(LoopItem::Reminders), now);
   }
-
   if (Serial.available()) {
-    String command = Serial.readStringUntil('\n');
-    command.trim();
-
-    if (command.equalsIgnoreCase("drink")) {
-      postWaterIntake(250);
-      fetchWaterSummary();
-    } else if (command.equalsIgnoreCase("summary")) {
-      fetchWaterSummary();
-    } else if (command.equalsIgnoreCase("schedule")) {
-      fetchWaterSchedule();
-    } else if (command.equalsIgnoreCase("poll")) {
-      pollWaterReminder();
-    }
+    loopScheduler.runBy(static_cast<uint8_t>(LoopItem::SerialInput), now);
   }
 
-  delay(50);
+  const unsigned long idleMs = loopScheduler.runDue(millis, LOOP_MAX_IDLE_MS);
+  if (loopHealthChanged) {
+    publishedLoopHealth.write(loopHealth);
+    loopHealthChanged = false;
+  }
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(idleMs));
 }
\ No newline at end of file
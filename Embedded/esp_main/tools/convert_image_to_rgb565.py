@@ -3,16 +3,23 @@ Convert an input image into a header that Adafruit_GFX can draw with drawRGBBitm
 
 Usage:
   py -3 tools/convert_image_to_rgb565.py path\to\image.png include\pet_sprite.h
+  py -3 tools/convert_image_to_rgb565.py --bpp 4 idle1.png idle2.png idle3.png include\pet_sprite.h
 
 Notes:
   - Requires Pillow: `py -3 -m pip install pillow`
   - The script resizes to 64x64 by default to fit the 128x128 TFT cleanly.
   - Generate the art externally (for example with Gemini), save it locally, then run this script.
+  - --bpp 16 (default) writes plain RGB565 pixels (PET_SPRITE_DATA), one frame only.
+  - --bpp 4 / --bpp 8 quantize every frame to one shared 16- / 256-color palette
+    (PET_SPRITE_PALETTE) and write packed indices (PET_SPRITE_INDICES), left pixel
+    in the high bits, rows padded to a whole byte. The firmware draws these with
+    tft.drawIndexedBitmap(). A 64x64 frame is 2 KB at 4bpp and 4 KB at 8bpp,
+    instead of 8 KB.
 """
 
 from __future__ import annotations
 
-import sys
+import argparse
 from pathlib import Path
 
 try:
@@ -28,42 +35,114 @@ def rgb888_to_rgb565(red: int, green: int, blue: int) -> int:
     return ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3)
 
 
-def main() -> int:
-    if len(sys.argv) != 3:
-        print("Usage: py -3 tools/convert_image_to_rgb565.py INPUT_IMAGE OUTPUT_HEADER")
-        return 1
+def image_pixels(image: Image.Image) -> list:
+    # getdata() is deprecated from Pillow 12 on.
+    if hasattr(image, "get_flattened_data"):
+        return list(image.get_flattened_data())
+    return list(image.getdata())
 
-    input_path = Path(sys.argv[1])
-    output_path = Path(sys.argv[2])
 
-    image = Image.open(input_path).convert("RGB").resize(DEFAULT_SIZE, Image.Resampling.NEAREST)
-    pixels = list(image.getdata())
-    rgb565_values = [rgb888_to_rgb565(r, g, b) for r, g, b in pixels]
+def format_array(values: list[int], digits: int, chunk_size: int, indent: str = "    ") -> list[str]:
+    lines: list[str] = []
+    for index in range(0, len(values), chunk_size):
+        chunk = values[index : index + chunk_size]
+        line = ", ".join(f"0x{value:0{digits}X}" for value in chunk)
+        suffix = "," if index + chunk_size < len(values) else ""
+        lines.append(f"{indent}{line}{suffix}")
+    return lines
 
-    lines: list[str] = [
-        "#pragma once",
-        "",
-        "#include <Arduino.h>",
-        "",
+
+def rgb565_lines(image: Image.Image) -> list[str]:
+    rgb565_values = [rgb888_to_rgb565(r, g, b) for r, g, b in image_pixels(image)]
+    return [
         f"constexpr int16_t PET_SPRITE_WIDTH = {DEFAULT_SIZE[0]};",
         f"constexpr int16_t PET_SPRITE_HEIGHT = {DEFAULT_SIZE[1]};",
         "",
         "constexpr uint16_t PET_SPRITE_DATA[PET_SPRITE_WIDTH * PET_SPRITE_HEIGHT] = {",
+        *format_array(rgb565_values, 4, 12),
+        "};",
     ]
 
-    chunk_size = 12
-    for index in range(0, len(rgb565_values), chunk_size):
-        chunk = rgb565_values[index : index + chunk_size]
-        line = ", ".join(f"0x{value:04X}" for value in chunk)
-        suffix = "," if index + chunk_size < len(rgb565_values) else ""
-        lines.append(f"    {line}{suffix}")
 
+def pack_indices(indices: list[int], width: int, bpp: int) -> list[int]:
+    per_byte = 8 // bpp
+    packed: list[int] = []
+    for row in range(0, len(indices), width):
+        row_indices = indices[row : row + width]
+        for start in range(0, width, per_byte):
+            value = 0
+            group = row_indices[start : start + per_byte]
+            for position, index in enumerate(group):
+                value |= index << (8 - bpp * (position + 1))
+            packed.append(value)
+    return packed
+
+
+def indexed_lines(frames: list[Image.Image], bpp: int) -> list[str]:
+    colors = 1 << bpp
+    width, height = DEFAULT_SIZE
+
+    # Quantize all frames together so they share one palette.
+    sheet = Image.new("RGB", (width, height * len(frames)))
+    for number, frame in enumerate(frames):
+        sheet.paste(frame, (0, height * number))
+    palette_image = sheet.quantize(colors=colors, method=Image.Quantize.MEDIANCUT, dither=Image.Dither.NONE)
+
+    raw_palette = palette_image.getpalette()[: colors * 3]
+    raw_palette += [0] * (colors * 3 - len(raw_palette))
+    palette = [rgb888_to_rgb565(*raw_palette[i : i + 3]) for i in range(0, colors * 3, 3)]
+
+    stride = (width * bpp + 7) // 8
+    lines = [
+        "#define PET_SPRITE_INDEXED 1",
+        "",
+        f"constexpr int16_t PET_SPRITE_WIDTH = {width};",
+        f"constexpr int16_t PET_SPRITE_HEIGHT = {height};",
+        f"constexpr uint8_t PET_SPRITE_BPP = {bpp};",
+        f"constexpr uint8_t PET_SPRITE_FRAMES = {len(frames)};",
+        "",
+        "constexpr uint16_t PET_SPRITE_PALETTE[1 << PET_SPRITE_BPP] = {",
+        *format_array(palette, 4, 8),
+        "};",
+        "",
+        f"constexpr uint8_t PET_SPRITE_INDICES[PET_SPRITE_FRAMES][{stride} * PET_SPRITE_HEIGHT] = {{",
+    ]
+    for number, frame in enumerate(frames):
+        indices = image_pixels(frame.quantize(palette=palette_image, dither=Image.Dither.NONE))
+        suffix = "," if number + 1 < len(frames) else ""
+        lines.append("    {")
+        lines.extend(format_array(pack_indices(indices, width, bpp), 2, 16, "        "))
+        lines.append(f"    }}{suffix}")
     lines.append("};")
+    return lines
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Convert images into a pet sprite header.")
+    parser.add_argument("--bpp", type=int, choices=(4, 8, 16), default=16, help="bits per pixel (default 16)")
+    parser.add_argument("inputs", nargs="+", type=Path, help="input image(s); one per animation frame")
+    parser.add_argument("output", type=Path, help="output header")
+    args = parser.parse_args()
+
+    if args.bpp == 16 and len(args.inputs) > 1:
+        parser.error("animation frames need --bpp 4 or --bpp 8")
+
+    frames = [
+        Image.open(path).convert("RGB").resize(DEFAULT_SIZE, Image.Resampling.NEAREST) for path in args.inputs
+    ]
+
+    lines: list[str] = [
+        "#pragma once",
+        "",
+        "#include <Arduino.h>",
+        "",
+    ]
+    lines += rgb565_lines(frames[0]) if args.bpp == 16 else indexed_lines(frames, args.bpp)
     lines.append("")
 
-    output_path.parent.mkdir(parents=True, exist_ok=True)
-    output_path.write_text("\n".join(lines), encoding="utf-8")
-    print(f"Wrote {output_path}")
+    args.output.parent.mkdir(parents=True, exist_ok=True)
+    args.output.write_text("\n".join(lines), encoding="utf-8")
+    print(f"Wrote {args.output}")
     return 0
 
 
@@ -0,0 +1,152 @@
+"""
+Synthesize the firmware's sound clips and write them as IMA ADPCM into a header.
+
+Usage:
+  py -3 tools/make_chime_clips.py include\chime_clips.h
+
+Notes:
+  - Standard library only.
+  - Clips are mono at CHIME_SAMPLE_RATE, 4-bit IMA ADPCM with no block headers:
+    the decoder starts from a predictor of 0 at the clip's <NAME>_STEP_INDEX,
+    two samples per byte, low nibble first (include/ima_adpcm.h). The start
+    index is whichever gives the least error, which matters for clips that
+    begin loud. A second of sound is 8 KB.
+  - The reminder chime is two bell-like notes; the click is a short tick for
+    button-style feedback. Both peak well under full scale so they can play
+    over each other without clipping.
+"""
+
+from __future__ import annotations
+
+import argparse
+import math
+from pathlib import Path
+
+
+SAMPLE_RATE = 16000
+
+INDEX_STEP = [-1, -1, -1, -1, 2, 4, 6, 8]
+STEP_SIZE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88,
+    97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+    724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660,
+    4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818,
+    18500, 20350, 22385, 24623, 27086, 29794, 32767,
+]
+
+
+def bell(frequency: float, start: float, length: float, peak: float) -> list[tuple[int, float]]:
+    """(sample index, value) pairs of one decaying note with two overtones."""
+    partials = ((1.0, 1.0), (2.0, 0.35), (3.0, 0.12))
+    first = int(start * SAMPLE_RATE)
+    samples = []
+    for offset in range(int(length * SAMPLE_RATE)):
+        t = offset / SAMPLE_RATE
+        attack = min(1.0, t / 0.003)
+        decay = math.exp(-t / 0.22)
+        value = sum(weight * math.sin(2 * math.pi * frequency * ratio * t) for ratio, weight in partials)
+        samples.append((first + offset, peak * attack * decay * value / 1.47))
+    return samples
+
+
+def render(notes: list[list[tuple[int, float]]], length: float) -> list[int]:
+    mix = [0.0] * int(length * SAMPLE_RATE)
+    for note in notes:
+        for index, value in note:
+            if index < len(mix):
+                mix[index] += value
+    fade = int(0.03 * SAMPLE_RATE)
+    for offset in range(fade):
+        mix[len(mix) - 1 - offset] *= offset / fade
+    return [max(-32768, min(32767, round(value * 32767))) for value in mix]
+
+
+def reminder_chime() -> list[int]:
+    return render([bell(1318.5, 0.0, 0.9, 0.45), bell(1046.5, 0.35, 0.9, 0.45)], 1.2)
+
+
+def click() -> list[int]:
+    length = 0.012
+    samples = []
+    for offset in range(int(length * SAMPLE_RATE)):
+        t = offset / SAMPLE_RATE
+        samples.append(0.4 * math.exp(-t / 0.003) * math.sin(2 * math.pi * 2500 * t))
+    return [round(value * 32767) for value in samples]
+
+
+def encode_adpcm(samples: list[int], start_index: int) -> tuple[list[int], int]:
+    """Packed bytes and the squared error of what a decoder will play."""
+    predictor = 0
+    index = start_index
+    nibbles = []
+    error = 0
+    for sample in samples:
+        step = STEP_SIZE[index]
+        diff = sample - predictor
+        nibble = 8 if diff < 0 else 0
+        diff = abs(diff)
+        delta = step >> 3
+        for bit, share in ((4, step), (2, step >> 1), (1, step >> 2)):
+            if diff >= share:
+                nibble |= bit
+                diff -= share
+                delta += share
+        # Track the decoder exactly, so rounding never drifts.
+        predictor = max(-32768, min(32767, predictor - delta if nibble & 8 else predictor + delta))
+        index = max(0, min(88, index + INDEX_STEP[nibble & 7]))
+        nibbles.append(nibble)
+        error += (sample - predictor) ** 2
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return [nibbles[i] | (nibbles[i + 1] << 4) for i in range(0, len(nibbles), 2)], error
+
+
+def format_array(values: list[int], chunk_size: int = 16, indent: str = "    ") -> list[str]:
+    lines: list[str] = []
+    for index in range(0, len(values), chunk_size):
+        chunk = values[index : index + chunk_size]
+        line = ", ".join(f"0x{value:02X}" for value in chunk)
+        suffix = "," if index + chunk_size < len(values) else ""
+        lines.append(f"{indent}{line}{suffix}")
+    return lines
+
+
+def clip_lines(name: str, samples: list[int]) -> list[str]:
+    start_index = min(range(len(STEP_SIZE)), key=lambda index: encode_adpcm(samples, index)[1])
+    adpcm, _ = encode_adpcm(samples, start_index)
+    return [
+        f"constexpr uint32_t {name}_SAMPLES = {len(samples)};",
+        f"constexpr uint8_t {name}_STEP_INDEX = {start_index};",
+        f"constexpr uint8_t {name}_ADPCM[{len(adpcm)}] = {{",
+        *format_array(adpcm),
+        "};",
+        "",
+    ]
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Write the firmware's ADPCM sound clips header.")
+    parser.add_argument("output", type=Path, help="output header")
+    args = parser.parse_args()
+
+    lines: list[str] = [
+        "#pragma once",
+        "",
+        "// Generated by tools/make_chime_clips.py; edit the script, not this file.",
+        "",
+        "#include <stdint.h>",
+        "",
+        f"constexpr uint32_t CHIME_SAMPLE_RATE = {SAMPLE_RATE};",
+        "",
+    ]
+    lines += clip_lines("CHIME_REMINDER", reminder_chime())
+    lines += clip_lines("CHIME_CLICK", click())
+
+    args.output.parent.mkdir(parents=True, exist_ok=True)
+    args.output.write_text("\n".join(lines), encoding="utf-8")
+    print(f"Wrote {args.output}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())